@@ -0,0 +1,839 @@
+#include <chrono>
+#include <functional>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "AABBTree.h"
+#include "Frustum.h"
+#include "GridRay.h"
+#include "Math.h"
+#include "Noise.h"
+#include "Pathfinder.h"
+#include "QuatRotator.h"
+#include "Random.h"
+#include "SIMD.h"
+#include "SpatialHash.h"
+#include "ThreadPool.h"
+#include "TransformHierarchy.h"
+#include "VectorExpression.h"
+#include "VectorStream.h"
+
+// headless microbenchmark of the math library
+// every benchmark runs once per eoeSIMDProcessor (generic reference, then the best the cpu supports)
+// so scalar and SIMD timings land side by side, and --json writes the same table
+// for diffing one commit against another
+//
+// usage: MathBench [--filter substring] [--min-time ms] [--generic-only] [--json path]
+
+static constexpr int	SINGLE_COUNT	= 1024;		// inputs a single-call benchmark cycles through per run
+static constexpr int	BATCH_COUNT		= 4096;		// elements a batch benchmark processes per run
+static constexpr int	NUM_TRIALS		= 5;		// best trial is reported
+static constexpr int	HIERARCHY_NODES	= 4096;
+static constexpr int	NOISE_CHUNKS	= 16;		// 64x64 tile chunks per FbmChunks run
+static constexpr int	NOISE_CHUNK_SIZE	= 64;
+static constexpr int	SPATIAL_ENTITIES	= 100000;	// units spread over a 2048x2048 world
+static constexpr int	TILE_MAP_SIZE	= 256;		// tiles on a side of the line of sight, picking, and path map
+static constexpr int	PATH_COUNT		= 64;		// paths per FindPaths run, from the first sightFrom[] to sightTo[]
+static constexpr int	MAX_PATH		= 256;
+
+//--------------------------
+// DoNotOptimize
+// forces value to be materialized so the work producing it is not discarded
+//--------------------------
+template<typename type>
+inline void DoNotOptimize(const type & value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile char sink;
+	sink = *reinterpret_cast<const volatile char *>(&value);
+#endif
+}
+
+//--------------------------------------------
+//			eoeBenchmark
+// one named timing loop, opsPerRun is how many
+// calls a single invocation of run performs
+//--------------------------------------------
+struct eoeBenchmark {
+	const char *				name;
+	const char *				kind;			// "single" or "batch"
+	int							opsPerRun;
+	std::function<void()>		run;
+};
+
+struct eoeBenchResult {
+	std::string					name;
+	std::string					kind;
+	std::string					processor;
+	double						nsPerOp;
+	double						mopsPerSec;
+};
+
+//--------------------------------------------
+//			eoeBenchData
+// deterministic inputs shared by every benchmark
+// so timings are comparable run to run
+//--------------------------------------------
+struct eoeBenchData {
+	std::vector<float>			f0, f1, fOut0, fOut1;
+	std::vector<float>			fractions;					// tween progress in [0, 1]
+	std::vector<float>			mvps;						// SINGLE_COUNT column-major matrices
+	std::vector<int>			i0, i1, iOut;
+	std::vector<eoeVec2>		v2a, v2b, v2Out;
+	std::vector<eoeVec3>		v3a, v3b, v3Out;
+	std::vector<eoeVec4>		v4a, v4b, v4Out;
+	std::vector<eoeQuat>		qa, qb, qOut;
+	std::vector<eoeMat4>		ma, mb;
+	std::vector<eoeMat4CM>		cma, cmb;					// ma, mb in column-major storage
+	std::vector<eoeMat3x2>		affa, affb;
+	std::vector<eoeAABB>		boxes;
+	std::vector<eoeSphere>		spheres;
+	std::vector<int>			visibleIndexes;
+	eoeFrustum					frustum;
+	eoeRandom					rng;
+	eoeRandomLanes				rngLanes;
+	std::mt19937				mt;
+	eoeNoiseParams				noiseParams;
+	std::vector<eoeVec2>		chunkOrigins;
+	std::vector<float>			noiseChunks;
+	eoeSpatialHash				spatialHash;
+	std::vector<int>			spatialEntities;
+	std::vector<eoeVec2>		spatialPositions[2];		// alternate frames, a small step apart
+	std::vector<int>			spatialResults;
+	int							spatialFrame = 0;
+	eoeAABBTree2				tree;
+	std::vector<int>			treeProxies;
+	std::vector<eoeVec2>		treeMins[2];				// spatialPositions[] -/+ half a unit
+	std::vector<eoeVec2>		treeMaxs[2];
+	std::vector<float>			treeDistances;
+	std::vector<eoeVec2i>		treePairs;
+	std::vector<uint8_t>		tileOpaque;					// one in eight tiles blocks sight
+	std::vector<float>			tileHeights;				// 0, 16, 32, or 48 isometric units
+	std::vector<eoeVec2i>		sightFrom, sightTo;
+	bool						sightVisible[BATCH_COUNT];
+	std::vector<uint8_t>		tileCosts;					// opaque tiles block paths, except sightFrom[] and sightTo[]
+	eoePathfinder				pathfinder;
+	std::vector<eoeVec2i>		paths;
+	std::vector<int>			pathLengths;
+	eoeVec3Stream				s3a, s3b, s3Out;
+	eoeVec4Stream				s4a, s4b;
+	eoeTransformHierarchy		hierarchy;
+	std::vector<int>			hierarchyNodes;
+
+								eoeBenchData();
+};
+
+static unsigned int benchSeed = 0x9e3779b9u;
+
+//--------------------------
+// RandomFloat
+// xorshift32 mapped to [min, max), fixed seed
+//--------------------------
+static float RandomFloat(const float min, const float max) {
+	benchSeed ^= benchSeed << 13;
+	benchSeed ^= benchSeed >> 17;
+	benchSeed ^= benchSeed << 5;
+	return min + (max - min) * (float)(benchSeed >> 8) * (1.0f / 16777216.0f);
+}
+
+//--------------------------
+// RandomQuat
+//--------------------------
+static eoeQuat RandomQuat() {
+	eoeVec3 axis(RandomFloat(-1.0f, 1.0f), RandomFloat(-1.0f, 1.0f), RandomFloat(0.1f, 1.0f));
+	axis.Normalize();
+	return eoeQuat::FromAxisAngle(axis, RandomFloat(-180.0f, 180.0f));
+}
+
+//--------------------------
+// RandomTRS
+// an invertible translation * rotation * scale matrix
+//--------------------------
+static eoeMat4 RandomTRS() {
+	const eoeTransform transform(eoeVec3(RandomFloat(-100.0f, 100.0f), RandomFloat(-100.0f, 100.0f), RandomFloat(-100.0f, 100.0f)),
+								 RandomQuat(),
+								 eoeVec3(RandomFloat(0.5f, 2.0f), RandomFloat(0.5f, 2.0f), RandomFloat(0.5f, 2.0f)));
+	return transform.ToMat4();
+}
+
+//--------------------------
+// eoeBenchData::eoeBenchData
+//--------------------------
+eoeBenchData::eoeBenchData()
+	: spatialHash(16.0f),
+	  tree(0.5f),
+	  s3a(BATCH_COUNT),
+	  s3b(BATCH_COUNT),
+	  s3Out(BATCH_COUNT),
+	  s4a(BATCH_COUNT),
+	  s4b(BATCH_COUNT) {
+	f0.resize(BATCH_COUNT);
+	f1.resize(BATCH_COUNT);
+	fOut0.resize(BATCH_COUNT);
+	fOut1.resize(BATCH_COUNT);
+	i0.resize(BATCH_COUNT);
+	i1.resize(BATCH_COUNT);
+	iOut.resize(BATCH_COUNT);
+	v2a.resize(BATCH_COUNT);
+	v2b.resize(BATCH_COUNT);
+	v2Out.resize(BATCH_COUNT);
+	v3a.resize(BATCH_COUNT);
+	v3b.resize(BATCH_COUNT);
+	v3Out.resize(BATCH_COUNT);
+	v4a.resize(BATCH_COUNT);
+	v4b.resize(BATCH_COUNT);
+	v4Out.resize(BATCH_COUNT);
+	qa.resize(BATCH_COUNT);
+	qb.resize(BATCH_COUNT);
+	qOut.resize(BATCH_COUNT);
+	ma.resize(SINGLE_COUNT);
+	mb.resize(SINGLE_COUNT);
+	cma.resize(SINGLE_COUNT);
+	cmb.resize(SINGLE_COUNT);
+	affa.resize(SINGLE_COUNT);
+	affb.resize(SINGLE_COUNT);
+	mvps.resize(SINGLE_COUNT * 16);
+
+	for (int i = 0; i < BATCH_COUNT; ++i) {
+		f0[i] = RandomFloat(-1000.0f, 1000.0f);
+		f1[i] = RandomFloat(0.001f, 1000.0f);
+		i0[i] = (int)RandomFloat(-1000.0f, 1000.0f);
+		i1[i] = (int)RandomFloat(-1000.0f, 1000.0f);
+		v2a[i] = eoeVec2(RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f));
+		v2b[i] = eoeVec2(RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f));
+		v3a[i] = eoeVec3(RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f));
+		v3b[i] = eoeVec3(RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f));
+		v4a[i] = eoeVec4(RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f), 1.0f);
+		v4b[i] = eoeVec4(RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f), RandomFloat(-10.0f, 10.0f));
+		qa[i] = RandomQuat();
+		qb[i] = RandomQuat();
+	}
+
+	for (int i = 0; i < SINGLE_COUNT; ++i) {
+		ma[i] = RandomTRS();
+		mb[i] = RandomTRS();
+		cma[i] = eoeMat4CM(ma[i]);
+		cmb[i] = eoeMat4CM(mb[i]);
+		affa[i] = eoeMat3x2::FromTRS(eoeVec2(RandomFloat(-100.0f, 100.0f), RandomFloat(-100.0f, 100.0f)), RandomFloat(0.0f, 360.0f), eoeVec2(RandomFloat(0.5f, 2.0f), RandomFloat(0.5f, 2.0f)));
+		affb[i] = eoeMat3x2::FromTRS(eoeVec2(RandomFloat(-100.0f, 100.0f), RandomFloat(-100.0f, 100.0f)), RandomFloat(0.0f, 360.0f), eoeVec2(RandomFloat(0.5f, 2.0f), RandomFloat(0.5f, 2.0f)));
+	}
+
+	// roughly half the bounds inside a camera at the origin looking down -z
+	boxes.resize(BATCH_COUNT);
+	spheres.resize(BATCH_COUNT);
+	visibleIndexes.resize(BATCH_COUNT);
+	frustum.SetFromMatrix(eoeMat4::GetPerspective(90.0f, 1.0f, 0.1f, 100.0f));
+	for (int i = 0; i < BATCH_COUNT; ++i) {
+		const eoeVec3 center(RandomFloat(-100.0f, 100.0f), RandomFloat(-100.0f, 100.0f), RandomFloat(-100.0f, 0.0f));
+		boxes[i] = eoeAABB::FromCenterExtents(center, eoeVec3(RandomFloat(0.5f, 5.0f), RandomFloat(0.5f, 5.0f), RandomFloat(0.5f, 5.0f)));
+		spheres[i] = eoeSphere(center, RandomFloat(0.5f, 5.0f));
+	}
+
+	s3a.Gather(v3a.data(), BATCH_COUNT);
+	s3b.Gather(v3b.data(), BATCH_COUNT);
+	s4a.Gather(v4a.data(), BATCH_COUNT);
+	s4b.Gather(v4b.data(), BATCH_COUNT);
+
+	// a few wide trees a handful of levels deep
+	hierarchyNodes.reserve(HIERARCHY_NODES);
+	for (int i = 0; i < HIERARCHY_NODES; ++i) {
+		const int parent = i < 8 ? -1 : hierarchyNodes[(i - 8) / 4];
+		const eoeTransform local(eoeVec3(RandomFloat(-5.0f, 5.0f), RandomFloat(-5.0f, 5.0f), RandomFloat(-5.0f, 5.0f)), RandomQuat());
+		hierarchyNodes.push_back(hierarchy.AddNode(local, parent));
+	}
+	hierarchy.Update();
+
+	noiseParams.frequency = 0.05f;
+	chunkOrigins.resize(NOISE_CHUNKS);
+	noiseChunks.resize(NOISE_CHUNKS * NOISE_CHUNK_SIZE * NOISE_CHUNK_SIZE);
+	for (int i = 0; i < NOISE_CHUNKS; ++i)
+		chunkOrigins[i] = eoeVec2((float)((i % 4) * NOISE_CHUNK_SIZE), (float)((i / 4) * NOISE_CHUNK_SIZE));
+
+	fractions.resize(BATCH_COUNT);
+	for (int i = 0; i < BATCH_COUNT; ++i)
+		fractions[i] = RandomFloat(0.0f, 1.0f);
+
+	spatialEntities.resize(SPATIAL_ENTITIES);
+	spatialPositions[0].resize(SPATIAL_ENTITIES);
+	spatialPositions[1].resize(SPATIAL_ENTITIES);
+	spatialResults.resize(256);
+	for (int i = 0; i < SPATIAL_ENTITIES; ++i) {
+		spatialPositions[0][i] = eoeVec2(RandomFloat(0.0f, 2048.0f), RandomFloat(0.0f, 2048.0f));
+		spatialPositions[1][i] = spatialPositions[0][i] + eoeVec2(RandomFloat(-1.0f, 1.0f), RandomFloat(-1.0f, 1.0f));
+		spatialEntities[i] = spatialHash.Add(spatialPositions[0][i], eoeVec2(0.5f, 0.5f));
+	}
+
+	treeProxies.resize(SPATIAL_ENTITIES);
+	treeDistances.resize(spatialResults.size());
+	treePairs.resize(SPATIAL_ENTITIES);
+	for (int frame = 0; frame < 2; ++frame) {
+		treeMins[frame].resize(SPATIAL_ENTITIES);
+		treeMaxs[frame].resize(SPATIAL_ENTITIES);
+		for (int i = 0; i < SPATIAL_ENTITIES; ++i) {
+			treeMins[frame][i] = spatialPositions[frame][i] - eoeVec2(0.5f, 0.5f);
+			treeMaxs[frame][i] = spatialPositions[frame][i] + eoeVec2(0.5f, 0.5f);
+		}
+	}
+	for (int i = 0; i < SPATIAL_ENTITIES; ++i)
+		treeProxies[i] = tree.Add(treeMins[0][i], treeMaxs[0][i]);
+
+	tileOpaque.resize(TILE_MAP_SIZE * TILE_MAP_SIZE);
+	tileHeights.resize(TILE_MAP_SIZE * TILE_MAP_SIZE);
+	for (int i = 0; i < TILE_MAP_SIZE * TILE_MAP_SIZE; ++i) {
+		tileOpaque[i] = (int)RandomFloat(0.0f, 8.0f) == 0;
+		tileHeights[i] = (float)((int)RandomFloat(0.0f, 4.0f) * 16);
+	}
+
+	// units a few dozen tiles apart
+	sightFrom.resize(BATCH_COUNT);
+	sightTo.resize(BATCH_COUNT);
+	for (int i = 0; i < BATCH_COUNT; ++i) {
+		sightFrom[i] = eoeVec2i((int)RandomFloat(32.0f, TILE_MAP_SIZE - 32.0f), (int)RandomFloat(32.0f, TILE_MAP_SIZE - 32.0f));
+		sightTo[i] = sightFrom[i] + eoeVec2i((int)RandomFloat(-32.0f, 32.0f), (int)RandomFloat(-32.0f, 32.0f));
+	}
+
+	tileCosts.resize(TILE_MAP_SIZE * TILE_MAP_SIZE);
+	for (int i = 0; i < TILE_MAP_SIZE * TILE_MAP_SIZE; ++i)
+		tileCosts[i] = tileOpaque[i] ? 0 : 1;
+	for (int i = 0; i < PATH_COUNT; ++i) {
+		tileCosts[sightFrom[i].y * TILE_MAP_SIZE + sightFrom[i].x] = 1;
+		tileCosts[sightTo[i].y * TILE_MAP_SIZE + sightTo[i].x] = 1;
+	}
+	pathfinder.SetGrid(tileCosts.data(), TILE_MAP_SIZE, TILE_MAP_SIZE);
+	paths.resize(PATH_COUNT * MAX_PATH);
+	pathLengths.resize(PATH_COUNT);
+}
+
+//--------------------------
+// RegisterBenchmarks
+// single-call benchmarks time the inline/scalar api one call at a time,
+// batch benchmarks time the pointer+count api routed through EVIL_SIMD
+//--------------------------
+static void RegisterBenchmarks(std::vector<eoeBenchmark> & benchmarks, eoeBenchData & d) {
+	const auto single = [&](const char * name, std::function<void()> run) {
+		benchmarks.push_back({ name, "single", SINGLE_COUNT, run });
+	};
+	const auto batch = [&](const char * name, const int opsPerRun, std::function<void()> run) {
+		benchmarks.push_back({ name, "batch", opsPerRun, run });
+	};
+
+	// eoeVec2
+	single("eoeVec2::operator+", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v2a[i] + d.v2b[i]); });
+	single("eoeVec2::operator*(float)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v2a[i] * d.f1[i]); });
+	single("eoeVec2::Dot", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v2a[i] * d.v2b[i]); });
+	single("eoeVec2::Length", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v2a[i].Length()); });
+	single("eoeVec2::Normalized", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v2a[i].Normalized()); });
+
+	// eoeVec3
+	single("eoeVec3::operator+", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v3a[i] + d.v3b[i]); });
+	single("eoeVec3::operator*(float)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v3a[i] * d.f1[i]); });
+	single("eoeVec3::Dot", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v3a[i] * d.v3b[i]); });
+	single("eoeVec3::Cross", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v3a[i].Cross(d.v3b[i])); });
+	single("eoeVec3::Length", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v3a[i].Length()); });
+	single("eoeVec3::Normalize", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			eoeVec3 v = d.v3a[i];
+			DoNotOptimize(v.Normalize());
+			DoNotOptimize(v);
+		}
+	});
+
+	// eoeVec4
+	single("eoeVec4::operator+", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v4a[i] + d.v4b[i]); });
+	single("eoeVec4::operator*", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v4a[i] * d.v4b[i]); });
+	single("eoeVec4::operator/", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.v4a[i] / d.v4b[i]); });
+	single("eoeVec4::Clamp01", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			eoeVec4 v = d.v4b[i];
+			v.Clamp01();
+			DoNotOptimize(v);
+		}
+	});
+
+	// eoeQuat
+	single("eoeQuat::operator*(eoeQuat)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.qa[i] * d.qb[i]); });
+	single("eoeQuat::operator*(eoeVec3)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.qa[i] * d.v3a[i]); });
+	single("eoeQuat::FromAxisAngle", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeQuat::FromAxisAngle(vec3_up, d.f0[i])); });
+	single("eoeQuat::Rotate", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeQuat::Rotate(vec3_up, d.f0[i], static_cast<const eoeVec3 &>(d.v3a[i]))); });
+	single("eoeQuat::Normalize", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			eoeQuat q = d.qa[i];
+			DoNotOptimize(q.Normalize());
+			DoNotOptimize(q);
+		}
+	});
+	single("eoeQuat::Nlerp", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeQuat::Nlerp(d.qa[i], d.qb[i], 0.3f)); });
+	single("eoeQuat::Slerp", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeQuat::Slerp(d.qa[i], d.qb[i], 0.3f)); });
+	single("eoeQuat::SlerpFast", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeQuat::SlerpFast(d.qa[i], d.qb[i], 0.3f)); });
+	single("eoeQuat::ToMat4", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.qa[i].ToMat4()); });
+	single("eoeQuatRotator::Rotate", [&] {
+		const eoeQuatRotator rotator(d.qa[0]);
+		for (int i = 0; i < SINGLE_COUNT; ++i)
+			DoNotOptimize(rotator.Rotate(d.v3a[i]));
+	});
+	batch("eoeQuatRotator::RotateMany", BATCH_COUNT, [&] {
+		const eoeQuatRotator rotator(d.qa[0]);
+		rotator.RotateMany(d.v3Out.data(), d.v3a.data(), BATCH_COUNT);
+		DoNotOptimize(d.v3Out[0]);
+	});
+
+	// eoeMat4
+	single("eoeMat4::operator*(eoeMat4)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.ma[i] * d.mb[i]); });
+	single("eoeMat4::operator*(eoeVec4)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.ma[i] * d.v4a[i]); });
+	single("eoeMat4CM::operator*(eoeMat4CM)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.cma[i] * d.cmb[i]); });
+	single("eoeMat4CM::operator*(eoeVec4)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.cma[i] * d.v4a[i]); });
+	single("eoeMat4::Determinant", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.ma[i].Determinant()); });
+	single("eoeMat4::Transpose", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.ma[i].Transpose()); });
+	single("eoeMat4::Inverse", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.ma[i].Inverse()); });
+	single("eoeMat4::AffineInverse", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.ma[i].AffineInverse()); });
+	single("eoeMat4::GetRotation", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMat4::GetRotation(vec3_up, d.f0[i])); });
+	single("eoeMat4::GetPerspective", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMat4::GetPerspective(60.0f, d.f1[i], 0.1f, 1000.0f)); });
+	single("eoeTransform::ToMat4", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			const eoeTransform transform(d.v3a[i], d.qa[i], d.v3b[i]);
+			DoNotOptimize(transform.ToMat4());
+		}
+	});
+	batch("eoeMat4::TransformPoints(eoeVec4)", BATCH_COUNT, [&] {
+		d.ma[0].TransformPoints(d.v4Out.data(), d.v4a.data(), BATCH_COUNT);
+		DoNotOptimize(d.v4Out[0]);
+	});
+	batch("eoeMat4::TransformPoints(eoeVec3)", BATCH_COUNT, [&] {
+		d.ma[0].TransformPoints(d.v3Out.data(), d.v3a.data(), BATCH_COUNT);
+		DoNotOptimize(d.v3Out[0]);
+	});
+	batch("eoeMat4::TransformDirections(eoeVec3)", BATCH_COUNT, [&] {
+		d.ma[0].TransformDirections(d.v3Out.data(), d.v3a.data(), BATCH_COUNT);
+		DoNotOptimize(d.v3Out[0]);
+	});
+	batch("eoeMat4::TransformPointsProjective(eoeVec4)", BATCH_COUNT, [&] {
+		d.ma[0].TransformPointsProjective(d.v4Out.data(), d.v4a.data(), BATCH_COUNT);
+		DoNotOptimize(d.v4Out[0]);
+	});
+	batch("viewProj * model[i], Transpose, copy", SINGLE_COUNT, [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			const eoeMat4 mvp = (d.ma[0] * d.mb[i]).Transpose();
+			memcpy(d.mvps.data() + i * 16, mvp.ToFloatPtr(), sizeof(eoeMat4));
+		}
+		DoNotOptimize(d.mvps[0]);
+	});
+	batch("eoeMat4::MultiplyToColumnMajor", SINGLE_COUNT, [&] {
+		d.ma[0].MultiplyToColumnMajor(d.mvps.data(), d.mb.data(), SINGLE_COUNT);
+		DoNotOptimize(d.mvps[0]);
+	});
+	batch("eoeTransformHierarchy::Update", HIERARCHY_NODES, [&] {
+		d.hierarchy.SetLocal(d.hierarchyNodes[0], d.hierarchy.GetLocal(d.hierarchyNodes[0]));
+		for (int i = 1; i < 8; ++i)
+			d.hierarchy.SetLocal(d.hierarchyNodes[i], d.hierarchy.GetLocal(d.hierarchyNodes[i]));
+		d.hierarchy.Update();
+		DoNotOptimize(d.hierarchy.GetWorld(d.hierarchyNodes[HIERARCHY_NODES - 1]));
+	});
+
+	// eoeMat3x2
+	single("eoeMat3x2::operator*(eoeMat3x2)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.affa[i] * d.affb[i]); });
+	single("eoeMat3x2::operator*(eoeVec2)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.affa[i] * d.v2a[i]); });
+	single("eoeMat3x2::Inverse", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.affa[i].Inverse()); });
+	single("eoeMat3x2::FromTRS", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMat3x2::FromTRS(d.v2a[i], d.f0[i], d.v2b[i])); });
+	single("eoeMat3x2::ToMat4CM", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.affa[i].ToMat4CM()); });
+	batch("eoeMat3x2::TransformPoints", BATCH_COUNT, [&] {
+		d.affa[0].TransformPoints(d.v2Out.data(), d.v2a.data(), BATCH_COUNT);
+		DoNotOptimize(d.v2Out[0]);
+	});
+
+	// broadphase
+	batch("eoeSpatialHash::Move", SPATIAL_ENTITIES, [&] {
+		d.spatialFrame ^= 1;
+		d.spatialHash.Move(d.spatialEntities.data(), d.spatialPositions[d.spatialFrame].data(), SPATIAL_ENTITIES);
+		DoNotOptimize(d.spatialHash.GetPosition(0));
+	});
+	single("eoeSpatialHash::QueryRadius", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i)
+			DoNotOptimize(d.spatialHash.QueryRadius(d.spatialResults.data(), (int)d.spatialResults.size(), d.spatialPositions[0][i], 8.0f));
+	});
+	single("eoeSpatialHash::QueryBounds", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i)
+			DoNotOptimize(d.spatialHash.QueryBounds(d.spatialResults.data(), (int)d.spatialResults.size(), d.spatialPositions[0][i] - eoeVec2(8.0f, 8.0f), d.spatialPositions[0][i] + eoeVec2(8.0f, 8.0f)));
+	});
+
+	batch("eoeAABBTree2::Refit", SPATIAL_ENTITIES, [&] {
+		d.spatialFrame ^= 1;
+		d.tree.Refit(d.treeProxies.data(), d.treeMins[d.spatialFrame].data(), d.treeMaxs[d.spatialFrame].data(), SPATIAL_ENTITIES);
+		DoNotOptimize(d.tree.GetHeight());
+	});
+	single("eoeAABBTree2::QueryBounds", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i)
+			DoNotOptimize(d.tree.QueryBounds(d.spatialResults.data(), (int)d.spatialResults.size(), d.spatialPositions[0][i] - eoeVec2(8.0f, 8.0f), d.spatialPositions[0][i] + eoeVec2(8.0f, 8.0f)));
+	});
+	single("eoeAABBTree2::FindNearest(8)", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i)
+			DoNotOptimize(d.tree.FindNearest(d.spatialResults.data(), d.treeDistances.data(), 8, d.spatialPositions[0][i]));
+	});
+	single("eoeAABBTree2::Raycast", [&] {
+		float fraction;
+		for (int i = 0; i < SINGLE_COUNT; ++i)
+			DoNotOptimize(d.tree.Raycast(d.spatialPositions[0][i] + eoeVec2(1.0f, 1.0f), d.spatialPositions[0][i] + eoeVec2(64.0f, 32.0f), fraction));
+	});
+	batch("eoeAABBTree2::FindOverlappingPairs", SPATIAL_ENTITIES, [&] {
+		DoNotOptimize(d.tree.FindOverlappingPairs(d.treePairs.data(), (int)d.treePairs.size()));
+	});
+
+	// tile grids
+	batch("eoeGridRay::LineOfSight", BATCH_COUNT, [&] {
+		eoeGridRay::LineOfSight(d.sightVisible, d.sightFrom.data(), d.sightTo.data(), BATCH_COUNT, d.tileOpaque.data(), TILE_MAP_SIZE);
+		DoNotOptimize(d.sightVisible[0]);
+	});
+	single("eoeGridRay::PickTile(heights)", [&] {
+		const auto topHeight = [&](const eoeVec2i & tile) {
+			if (tile.x < 0 || tile.y < 0 || tile.x >= TILE_MAP_SIZE || tile.y >= TILE_MAP_SIZE)
+				return -1.0f;
+			return d.tileHeights[tile.y * TILE_MAP_SIZE + tile.x];
+		};
+		eoeVec2i tile;
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			const eoeVec2 cursor(d.spatialPositions[0][i].x - 1024.0f, d.spatialPositions[0][i].y * 2.0f);
+			DoNotOptimize(eoeGridRay::PickTile(tile, cursor, 16.0f, 48.0f, topHeight));
+		}
+	});
+
+	batch("eoePathfinder::FindPaths(A*)", PATH_COUNT, [&] {
+		d.pathfinder.FindPaths(d.pathLengths.data(), d.paths.data(), MAX_PATH, d.sightFrom.data(), d.sightTo.data(), PATH_COUNT);
+		DoNotOptimize(d.pathLengths[0]);
+	});
+	batch("eoePathfinder::FindPaths(jump point)", PATH_COUNT, [&] {
+		d.pathfinder.FindPaths(d.pathLengths.data(), d.paths.data(), MAX_PATH, d.sightFrom.data(), d.sightTo.data(), PATH_COUNT, PATH_OCTILE, PATH_JUMP_POINT);
+		DoNotOptimize(d.pathLengths[0]);
+	});
+
+	// culling
+	single("eoeFrustum::Intersects(eoeAABB)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.frustum.Intersects(d.boxes[i])); });
+	single("eoeFrustum::Intersects(eoeSphere)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.frustum.Intersects(d.spheres[i])); });
+	single("eoeFrustum::SetFromMatrix", [&] {
+		eoeFrustum frustum;
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			frustum.SetFromMatrix(d.ma[i]);
+			DoNotOptimize(frustum);
+		}
+	});
+	batch("eoeFrustum::CullAABBs", BATCH_COUNT, [&] { DoNotOptimize(d.frustum.CullAABBs(d.visibleIndexes.data(), d.boxes.data(), BATCH_COUNT)); });
+	batch("eoeFrustum::CullSpheres", BATCH_COUNT, [&] { DoNotOptimize(d.frustum.CullSpheres(d.visibleIndexes.data(), d.spheres.data(), BATCH_COUNT)); });
+
+	// eoeMath
+	single("eoeMath::NearestInt", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMath::NearestInt(d.f0[i])); });
+	single("eoeMath::GetAngle", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMath::GetAngle(d.f0[i], d.f1[i])); });
+	single("eoeMath::SinCos", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			float s, c;
+			eoeMath::SinCos(d.f0[i], s, c);
+			DoNotOptimize(s);
+			DoNotOptimize(c);
+		}
+	});
+	single("eoeMath::SinCosFast", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			float s, c;
+			eoeMath::SinCosFast(d.f0[i], s, c);
+			DoNotOptimize(s);
+			DoNotOptimize(c);
+		}
+	});
+	single("eoeMath::RSqrt", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMath::RSqrt(d.f1[i])); });
+	single("eoeMath::RSqrtFast", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMath::RSqrtFast(d.f1[i])); });
+	single("eoeMath::ATan2", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMath::ATan2(d.f0[i], d.f1[i])); });
+	single("eoeMath::ATan2Fast", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMath::ATan2Fast(d.f0[i], d.f1[i])); });
+	single("eoeMath::IsometricToOrthographic(float)", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			float x = d.f0[i], y = d.f1[i];
+			eoeMath::IsometricToOrthographic(x, y);
+			DoNotOptimize(x);
+			DoNotOptimize(y);
+		}
+	});
+	single("eoeMath::IsometricToOrthographic(int)", [&] {
+		for (int i = 0; i < SINGLE_COUNT; ++i) {
+			int x = d.i0[i], y = d.i1[i];
+			eoeMath::IsometricToOrthographic(x, y);
+			DoNotOptimize(x);
+			DoNotOptimize(y);
+		}
+	});
+	batch("eoeMath::SinCos[]", BATCH_COUNT, [&] {
+		eoeMath::SinCos(d.fOut0.data(), d.fOut1.data(), d.f0.data(), BATCH_COUNT);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeMath::SinCosFast[]", BATCH_COUNT, [&] {
+		eoeMath::SinCosFast(d.fOut0.data(), d.fOut1.data(), d.f0.data(), BATCH_COUNT);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeMath::RSqrt[]", BATCH_COUNT, [&] {
+		eoeMath::RSqrt(d.fOut0.data(), d.f1.data(), BATCH_COUNT);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeMath::RSqrtFast[]", BATCH_COUNT, [&] {
+		eoeMath::RSqrtFast(d.fOut0.data(), d.f1.data(), BATCH_COUNT);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeMath::ATan2[]", BATCH_COUNT, [&] {
+		eoeMath::ATan2(d.fOut0.data(), d.f0.data(), d.f1.data(), BATCH_COUNT);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeMath::ATan2Fast[]", BATCH_COUNT, [&] {
+		eoeMath::ATan2Fast(d.fOut0.data(), d.f0.data(), d.f1.data(), BATCH_COUNT);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeMath::IsometricToOrthographic(float[])", BATCH_COUNT, [&] {
+		memcpy(d.fOut0.data(), d.f0.data(), BATCH_COUNT * sizeof(float));
+		memcpy(d.fOut1.data(), d.f1.data(), BATCH_COUNT * sizeof(float));
+		eoeMath::IsometricToOrthographic(d.fOut0.data(), d.fOut1.data(), BATCH_COUNT);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeMath::OrthographicToIsometric(int[])", BATCH_COUNT, [&] {
+		std::vector<int> & x = d.i0;
+		std::vector<int> & y = d.i1;
+		eoeMath::OrthographicToIsometric(x.data(), y.data(), BATCH_COUNT);
+		eoeMath::IsometricToOrthographic(x.data(), y.data(), BATCH_COUNT);		// round trip keeps the inputs stable
+		DoNotOptimize(x[0]);
+	});
+
+	// eoeRandom
+	single("std::mt19937 + uniform_real_distribution", [&] {
+		std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+		for (int i = 0; i < SINGLE_COUNT; ++i)
+			DoNotOptimize(distribution(d.mt));
+	});
+	single("eoeRandom::NextFloat", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.rng.NextFloat()); });
+	single("eoeRandom::NextInt", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.rng.NextInt(-100, 100)); });
+	single("eoeRandom::NextUnitVec3", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(d.rng.NextUnitVec3()); });
+	batch("eoeRandomLanes::FillFloats", BATCH_COUNT, [&] {
+		d.rngLanes.FillFloats(d.fOut0.data(), BATCH_COUNT, -1.0f, 1.0f);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeRandomLanes::FillInts", BATCH_COUNT, [&] {
+		d.rngLanes.FillInts(d.iOut.data(), BATCH_COUNT, -1000, 1000);
+		DoNotOptimize(d.iOut[0]);
+	});
+	batch("eoeRandomLanes::FillUnitVec3s", BATCH_COUNT, [&] {
+		d.rngLanes.FillUnitVec3s(d.v3Out.data(), BATCH_COUNT);
+		DoNotOptimize(d.v3Out[0]);
+	});
+	batch("eoeRandomLanes::FillQuats", BATCH_COUNT, [&] {
+		d.rngLanes.FillQuats(d.qOut.data(), BATCH_COUNT);
+		DoNotOptimize(d.qOut[0]);
+	});
+
+	// eoeNoise
+	single("eoeNoise::Value(eoeVec2)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeNoise::Value(d.v2a[i], 0)); });
+	single("eoeNoise::Simplex(eoeVec2)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeNoise::Simplex(d.v2a[i], 0)); });
+	single("eoeNoise::Simplex(eoeVec3)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeNoise::Simplex(d.v3a[i], 0)); });
+	batch("eoeNoise::Evaluate value 2D", BATCH_COUNT, [&] {
+		eoeNoise::Evaluate(d.fOut0.data(), d.f0.data(), d.f1.data(), BATCH_COUNT, NOISE_VALUE, 0);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeNoise::Evaluate simplex 2D", BATCH_COUNT, [&] {
+		eoeNoise::Evaluate(d.fOut0.data(), d.f0.data(), d.f1.data(), BATCH_COUNT, NOISE_SIMPLEX, 0);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeNoise::Evaluate simplex 3D", BATCH_COUNT, [&] {
+		eoeNoise::Evaluate(d.fOut0.data(), d.f0.data(), d.f1.data(), d.f0.data(), BATCH_COUNT, NOISE_SIMPLEX, 0);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeNoise::FbmGrid 64x64, 4 octaves", NOISE_CHUNK_SIZE * NOISE_CHUNK_SIZE, [&] {
+		eoeNoise::FbmGrid(d.noiseChunks.data(), NOISE_CHUNK_SIZE, NOISE_CHUNK_SIZE, d.chunkOrigins[0], 1.0f, d.noiseParams);
+		DoNotOptimize(d.noiseChunks[0]);
+	});
+	batch("eoeNoise::FbmChunks 16 x 64x64, 4 octaves", NOISE_CHUNKS * NOISE_CHUNK_SIZE * NOISE_CHUNK_SIZE, [&] {
+		eoeNoise::FbmChunks(d.noiseChunks.data(), d.chunkOrigins.data(), NOISE_CHUNKS, NOISE_CHUNK_SIZE, 1.0f, d.noiseParams);
+		DoNotOptimize(d.noiseChunks[0]);
+	});
+
+	// interpolation
+	single("eoeMath::Ease(EASE_IN_OUT_CUBIC)", [&] { for (int i = 0; i < SINGLE_COUNT; ++i) DoNotOptimize(eoeMath::Ease(EASE_IN_OUT_CUBIC, d.fractions[i])); });
+	batch("eoeMath::Ease EASE_IN_OUT_CUBIC", BATCH_COUNT, [&] {
+		eoeMath::Ease(d.fOut0.data(), d.fractions.data(), BATCH_COUNT, EASE_IN_OUT_CUBIC);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeMath::Lerp(float)", BATCH_COUNT, [&] {
+		eoeMath::Lerp(d.fOut0.data(), d.f0.data(), d.f1.data(), d.fractions.data(), BATCH_COUNT);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeMath::Lerp(eoeVec3)", BATCH_COUNT, [&] {
+		eoeMath::Lerp(d.v3Out.data(), d.v3a.data(), d.v3b.data(), d.fractions.data(), BATCH_COUNT);
+		DoNotOptimize(d.v3Out[0]);
+	});
+	batch("eoeMath::Lerp(eoeVec4)", BATCH_COUNT, [&] {
+		eoeMath::Lerp(d.v4Out.data(), d.v4a.data(), d.v4b.data(), d.fractions.data(), BATCH_COUNT);
+		DoNotOptimize(d.v4Out[0]);
+	});
+	batch("eoeMath::Nlerp", BATCH_COUNT, [&] {
+		eoeMath::Nlerp(d.qOut.data(), d.qa.data(), d.qb.data(), d.fractions.data(), BATCH_COUNT);
+		DoNotOptimize(d.qOut[0]);
+	});
+	batch("eoeMath::Slerp", BATCH_COUNT, [&] {
+		eoeMath::Slerp(d.qOut.data(), d.qa.data(), d.qb.data(), d.fractions.data(), BATCH_COUNT);
+		DoNotOptimize(d.qOut[0]);
+	});
+	batch("eoeMath::SlerpFast", BATCH_COUNT, [&] {
+		eoeMath::SlerpFast(d.qOut.data(), d.qa.data(), d.qb.data(), d.fractions.data(), BATCH_COUNT);
+		DoNotOptimize(d.qOut[0]);
+	});
+
+	// fused span expressions
+	batch("eoeVecSpan<eoeVec3> = a + b * s - c", BATCH_COUNT, [&] {
+		eoeVecSpan<eoeVec3> out(d.v3Out.data(), BATCH_COUNT);
+		const eoeVecSpan<const eoeVec3> a(d.v3a.data(), BATCH_COUNT);
+		const eoeVecSpan<const eoeVec3> b(d.v3b.data(), BATCH_COUNT);
+		out = a + b * 0.5f - a;
+		DoNotOptimize(d.v3Out[0]);
+	});
+	batch("eoeVecSpan<eoeVec4> += a * float[]", BATCH_COUNT, [&] {
+		eoeVecSpan<eoeVec4> out(d.v4Out.data(), BATCH_COUNT);
+		out = eoeVecSpan<const eoeVec4>(d.v4a.data(), BATCH_COUNT);
+		out += eoeVecSpan<const eoeVec4>(d.v4b.data(), BATCH_COUNT) * eoeScalarSpan<float>(d.f0.data(), BATCH_COUNT);
+		DoNotOptimize(d.v4Out[0]);
+	});
+
+	// structure-of-arrays streams
+	batch("eoeVec3Stream::Add", BATCH_COUNT, [&] {
+		d.s3a.Add(d.s3b);
+		DoNotOptimize(d.s3a.x[0]);
+	});
+	batch("eoeVec3Stream::Dot", BATCH_COUNT, [&] {
+		d.s3a.Dot(d.fOut0.data(), d.s3b);
+		DoNotOptimize(d.fOut0[0]);
+	});
+	batch("eoeVec3Stream::Cross", BATCH_COUNT, [&] {
+		d.s3Out.Cross(d.s3a, d.s3b);
+		DoNotOptimize(d.s3Out.x[0]);
+	});
+	batch("eoeVec3Stream::Normalize", BATCH_COUNT, [&] {
+		d.s3b.Normalize();
+		DoNotOptimize(d.s3b.x[0]);
+	});
+	batch("eoeVec4Stream::MultiplyAdd", BATCH_COUNT, [&] {
+		d.s4a.MultiplyAdd(d.s4b, 0.0f);
+		DoNotOptimize(d.s4a.x[0]);
+	});
+	batch("eoeVec4Stream::Length", BATCH_COUNT, [&] {
+		d.s4a.Length(d.fOut0.data());
+		DoNotOptimize(d.fOut0[0]);
+	});
+}
+
+//--------------------------
+// TimeBenchmark
+// grows the repetition count until one trial lasts minTimeMs / NUM_TRIALS,
+// then reports the fastest of NUM_TRIALS trials
+//--------------------------
+static double TimeBenchmark(const eoeBenchmark & benchmark, const double minTimeMs) {
+	typedef std::chrono::steady_clock clock_t;
+	const double trialNs = minTimeMs * 1e6 / NUM_TRIALS;
+
+	benchmark.run();		// warm caches and lazy state
+	long long reps = 1;
+	for (;;) {
+		const auto start = clock_t::now();
+		for (long long r = 0; r < reps; ++r)
+			benchmark.run();
+		const double elapsed = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t::now() - start).count();
+		if (elapsed >= trialNs || reps >= (1ll << 30))
+			break;
+		reps = elapsed <= 0.0 ? reps * 10 : (long long)(reps * 1.2 * trialNs / elapsed) + 1;
+	}
+
+	double best = 0.0;
+	for (int trial = 0; trial < NUM_TRIALS; ++trial) {
+		const auto start = clock_t::now();
+		for (long long r = 0; r < reps; ++r)
+			benchmark.run();
+		const double elapsed = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t::now() - start).count();
+		if (trial == 0 || elapsed < best)
+			best = elapsed;
+	}
+	return best / ((double)reps * benchmark.opsPerRun);
+}
+
+//--------------------------
+// WriteJson
+// one record per benchmark and processor
+//--------------------------
+static bool WriteJson(const char * path, const std::vector<eoeBenchResult> & results) {
+	FILE * file = fopen(path, "w");
+	if (file == nullptr)
+		return false;
+
+	fprintf(file, "{\n\t\"singleCount\": %d,\n\t\"batchCount\": %d,\n\t\"results\": [\n", SINGLE_COUNT, BATCH_COUNT);
+	for (size_t i = 0; i < results.size(); ++i) {
+		const eoeBenchResult & result = results[i];
+		fprintf(file, "\t\t{ \"name\": \"%s\", \"kind\": \"%s\", \"processor\": \"%s\", \"nsPerOp\": %.4f, \"mopsPerSec\": %.4f }%s\n",
+				result.name.c_str(), result.kind.c_str(), result.processor.c_str(),
+				result.nsPerOp, result.mopsPerSec, i + 1 < results.size() ? "," : "");
+	}
+	fprintf(file, "\t]\n}\n");
+	fclose(file);
+	return true;
+}
+
+//--------------------------
+// main
+//--------------------------
+int main(int argc, char ** argv) {
+	const char * filter = nullptr;
+	const char * jsonPath = nullptr;
+	double minTimeMs = 100.0;
+	bool genericOnly = false;
+
+	for (int i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "--filter") && i + 1 < argc) {
+			filter = argv[++i];
+		} else if (!strcmp(argv[i], "--min-time") && i + 1 < argc) {
+			minTimeMs = atof(argv[++i]);
+		} else if (!strcmp(argv[i], "--json") && i + 1 < argc) {
+			jsonPath = argv[++i];
+		} else if (!strcmp(argv[i], "--generic-only")) {
+			genericOnly = true;
+		} else {
+			fprintf(stderr, "usage: %s [--filter substring] [--min-time ms] [--generic-only] [--json path]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	// the same startup the engine performs, minus the window
+	EVIL_THREADS.Init(SDL_GetCPUCount() - 1);
+
+	eoeBenchData data;
+	std::vector<eoeBenchmark> benchmarks;
+	RegisterBenchmarks(benchmarks, data);
+
+	std::vector<eoeSIMDProcessor *> processors;
+	eoeSIMD::InitProcessor(true);
+	processors.push_back(EVIL_SIMD);
+	eoeSIMD::InitProcessor(false);
+	if (!genericOnly && EVIL_SIMD != processors[0])
+		processors.push_back(EVIL_SIMD);
+
+	std::vector<eoeBenchResult> results;
+	printf("%-46s %-7s %-10s %12s %12s\n", "benchmark", "kind", "processor", "ns/op", "Mops/s");
+	for (const eoeBenchmark & benchmark : benchmarks) {
+		if (filter != nullptr && strstr(benchmark.name, filter) == nullptr)
+			continue;
+
+		for (eoeSIMDProcessor * processor : processors) {
+			eoeSIMD::processor = processor;
+			const double nsPerOp = TimeBenchmark(benchmark, minTimeMs);
+			const double mopsPerSec = nsPerOp > 0.0 ? 1e3 / nsPerOp : 0.0;
+			results.push_back({ benchmark.name, benchmark.kind, processor->GetName(), nsPerOp, mopsPerSec });
+			printf("%-46s %-7s %-10s %12.3f %12.2f\n", benchmark.name, benchmark.kind, processor->GetName(), nsPerOp, mopsPerSec);
+		}
+	}
+
+	EVIL_THREADS.Shutdown();
+
+	if (jsonPath != nullptr && !WriteJson(jsonPath, results)) {
+		fprintf(stderr, "failed to write %s\n", jsonPath);
+		return 1;
+	}
+	return 0;
+}
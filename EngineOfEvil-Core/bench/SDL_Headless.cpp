@@ -0,0 +1,61 @@
+#include <math.h>
+#include <thread>
+#include "SDL.h"
+
+// the handful of SDL entry points the math library calls, so the benchmark
+// links without an SDL binary, see EOE_BENCH_USE_SDL to use the real thing
+
+extern "C" {
+
+float SDLCALL SDL_sqrtf(float x) {
+	return sqrtf(x);
+}
+
+double SDLCALL SDL_fabs(double x) {
+	return fabs(x);
+}
+
+float SDLCALL SDL_tanf(float x) {
+	return tanf(x);
+}
+
+int SDLCALL SDL_GetCPUCount(void) {
+	const int count = (int)std::thread::hardware_concurrency();
+	return count > 0 ? count : 1;
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+SDL_bool SDLCALL SDL_HasSSE2(void) {
+	return __builtin_cpu_supports("sse2") ? SDL_TRUE : SDL_FALSE;
+}
+
+SDL_bool SDLCALL SDL_HasSSE41(void) {
+	return __builtin_cpu_supports("sse4.1") ? SDL_TRUE : SDL_FALSE;
+}
+
+SDL_bool SDLCALL SDL_HasAVX(void) {
+	return __builtin_cpu_supports("avx") ? SDL_TRUE : SDL_FALSE;
+}
+
+SDL_bool SDLCALL SDL_HasAVX2(void) {
+	return __builtin_cpu_supports("avx2") ? SDL_TRUE : SDL_FALSE;
+}
+#else
+SDL_bool SDLCALL SDL_HasSSE2(void) {
+	return SDL_FALSE;
+}
+
+SDL_bool SDLCALL SDL_HasSSE41(void) {
+	return SDL_FALSE;
+}
+
+SDL_bool SDLCALL SDL_HasAVX(void) {
+	return SDL_FALSE;
+}
+
+SDL_bool SDLCALL SDL_HasAVX2(void) {
+	return SDL_FALSE;
+}
+#endif
+
+}
@@ -0,0 +1,727 @@
+#include <stdlib.h>
+#include "AABBTree.h"
+#include "ThreadPool.h"
+
+// leaves and nodes Refit hands each thread at a time
+static const int MIN_REFIT_BATCH = 1024;
+
+// siblings may differ in height by this much before Balance rotates them,
+// the slack leaves Rotate room to improve the tree's surface area while
+// keeping its height logarithmic even for sorted or nested inserts
+static const int MAX_IMBALANCE = 2;
+
+//-------------------------
+// BoxesOverlap
+// touching boxes overlap
+//-------------------------
+template<int dimensions>
+static inline bool BoxesOverlap(const eoeVec<float, dimensions> & aMins, const eoeVec<float, dimensions> & aMaxs,
+								const eoeVec<float, dimensions> & bMins, const eoeVec<float, dimensions> & bMaxs) {
+	for (int i = 0; i < dimensions; ++i) {
+		if (aMins[i] > bMaxs[i] || aMaxs[i] < bMins[i])
+			return false;
+	}
+	return true;
+}
+
+//-------------------------
+// BoxContains
+// returns true if the inner box lies entirely within the outer box
+//-------------------------
+template<int dimensions>
+static inline bool BoxContains(const eoeVec<float, dimensions> & outerMins, const eoeVec<float, dimensions> & outerMaxs,
+							   const eoeVec<float, dimensions> & innerMins, const eoeVec<float, dimensions> & innerMaxs) {
+	for (int i = 0; i < dimensions; ++i) {
+		if (innerMins[i] < outerMins[i] || innerMaxs[i] > outerMaxs[i])
+			return false;
+	}
+	return true;
+}
+
+//-------------------------
+// SurfaceArea
+// the insertion cost metric, perimeter in 2D and surface area in 3D
+//-------------------------
+template<int dimensions>
+static inline float SurfaceArea(const eoeVec<float, dimensions> & mins, const eoeVec<float, dimensions> & maxs) {
+	const eoeVec<float, dimensions> size = maxs - mins;
+	if constexpr (dimensions == 2)
+		return 2.0f * (size.x + size.y);
+	else
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+//-------------------------
+// UnionArea
+// SurfaceArea of the box containing both boxes
+//-------------------------
+template<int dimensions>
+static inline float UnionArea(const eoeVec<float, dimensions> & aMins, const eoeVec<float, dimensions> & aMaxs,
+							  const eoeVec<float, dimensions> & bMins, const eoeVec<float, dimensions> & bMaxs) {
+	return SurfaceArea(eoeVec<float, dimensions>::Min(aMins, bMins), eoeVec<float, dimensions>::Max(aMaxs, bMaxs));
+}
+
+//-------------------------
+// BoxDistanceSquared
+// from point to the nearest point of the box, zero inside it
+//-------------------------
+template<int dimensions>
+static inline float BoxDistanceSquared(const eoeVec<float, dimensions> & point, const eoeVec<float, dimensions> & mins, const eoeVec<float, dimensions> & maxs) {
+	float distanceSquared = 0.0f;
+	for (int i = 0; i < dimensions; ++i) {
+		const float below = mins[i] - point[i];
+		const float above = point[i] - maxs[i];
+		const float outside = below > 0.0f ? below : (above > 0.0f ? above : 0.0f);
+		distanceSquared += outside * outside;
+	}
+	return distanceSquared;
+}
+
+//-------------------------
+// RayEntersBox
+// slab test of start + delta * t for t in [0, maxFraction]
+// sets fraction to where the ray enters the box, 0 if start is inside it
+//-------------------------
+template<int dimensions>
+static inline bool RayEntersBox(const eoeVec<float, dimensions> & start, const eoeVec<float, dimensions> & delta,
+								const eoeVec<float, dimensions> & mins, const eoeVec<float, dimensions> & maxs,
+								const float maxFraction, float & fraction) {
+	float enter = 0.0f;
+	float exit = maxFraction;
+	for (int i = 0; i < dimensions; ++i) {
+		if (delta[i] == 0.0f) {
+			if (start[i] < mins[i] || start[i] > maxs[i])
+				return false;
+			continue;
+		}
+
+		const float invDelta = 1.0f / delta[i];
+		float enterAxis = (mins[i] - start[i]) * invDelta;
+		float exitAxis = (maxs[i] - start[i]) * invDelta;
+		if (enterAxis > exitAxis) {
+			const float swap = enterAxis;
+			enterAxis = exitAxis;
+			exitAxis = swap;
+		}
+		enter = enterAxis > enter ? enterAxis : enter;
+		exit = exitAxis < exit ? exitAxis : exit;
+		if (enter > exit)
+			return false;
+	}
+	fraction = enter;
+	return true;
+}
+
+//-------------------------
+// eoeAABBTree::eoeAABBTree
+// margin is how far each leaf is fattened on every side
+//-------------------------
+template<int dimensions>
+eoeAABBTree<dimensions>::eoeAABBTree(const float margin)
+	: margin(margin) {
+}
+
+//-------------------------
+// eoeAABBTree::Add
+// returns the new proxy's handle
+//-------------------------
+template<int dimensions>
+int eoeAABBTree<dimensions>::Add(const vec_t & mins, const vec_t & maxs) {
+	const int proxy = AllocateNode();
+	node_t & leaf = nodes[proxy];
+	for (int i = 0; i < dimensions; ++i) {
+		leaf.mins[i] = mins[i] - margin;
+		leaf.maxs[i] = maxs[i] + margin;
+	}
+	leaf.height = 0;
+	leafMins[proxy] = mins;
+	leafMaxs[proxy] = maxs;
+
+	InsertLeaf(proxy);
+	++numProxies;
+	levelsChanged = true;
+	return proxy;
+}
+
+//-------------------------
+// eoeAABBTree::Remove
+// frees the proxy's handle for reuse by a later Add
+// DEBUG: proxy must be a live handle
+//-------------------------
+template<int dimensions>
+void eoeAABBTree<dimensions>::Remove(const int proxy) {
+	RemoveLeaf(proxy);
+	FreeNode(proxy);
+	--numProxies;
+	levelsChanged = true;
+}
+
+//-------------------------
+// eoeAABBTree::Move
+// replaces the proxy's bounds, reinserting it only if they leave its fattened leaf
+// returns true if the proxy was reinserted
+//-------------------------
+template<int dimensions>
+bool eoeAABBTree<dimensions>::Move(const int proxy, const vec_t & mins, const vec_t & maxs) {
+	leafMins[proxy] = mins;
+	leafMaxs[proxy] = maxs;
+	if (BoxContains(nodes[proxy].mins, nodes[proxy].maxs, mins, maxs))
+		return false;
+
+	RemoveLeaf(proxy);
+	for (int i = 0; i < dimensions; ++i) {
+		nodes[proxy].mins[i] = mins[i] - margin;
+		nodes[proxy].maxs[i] = maxs[i] + margin;
+	}
+	InsertLeaf(proxy);
+	levelsChanged = true;
+	return true;
+}
+
+//-------------------------
+// eoeAABBTree::Refit
+// gives proxies[i] the bounds [mins[i], maxs[i]], for count proxies, then refits
+// every internal node one height at a time, each height split across EVIL_THREADS
+// the tree's shape never changes, so it degrades as proxies drift from where
+// they were inserted, Move those that travel far to reinsert them instead
+// DEBUG: each handle may appear only once
+//-------------------------
+template<int dimensions>
+void eoeAABBTree<dimensions>::Refit(const int * proxies, const vec_t * mins, const vec_t * maxs, const int count) {
+	EVIL_THREADS.ParallelFor(count, [=](int begin, int end) {
+		for (int i = begin; i < end; ++i) {
+			const int proxy = proxies[i];
+			node_t & leaf = nodes[proxy];
+			leafMins[proxy] = mins[i];
+			leafMaxs[proxy] = maxs[i];
+			if (BoxContains(leaf.mins, leaf.maxs, mins[i], maxs[i]))
+				continue;
+
+			for (int k = 0; k < dimensions; ++k) {
+				leaf.mins[k] = mins[i][k] - margin;
+				leaf.maxs[k] = maxs[i][k] + margin;
+			}
+		}
+	}, MIN_REFIT_BATCH);
+
+	if (levelsChanged)
+		BuildLevels();
+
+	for (int height = 1; height + 1 < (int)levelStarts.size(); ++height) {
+		const int * levelBegin = levelNodes.data() + levelStarts[height];
+		EVIL_THREADS.ParallelFor(levelStarts[height + 1] - levelStarts[height], [=](int begin, int end) {
+			for (int i = begin; i < end; ++i) {
+				node_t & node = nodes[levelBegin[i]];
+				const node_t & child0 = nodes[node.children[0]];
+				const node_t & child1 = nodes[node.children[1]];
+				node.mins = vec_t::Min(child0.mins, child1.mins);
+				node.maxs = vec_t::Max(child0.maxs, child1.maxs);
+			}
+		}, MIN_REFIT_BATCH);
+	}
+}
+
+//-------------------------
+// eoeAABBTree::Clear
+// removes every proxy, keeps all capacity
+//-------------------------
+template<int dimensions>
+void eoeAABBTree<dimensions>::Clear() {
+	nodes.clear();
+	leafMins.clear();
+	leafMaxs.clear();
+	levelNodes.clear();
+	levelStarts.clear();
+	root = -1;
+	freeList = -1;
+	numProxies = 0;
+	levelsChanged = true;
+}
+
+//-------------------------
+// eoeAABBTree::QueryBounds
+// writes up to maxResults proxies whose bounds overlap [mins, maxs] to results
+// returns the number written
+//-------------------------
+template<int dimensions>
+int eoeAABBTree<dimensions>::QueryBounds(int * results, const int maxResults, const vec_t & mins, const vec_t & maxs) const {
+	int stack[STACK_SIZE];
+	int stackSize = 0;
+	int numResults = 0;
+	if (root >= 0)
+		stack[stackSize++] = root;
+
+	while (stackSize > 0 && numResults < maxResults) {
+		const int index = stack[--stackSize];
+		const node_t & node = nodes[index];
+		if (!BoxesOverlap(node.mins, node.maxs, mins, maxs))
+			continue;
+
+		if (node.height == 0) {
+			if (BoxesOverlap(leafMins[index], leafMaxs[index], mins, maxs))
+				results[numResults++] = index;
+		} else {
+			stack[stackSize++] = node.children[0];
+			stack[stackSize++] = node.children[1];
+		}
+	}
+	return numResults;
+}
+
+//-------------------------
+// eoeAABBTree::FindOverlappingPairs
+// writes each pair of proxies whose bounds overlap to pairs, lower handle in x,
+// by descending the tree against itself so disjoint subtrees are never compared
+// returns the total number of pairs, of which only the first maxPairs are written
+// the total is 64 bit, n nested boxes overlap in n * (n - 1) / 2 pairs
+// eg: when the result exceeds maxPairs, grow the buffer and call again
+//-------------------------
+template<int dimensions>
+int64_t eoeAABBTree<dimensions>::FindOverlappingPairs(eoeVec2i * pairs, const int maxPairs) const {
+	eoeVec2i stack[STACK_SIZE];
+	int stackSize = 0;
+	int64_t numPairs = 0;
+	if (root >= 0)
+		stack[stackSize++] = eoeVec2i(root, root);
+
+	while (stackSize > 0) {
+		const eoeVec2i pair = stack[--stackSize];
+		const node_t & a = nodes[pair.x];
+		const node_t & b = nodes[pair.y];
+
+		// a subtree against itself: each half against itself, then against the other
+		if (pair.x == pair.y) {
+			if (a.height > 0) {
+				stack[stackSize++] = eoeVec2i(a.children[0], a.children[0]);
+				stack[stackSize++] = eoeVec2i(a.children[1], a.children[1]);
+				stack[stackSize++] = eoeVec2i(a.children[0], a.children[1]);
+			}
+			continue;
+		}
+
+		if (!BoxesOverlap(a.mins, a.maxs, b.mins, b.maxs))
+			continue;
+
+		if (a.height == 0 && b.height == 0) {
+			if (BoxesOverlap(leafMins[pair.x], leafMaxs[pair.x], leafMins[pair.y], leafMaxs[pair.y])) {
+				if (numPairs < maxPairs)
+					pairs[numPairs] = pair.x < pair.y ? pair : eoeVec2i(pair.y, pair.x);
+				++numPairs;
+			}
+		} else if (a.height >= b.height) {
+			stack[stackSize++] = eoeVec2i(a.children[0], pair.y);
+			stack[stackSize++] = eoeVec2i(a.children[1], pair.y);
+		} else {
+			stack[stackSize++] = eoeVec2i(pair.x, b.children[0]);
+			stack[stackSize++] = eoeVec2i(pair.x, b.children[1]);
+		}
+	}
+	return numPairs;
+}
+
+//-------------------------
+// eoeAABBTree::Raycast
+// returns the first proxy whose bounds the segment from start to end enters, -1 if none
+// fraction is set to where it enters, start + (end - start) * fraction, 0 if start is inside
+//-------------------------
+template<int dimensions>
+int eoeAABBTree<dimensions>::Raycast(const vec_t & start, const vec_t & end, float & fraction) const {
+	const vec_t delta = end - start;
+	int stack[STACK_SIZE];
+	int stackSize = 0;
+	int hit = -1;
+	float best = 1.0f;
+	if (root >= 0)
+		stack[stackSize++] = root;
+
+	while (stackSize > 0) {
+		const int index = stack[--stackSize];
+		const node_t & node = nodes[index];
+		float enter;
+		if (!RayEntersBox(start, delta, node.mins, node.maxs, best, enter))
+			continue;
+
+		if (node.height == 0) {
+			if (RayEntersBox(start, delta, leafMins[index], leafMaxs[index], best, enter) && (hit < 0 || enter < best)) {
+				best = enter;
+				hit = index;
+			}
+		} else {
+			stack[stackSize++] = node.children[0];
+			stack[stackSize++] = node.children[1];
+		}
+	}
+
+	if (hit >= 0)
+		fraction = best;
+	return hit;
+}
+
+//-------------------------
+// eoeAABBTree::FindNearest
+// writes the maxResults proxies whose bounds are nearest point to results,
+// nearest first, with their squared distances, zero for bounds containing point
+// returns the number written, fewer than maxResults only if the tree holds fewer
+// subtrees farther than the current farthest result are never opened
+//-------------------------
+template<int dimensions>
+int eoeAABBTree<dimensions>::FindNearest(int * results, float * distancesSquared, const int maxResults, const vec_t & point) const {
+	int stack[STACK_SIZE];
+	float stackDistances[STACK_SIZE];		// each node's box distance, tested again once popped
+	int stackSize = 0;
+	int numResults = 0;
+	if (root >= 0 && maxResults > 0) {
+		stack[stackSize] = root;
+		stackDistances[stackSize++] = 0.0f;
+	}
+
+	while (stackSize > 0) {
+		--stackSize;
+		const float worst = numResults == maxResults ? distancesSquared[numResults - 1] : FLT_MAX;
+		if (stackDistances[stackSize] > worst)
+			continue;
+
+		const int index = stack[stackSize];
+		const node_t & node = nodes[index];
+		if (node.height > 0) {
+			// nearer child on top, so it tightens worst before the farther one is popped
+			int child0 = node.children[0];
+			int child1 = node.children[1];
+			float distance0 = BoxDistanceSquared(point, nodes[child0].mins, nodes[child0].maxs);
+			float distance1 = BoxDistanceSquared(point, nodes[child1].mins, nodes[child1].maxs);
+			if (distance0 < distance1) {
+				const int swapChild = child0;
+				const float swapDistance = distance0;
+				child0 = child1;
+				distance0 = distance1;
+				child1 = swapChild;
+				distance1 = swapDistance;
+			}
+			if (distance0 <= worst) {
+				stack[stackSize] = child0;
+				stackDistances[stackSize++] = distance0;
+			}
+			if (distance1 <= worst) {
+				stack[stackSize] = child1;
+				stackDistances[stackSize++] = distance1;
+			}
+			continue;
+		}
+
+		const float distanceSquared = BoxDistanceSquared(point, leafMins[index], leafMaxs[index]);
+		if (distanceSquared >= worst)
+			continue;
+
+		// insertion sort, dropping the farthest once full
+		int slot = numResults < maxResults ? numResults++ : numResults - 1;
+		for (; slot > 0 && distancesSquared[slot - 1] > distanceSquared; --slot) {
+			results[slot] = results[slot - 1];
+			distancesSquared[slot] = distancesSquared[slot - 1];
+		}
+		results[slot] = index;
+		distancesSquared[slot] = distanceSquared;
+	}
+	return numResults;
+}
+
+//-------------------------
+// eoeAABBTree::AllocateNode
+// returns a node from the free list, or a new one at the end of the pool
+// DEBUG: may reallocate the pool, invalidating node references
+//-------------------------
+template<int dimensions>
+int eoeAABBTree<dimensions>::AllocateNode() {
+	int index;
+	if (freeList < 0) {
+		index = (int)nodes.size();
+		nodes.emplace_back();
+		leafMins.emplace_back();
+		leafMaxs.emplace_back();
+	} else {
+		index = freeList;
+		freeList = nodes[index].parent;
+	}
+
+	node_t & node = nodes[index];
+	node.parent = -1;
+	node.children[0] = -1;
+	node.children[1] = -1;
+	node.height = 0;
+	return index;
+}
+
+//-------------------------
+// eoeAABBTree::FreeNode
+//-------------------------
+template<int dimensions>
+void eoeAABBTree<dimensions>::FreeNode(const int node) {
+	nodes[node].parent = freeList;
+	nodes[node].height = -1;
+	freeList = node;
+}
+
+//-------------------------
+// eoeAABBTree::InsertLeaf
+// descends toward the sibling that adds the least surface area, counting
+// the growth every ancestor inherits, then pairs the leaf with it under a new node
+//-------------------------
+template<int dimensions>
+void eoeAABBTree<dimensions>::InsertLeaf(const int leaf) {
+	if (root < 0) {
+		root = leaf;
+		nodes[leaf].parent = -1;
+		return;
+	}
+
+	const vec_t fatMins = nodes[leaf].mins;
+	const vec_t fatMaxs = nodes[leaf].maxs;
+	int sibling = root;
+	while (nodes[sibling].height > 0) {
+		const node_t & node = nodes[sibling];
+		const float area = SurfaceArea(node.mins, node.maxs);
+		const float combinedArea = UnionArea(node.mins, node.maxs, fatMins, fatMaxs);
+
+		// pairing with this node here, versus passing the growth down to a child
+		const float cost = 2.0f * combinedArea;
+		const float inheritedCost = 2.0f * (combinedArea - area);
+
+		float childCosts[2];
+		for (int i = 0; i < 2; ++i) {
+			const node_t & child = nodes[node.children[i]];
+			childCosts[i] = UnionArea(child.mins, child.maxs, fatMins, fatMaxs) + inheritedCost;
+			if (child.height > 0)
+				childCosts[i] -= SurfaceArea(child.mins, child.maxs);
+		}
+
+		if (cost < childCosts[0] && cost < childCosts[1])
+			break;
+		sibling = childCosts[0] < childCosts[1] ? node.children[0] : node.children[1];
+	}
+
+	const int oldParent = nodes[sibling].parent;
+	const int newParent = AllocateNode();
+	node_t & parent = nodes[newParent];
+	parent.parent = oldParent;
+	parent.children[0] = sibling;
+	parent.children[1] = leaf;
+	parent.mins = vec_t::Min(nodes[sibling].mins, fatMins);
+	parent.maxs = vec_t::Max(nodes[sibling].maxs, fatMaxs);
+	parent.height = nodes[sibling].height + 1;
+	nodes[sibling].parent = newParent;
+	nodes[leaf].parent = newParent;
+
+	if (oldParent < 0) {
+		root = newParent;
+	} else {
+		int * children = nodes[oldParent].children;
+		children[children[0] == sibling ? 0 : 1] = newParent;
+	}
+
+	// refit the ancestors, fixing heights first and surface area second
+	for (int index = oldParent; index >= 0; index = nodes[index].parent) {
+		index = Balance(index);
+		Rotate(index);
+		UpdateNode(index);
+	}
+}
+
+//-------------------------
+// eoeAABBTree::RemoveLeaf
+// replaces the leaf's parent with its sibling, the leaf itself stays allocated
+//-------------------------
+template<int dimensions>
+void eoeAABBTree<dimensions>::RemoveLeaf(const int leaf) {
+	if (leaf == root) {
+		root = -1;
+		return;
+	}
+
+	const int parent = nodes[leaf].parent;
+	const int grandParent = nodes[parent].parent;
+	const int sibling = nodes[parent].children[nodes[parent].children[0] == leaf ? 1 : 0];
+	nodes[sibling].parent = grandParent;
+	FreeNode(parent);
+
+	if (grandParent < 0) {
+		root = sibling;
+		return;
+	}
+
+	int * children = nodes[grandParent].children;
+	children[children[0] == parent ? 0 : 1] = sibling;
+	for (int index = grandParent; index >= 0; index = nodes[index].parent) {
+		index = Balance(index);
+		Rotate(index);
+		UpdateNode(index);
+	}
+}
+
+//-------------------------
+// eoeAABBTree::Balance
+// if one child of node is more than MAX_IMBALANCE levels taller than the other,
+// rotates it up into node's place and returns it, otherwise returns node
+// the taller grandchild stays under the rotated child, the shorter moves to node
+//-------------------------
+template<int dimensions>
+int eoeAABBTree<dimensions>::Balance(const int node) {
+	if (nodes[node].height < 2)
+		return node;
+
+	const int * children = nodes[node].children;
+	const int balance = nodes[children[1]].height - nodes[children[0]].height;
+	if (abs(balance) <= MAX_IMBALANCE)
+		return node;
+
+	const int side = balance > 0 ? 1 : 0;
+	const int up = children[side];
+	const int grandChild0 = nodes[up].children[0];
+	const int grandChild1 = nodes[up].children[1];
+	const bool keepFirst = nodes[grandChild0].height > nodes[grandChild1].height;
+	const int keep = keepFirst ? grandChild0 : grandChild1;
+	const int move = keepFirst ? grandChild1 : grandChild0;
+
+	const int parent = nodes[node].parent;
+	nodes[up].parent = parent;
+	nodes[node].parent = up;
+	if (parent < 0) {
+		root = up;
+	} else {
+		int * parentChildren = nodes[parent].children;
+		parentChildren[parentChildren[0] == node ? 0 : 1] = up;
+	}
+
+	nodes[up].children[0] = node;
+	nodes[up].children[1] = keep;
+	nodes[node].children[side] = move;
+	nodes[move].parent = node;
+
+	UpdateNode(node);
+	UpdateNode(up);
+	return up;
+}
+
+//-------------------------
+// eoeAABBTree::Rotate
+// tries swapping each child of node with a grandchild under the other child,
+// and the grandchildren across the two children, keeping whichever swap
+// shrinks the two children's surface areas the most, if any does,
+// skipping swaps that would leave siblings more than MAX_IMBALANCE apart
+// node itself stays in place, only the levels below it change
+//-------------------------
+template<int dimensions>
+void eoeAABBTree<dimensions>::Rotate(const int node) {
+	if (nodes[node].height < 2)
+		return;
+
+	const int children[2] = { nodes[node].children[0], nodes[node].children[1] };
+	const float areas[2] = { SurfaceArea(nodes[children[0]].mins, nodes[children[0]].maxs),
+							 SurfaceArea(nodes[children[1]].mins, nodes[children[1]].maxs) };
+	int bestA = -1;
+	int bestB = -1;
+	float bestGain = 0.0f;
+
+	// a child trading places with a grandchild under its sibling, only the sibling's box changes
+	for (int side = 0; side < 2; ++side) {
+		const node_t & sibling = nodes[children[1 - side]];
+		if (sibling.height == 0)
+			continue;
+
+		const node_t & child = nodes[children[side]];
+		for (int k = 0; k < 2; ++k) {
+			const node_t & kept = nodes[sibling.children[1 - k]];
+			const int siblingHeight = 1 + (child.height > kept.height ? child.height : kept.height);
+			if (abs(child.height - kept.height) > MAX_IMBALANCE || abs(nodes[sibling.children[k]].height - siblingHeight) > MAX_IMBALANCE)
+				continue;
+
+			const float gain = areas[1 - side] - UnionArea(child.mins, child.maxs, kept.mins, kept.maxs);
+			if (gain > bestGain) {
+				bestGain = gain;
+				bestA = children[side];
+				bestB = sibling.children[k];
+			}
+		}
+	}
+
+	// grandchildren trading places across the two children, both boxes change
+	if (nodes[children[0]].height > 0 && nodes[children[1]].height > 0) {
+		const int * grandChildren0 = nodes[children[0]].children;
+		const int * grandChildren1 = nodes[children[1]].children;
+		for (int k = 0; k < 2; ++k) {
+			const node_t & d = nodes[grandChildren0[0]];
+			const node_t & e = nodes[grandChildren0[1]];
+			const node_t & f = nodes[grandChildren1[k]];
+			const node_t & g = nodes[grandChildren1[1 - k]];
+			const int heightFE = f.height > e.height ? f.height : e.height;
+			const int heightDG = d.height > g.height ? d.height : g.height;
+			if (abs(f.height - e.height) > MAX_IMBALANCE || abs(d.height - g.height) > MAX_IMBALANCE || abs(heightFE - heightDG) > MAX_IMBALANCE)
+				continue;
+
+			const float gain = areas[0] + areas[1] - UnionArea(f.mins, f.maxs, e.mins, e.maxs) - UnionArea(d.mins, d.maxs, g.mins, g.maxs);
+			if (gain > bestGain) {
+				bestGain = gain;
+				bestA = grandChildren0[0];
+				bestB = grandChildren1[k];
+			}
+		}
+	}
+
+	if (bestA < 0)
+		return;
+
+	// swap the two subtrees' places, then refit the parents that changed, lowest first
+	const int parentA = nodes[bestA].parent;
+	const int parentB = nodes[bestB].parent;
+	int * childrenA = nodes[parentA].children;
+	int * childrenB = nodes[parentB].children;
+	childrenA[childrenA[0] == bestA ? 0 : 1] = bestB;
+	childrenB[childrenB[0] == bestB ? 0 : 1] = bestA;
+	nodes[bestA].parent = parentB;
+	nodes[bestB].parent = parentA;
+
+	if (parentA != node)
+		UpdateNode(parentA);
+	if (parentB != node)
+		UpdateNode(parentB);
+}
+
+//-------------------------
+// eoeAABBTree::UpdateNode
+// recomputes an internal node's bounds and height from its children
+//-------------------------
+template<int dimensions>
+void eoeAABBTree<dimensions>::UpdateNode(const int node) {
+	node_t & parent = nodes[node];
+	const node_t & child0 = nodes[parent.children[0]];
+	const node_t & child1 = nodes[parent.children[1]];
+	parent.mins = vec_t::Min(child0.mins, child1.mins);
+	parent.maxs = vec_t::Max(child0.maxs, child1.maxs);
+	parent.height = 1 + (child0.height > child1.height ? child0.height : child1.height);
+}
+
+//-------------------------
+// eoeAABBTree::BuildLevels
+// counting-sorts the internal nodes by height, every node's children
+// are lower than it, so each height can be refit in parallel once those below are done
+//-------------------------
+template<int dimensions>
+void eoeAABBTree<dimensions>::BuildLevels() {
+	const int maxHeight = GetHeight() > 0 ? GetHeight() : 0;
+	levelStarts.assign(maxHeight + 2, 0);
+	for (const node_t & node : nodes) {
+		if (node.height > 0)
+			++levelStarts[node.height + 1];
+	}
+	for (int height = 1; height < (int)levelStarts.size(); ++height)
+		levelStarts[height] += levelStarts[height - 1];
+
+	std::vector<int> cursors(levelStarts);
+	levelNodes.resize(levelStarts.back());
+	for (int index = 0; index < (int)nodes.size(); ++index) {
+		if (nodes[index].height > 0)
+			levelNodes[cursors[nodes[index].height]++] = index;
+	}
+	levelsChanged = false;
+}
+
+template class eoeAABBTree<2>;
+template class eoeAABBTree<3>;
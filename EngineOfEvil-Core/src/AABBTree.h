@@ -0,0 +1,124 @@
+#ifndef EOECORE_AABB_TREE_H
+#define EOECORE_AABB_TREE_H
+
+#include <stdint.h>
+#include <vector>
+#include "Vector.h"
+
+//--------------------------------------------
+//
+//
+//			eoeAABBTree
+//	  --dynamic bounding volume hierarchy--
+//
+//
+// a binary tree of boxes over eoeVec2 (eoeAABBTree2) or eoeVec3 (eoeAABBTree3)
+// bounds, for sparse or uneven worlds where a uniform grid wastes cells
+// each added box is a proxy, a leaf whose handle stays valid until Remove
+// leaves are fattened by margin on every side, so Move only reinserts
+// a proxy once its bounds leave the fattened box
+// inserts pick the sibling that grows the tree's surface area the least,
+// then rotations along the path back to the root keep subtree heights
+// within a level or two of each other and trade subtrees to shrink surface area
+// nodes live in one pool indexed by int, never individually allocated
+// queries write into caller buffers and never allocate
+//--------------------------------------------
+template<int dimensions>
+class eoeAABBTree {
+public:
+
+	typedef eoeVec<float, dimensions>	vec_t;
+
+	explicit					eoeAABBTree(const float margin = 0.1f);
+
+	int							Add(const vec_t & mins, const vec_t & maxs);
+	void						Remove(const int proxy);
+	bool						Move(const int proxy, const vec_t & mins, const vec_t & maxs);
+	void						Refit(const int * proxies, const vec_t * mins, const vec_t * maxs, const int count);
+	void						Clear();
+
+	int							Num() const;
+	int							GetHeight() const;
+	const vec_t &				GetMins(const int proxy) const;
+	const vec_t &				GetMaxs(const int proxy) const;
+
+	int							QueryBounds(int * results, const int maxResults, const vec_t & mins, const vec_t & maxs) const;
+	int64_t						FindOverlappingPairs(eoeVec2i * pairs, const int maxPairs) const;
+	int							Raycast(const vec_t & start, const vec_t & end, float & fraction) const;
+	int							FindNearest(int * results, float * distancesSquared, const int maxResults, const vec_t & point) const;
+
+private:
+
+	struct node_t {
+		vec_t					mins;				// fattened for leaves
+		vec_t					maxs;
+		int						parent;				// next free node while on the free list
+		int						children[2];		// -1 for a leaf
+		int						height;				// 0 for a leaf, -1 for a free node
+	};
+
+	int							AllocateNode();
+	void						FreeNode(const int node);
+	void						InsertLeaf(const int leaf);
+	void						RemoveLeaf(const int leaf);
+	int							Balance(const int node);
+	void						Rotate(const int node);
+	void						UpdateNode(const int node);
+	void						BuildLevels();
+
+private:
+
+	static constexpr int		STACK_SIZE = 256;		// deepest traversal, far beyond any balanced tree's height
+
+	float						margin;
+	int							root				= -1;
+	int							freeList			= -1;
+	int							numProxies			= 0;
+	bool						levelsChanged		= true;
+
+	std::vector<node_t>			nodes;
+	std::vector<vec_t>			leafMins;							// exact bounds, indexed by proxy
+	std::vector<vec_t>			leafMaxs;
+	std::vector<int>			levelNodes;							// internal nodes ordered by height, for Refit
+	std::vector<int>			levelStarts;						// first levelNodes index of each height
+};
+
+typedef eoeAABBTree<2>		eoeAABBTree2;
+typedef eoeAABBTree<3>		eoeAABBTree3;
+
+//-------------------------
+// eoeAABBTree::Num
+// returns the number of live proxies
+//-------------------------
+template<int dimensions>
+inline int eoeAABBTree<dimensions>::Num() const {
+	return numProxies;
+}
+
+//-------------------------
+// eoeAABBTree::GetHeight
+// returns the number of levels below the root, -1 for an empty tree
+//-------------------------
+template<int dimensions>
+inline int eoeAABBTree<dimensions>::GetHeight() const {
+	return root < 0 ? -1 : nodes[root].height;
+}
+
+//-------------------------
+// eoeAABBTree::GetMins
+// returns the proxy's exact bounds, not its fattened leaf
+//-------------------------
+template<int dimensions>
+inline const typename eoeAABBTree<dimensions>::vec_t & eoeAABBTree<dimensions>::GetMins(const int proxy) const {
+	return leafMins[proxy];
+}
+
+//-------------------------
+// eoeAABBTree::GetMaxs
+//-------------------------
+template<int dimensions>
+inline const typename eoeAABBTree<dimensions>::vec_t & eoeAABBTree<dimensions>::GetMaxs(const int proxy) const {
+	return leafMaxs[proxy];
+}
+
+#endif /* EOECORE_AABB_TREE_H */
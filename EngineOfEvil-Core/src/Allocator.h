@@ -0,0 +1,86 @@
+#ifndef EOECORE_ALLOCATOR_H
+#define EOECORE_ALLOCATOR_H
+
+#include <new>
+#include <stddef.h>
+#include <vector>
+
+// aligned heap storage for bulk math data
+// SIMD_ALIGNMENT covers one 256-bit register, so every block handed out here
+// can be read with aligned loads from its first element, and no 16-byte
+// element (eoeVec4, eoeQuat, eoeVec3A) or 64-byte eoeMat4 straddles a register boundary
+
+static constexpr size_t SIMD_ALIGNMENT = 32;
+
+//--------------------------
+// eoeAlignedAlloc
+// returns uninitialized memory for size bytes starting on an alignment boundary,
+// alignment must be a power of two, release it with eoeAlignedFree and the same alignment
+// DEBUG: throws std::bad_alloc like new on failure
+//--------------------------
+inline void * eoeAlignedAlloc(const size_t size, const size_t alignment = SIMD_ALIGNMENT) {
+	return ::operator new(size, std::align_val_t(alignment));
+}
+
+//--------------------------
+// eoeAlignedFree
+// memory may be nullptr
+//--------------------------
+inline void eoeAlignedFree(void * memory, const size_t alignment = SIMD_ALIGNMENT) {
+	::operator delete(memory, std::align_val_t(alignment));
+}
+
+//--------------------------------------------
+//
+//
+//			eoeAlignedAllocator
+//	 --std allocator for SIMD-aligned arrays--
+//
+//
+// aligns each allocation to the larger of alignment and the element's own alignas
+// eg: eoeAlignedVector<eoeVec4> can be handed to the batch kernels as-is
+//--------------------------------------------
+template<typename type, size_t alignment = SIMD_ALIGNMENT>
+class eoeAlignedAllocator {
+public:
+
+	typedef type			value_type;
+
+	template<typename other_t>
+	struct rebind { typedef eoeAlignedAllocator<other_t, alignment> other; };
+
+	static constexpr size_t	ALIGNMENT = alignment > alignof(type) ? alignment : alignof(type);
+
+							eoeAlignedAllocator() = default;
+	template<typename other_t>
+	constexpr				eoeAlignedAllocator(const eoeAlignedAllocator<other_t, alignment> &) {}
+
+	type *					allocate(const size_t num);
+	void					deallocate(type * memory, const size_t num);
+
+	template<typename other_t>
+	constexpr bool			operator==(const eoeAlignedAllocator<other_t, alignment> &) const { return true; }
+	template<typename other_t>
+	constexpr bool			operator!=(const eoeAlignedAllocator<other_t, alignment> &) const { return false; }
+};
+
+template<typename type, size_t alignment = SIMD_ALIGNMENT>
+using eoeAlignedVector = std::vector<type, eoeAlignedAllocator<type, alignment>>;
+
+//--------------------------
+// eoeAlignedAllocator::allocate
+//--------------------------
+template<typename type, size_t alignment>
+inline type * eoeAlignedAllocator<type, alignment>::allocate(const size_t num) {
+	return static_cast<type *>(eoeAlignedAlloc(num * sizeof(type), ALIGNMENT));
+}
+
+//--------------------------
+// eoeAlignedAllocator::deallocate
+//--------------------------
+template<typename type, size_t alignment>
+inline void eoeAlignedAllocator<type, alignment>::deallocate(type * memory, const size_t) {
+	eoeAlignedFree(memory, ALIGNMENT);
+}
+
+#endif /* EOECORE_ALLOCATOR_H */
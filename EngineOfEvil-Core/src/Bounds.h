@@ -0,0 +1,203 @@
+#ifndef EOECORE_BOUNDS_H
+#define EOECORE_BOUNDS_H
+
+#include "Plane.h"
+
+// bounding volumes for visibility and overlap tests
+// the IsOutside plane tests are the exact arithmetic the
+// Cull_ kernels vectorize, so single and batch culls always agree
+
+//--------------------------------------------
+//
+//
+//				eoeAABB
+//	   --axis-aligned box from mins to maxs--
+//
+//
+//--------------------------------------------
+class eoeAABB {
+public:
+
+	eoeVec3				mins;
+	eoeVec3				maxs;
+
+						eoeAABB() = default;
+	explicit constexpr	eoeAABB(const eoeVec3 & mins, const eoeVec3 & maxs);
+
+	void				Clear();
+	bool				IsCleared() const;
+	void				AddPoint(const eoeVec3 & point);
+	void				AddBounds(const eoeAABB & bounds);
+
+	constexpr eoeVec3	Center() const;
+	constexpr eoeVec3	Extents() const;
+	bool				ContainsPoint(const eoeVec3 & point) const;
+	bool				Intersects(const eoeAABB & bounds) const;
+	bool				IsOutside(const eoePlane & plane) const;
+
+	static eoeAABB		FromCenterExtents(const eoeVec3 & center, const eoeVec3 & extents);
+};
+
+//--------------------------------------------
+//
+//
+//				eoeSphere
+//	   --all points within radius of origin--
+//
+//
+//--------------------------------------------
+class eoeSphere {
+public:
+
+	eoeVec3				origin;
+	float				radius = 0.0f;
+
+						eoeSphere() = default;
+	explicit constexpr	eoeSphere(const eoeVec3 & origin, const float radius);
+
+	bool				ContainsPoint(const eoeVec3 & point) const;
+	bool				Intersects(const eoeSphere & sphere) const;
+	bool				IsOutside(const eoePlane & plane) const;
+};
+
+//-------------------------
+// eoeAABB::eoeAABB
+//-------------------------
+inline constexpr eoeAABB::eoeAABB(const eoeVec3 & mins, const eoeVec3 & maxs)
+	: mins(mins),
+	  maxs(maxs) {
+}
+
+//-------------------------
+// eoeAABB::Clear
+// inverts the box so the first AddPoint or AddBounds sets it exactly
+//-------------------------
+inline void eoeAABB::Clear() {
+	mins.Set(FLT_MAX, FLT_MAX, FLT_MAX);
+	maxs.Set(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+}
+
+//-------------------------
+// eoeAABB::IsCleared
+// returns true if nothing has been added since Clear
+//-------------------------
+inline bool eoeAABB::IsCleared() const {
+	return mins.x > maxs.x;
+}
+
+//-------------------------
+// eoeAABB::AddPoint
+// grows the box to contain point
+//-------------------------
+inline void eoeAABB::AddPoint(const eoeVec3 & point) {
+	for (int i = 0; i < 3; ++i) {
+		if (point[i] < mins[i])
+			mins[i] = point[i];
+		if (point[i] > maxs[i])
+			maxs[i] = point[i];
+	}
+}
+
+//-------------------------
+// eoeAABB::AddBounds
+// grows the box to contain bounds
+//-------------------------
+inline void eoeAABB::AddBounds(const eoeAABB & bounds) {
+	for (int i = 0; i < 3; ++i) {
+		if (bounds.mins[i] < mins[i])
+			mins[i] = bounds.mins[i];
+		if (bounds.maxs[i] > maxs[i])
+			maxs[i] = bounds.maxs[i];
+	}
+}
+
+//-------------------------
+// eoeAABB::Center
+//-------------------------
+inline constexpr eoeVec3 eoeAABB::Center() const {
+	return eoeVec3((mins.x + maxs.x) * 0.5f, (mins.y + maxs.y) * 0.5f, (mins.z + maxs.z) * 0.5f);
+}
+
+//-------------------------
+// eoeAABB::Extents
+// returns the half-size along each axis
+//-------------------------
+inline constexpr eoeVec3 eoeAABB::Extents() const {
+	return eoeVec3((maxs.x - mins.x) * 0.5f, (maxs.y - mins.y) * 0.5f, (maxs.z - mins.z) * 0.5f);
+}
+
+//-------------------------
+// eoeAABB::ContainsPoint
+// points on the surface are contained
+//-------------------------
+inline bool eoeAABB::ContainsPoint(const eoeVec3 & point) const {
+	return point.x >= mins.x && point.x <= maxs.x &&
+		   point.y >= mins.y && point.y <= maxs.y &&
+		   point.z >= mins.z && point.z <= maxs.z;
+}
+
+//-------------------------
+// eoeAABB::Intersects
+// touching boxes intersect
+//-------------------------
+inline bool eoeAABB::Intersects(const eoeAABB & bounds) const {
+	return mins.x <= bounds.maxs.x && maxs.x >= bounds.mins.x &&
+		   mins.y <= bounds.maxs.y && maxs.y >= bounds.mins.y &&
+		   mins.z <= bounds.maxs.z && maxs.z >= bounds.mins.z;
+}
+
+//-------------------------
+// eoeAABB::IsOutside
+// returns true if the whole box is on the negative side of plane
+// by projecting the box's extents onto the plane normal
+//-------------------------
+inline bool eoeAABB::IsOutside(const eoePlane & plane) const {
+	const eoeVec3 center = Center();
+	const eoeVec3 extents = Extents();
+	const float distance = plane.normal.x * center.x + plane.normal.y * center.y + plane.normal.z * center.z + plane.d;
+	const float radius = fabsf(plane.normal.x) * extents.x + fabsf(plane.normal.y) * extents.y + fabsf(plane.normal.z) * extents.z;
+	return distance + radius < 0.0f;
+}
+
+//-------------------------
+// eoeAABB::FromCenterExtents
+//-------------------------
+inline eoeAABB eoeAABB::FromCenterExtents(const eoeVec3 & center, const eoeVec3 & extents) {
+	return eoeAABB(center - extents, center + extents);
+}
+
+//-------------------------
+// eoeSphere::eoeSphere
+//-------------------------
+inline constexpr eoeSphere::eoeSphere(const eoeVec3 & origin, const float radius)
+	: origin(origin),
+	  radius(radius) {
+}
+
+//-------------------------
+// eoeSphere::ContainsPoint
+// points on the surface are contained
+//-------------------------
+inline bool eoeSphere::ContainsPoint(const eoeVec3 & point) const {
+	return (point - origin).LengthSquared() <= radius * radius;
+}
+
+//-------------------------
+// eoeSphere::Intersects
+// touching spheres intersect
+//-------------------------
+inline bool eoeSphere::Intersects(const eoeSphere & sphere) const {
+	const float radii = radius + sphere.radius;
+	return (sphere.origin - origin).LengthSquared() <= radii * radii;
+}
+
+//-------------------------
+// eoeSphere::IsOutside
+// returns true if the whole sphere is on the negative side of plane
+// DEBUG: plane must be normalized for radius to mean the same thing as distance
+//-------------------------
+inline bool eoeSphere::IsOutside(const eoePlane & plane) const {
+	return plane.normal.x * origin.x + plane.normal.y * origin.y + plane.normal.z * origin.z + plane.d < -radius;
+}
+
+#endif /* EOECORE_BOUNDS_H */
@@ -12,6 +12,10 @@ bool InitEngineOfEvil() {
 	if (!EVIL_ERROR_LOG.Init())
 		return false;
 
+	eoeSIMD::Init();						// falls back to generic code, never fails
+
+	EVIL_THREADS.Init(SDL_GetCPUCount() - 1);	// one worker per extra core, may be none
+
 	EVIL_INPUT.Init();						// succeeds or crashes, but still logs the error
 
 	return true;
@@ -22,6 +26,7 @@ bool InitEngineOfEvil() {
 // TODO: shutdown/destroy any systems that need shutting down in-order
 //---------------------------
 void ShutdownEngineOfEvil() {
+	EVIL_THREADS.Shutdown();
 //	EVIL_INPUT;
 //	EVIL_ERROR_LOG;
 }
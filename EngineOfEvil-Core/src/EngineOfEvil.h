@@ -2,6 +2,8 @@
 #define EOECORE_ENGINE_STARTUP_H
 
 #include "Input.h"
+#include "SIMD.h"
+#include "ThreadPool.h"
 
 //---------------------------
 // InitEngineOfEvil (global)
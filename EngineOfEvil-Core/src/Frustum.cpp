@@ -0,0 +1,84 @@
+#include "Frustum.h"
+#include "SIMD.h"
+
+//-------------------------
+// eoeFrustum::SetFromMatrix
+// each clip-space bound (eg: -w <= x) is a row combination of the matrix,
+// (row3 + row0) * v >= 0, so the planes come straight from its rows
+// and are normalized to make sphere radii and distances comparable
+//-------------------------
+void eoeFrustum::SetFromMatrix(const eoeMat4 & viewProjection) {
+	const eoeVec4 & row0 = viewProjection.matrix[0];
+	const eoeVec4 & row1 = viewProjection.matrix[1];
+	const eoeVec4 & row2 = viewProjection.matrix[2];
+	const eoeVec4 & row3 = viewProjection.matrix[3];
+
+	planes[PLANE_LEFT]		= eoePlane(row3 + row0);
+	planes[PLANE_RIGHT]		= eoePlane(row3 - row0);
+	planes[PLANE_BOTTOM]	= eoePlane(row3 + row1);
+	planes[PLANE_TOP]		= eoePlane(row3 - row1);
+	planes[PLANE_NEAR]		= eoePlane(row3 + row2);
+	planes[PLANE_FAR]		= eoePlane(row3 - row2);
+
+	for (int i = 0; i < NUM_PLANES; ++i)
+		planes[i].Normalize();
+}
+
+//-------------------------
+// eoeFrustum::ContainsPoint
+// points on a plane are contained
+//-------------------------
+bool eoeFrustum::ContainsPoint(const eoeVec3 & point) const {
+	for (int i = 0; i < NUM_PLANES; ++i) {
+		if (planes[i].Distance(point) < 0.0f)
+			return false;
+	}
+	return true;
+}
+
+//-------------------------
+// eoeFrustum::Intersects
+// conservative: a box near a frustum corner can be outside
+// every plane's volume together yet behind none of them alone
+//-------------------------
+bool eoeFrustum::Intersects(const eoeAABB & bounds) const {
+	for (int i = 0; i < NUM_PLANES; ++i) {
+		if (bounds.IsOutside(planes[i]))
+			return false;
+	}
+	return true;
+}
+
+//-------------------------
+// eoeFrustum::Intersects
+// conservative in the same way as the eoeAABB test
+//-------------------------
+bool eoeFrustum::Intersects(const eoeSphere & sphere) const {
+	for (int i = 0; i < NUM_PLANES; ++i) {
+		if (sphere.IsOutside(planes[i]))
+			return false;
+	}
+	return true;
+}
+
+//-------------------------
+// eoeFrustum::CullAABBs
+// writes the index of every bounds[i] that Intersects the frustum to visibleIndexes,
+// in increasing order, and returns how many were written
+// DEBUG: visibleIndexes must have room for count entries, SIMD processors
+// write candidate slots past the returned count
+//-------------------------
+int eoeFrustum::CullAABBs(int * visibleIndexes, const eoeAABB * bounds, const int count) const {
+	return EVIL_SIMD->Cull_AABBs(visibleIndexes, planes, NUM_PLANES, bounds, count);
+}
+
+//-------------------------
+// eoeFrustum::CullSpheres
+// writes the index of every spheres[i] that Intersects the frustum to visibleIndexes,
+// in increasing order, and returns how many were written
+// DEBUG: visibleIndexes must have room for count entries, SIMD processors
+// write candidate slots past the returned count
+//-------------------------
+int eoeFrustum::CullSpheres(int * visibleIndexes, const eoeSphere * spheres, const int count) const {
+	return EVIL_SIMD->Cull_Spheres(visibleIndexes, planes, NUM_PLANES, spheres, count);
+}
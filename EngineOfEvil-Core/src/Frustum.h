@@ -0,0 +1,74 @@
+#ifndef EOECORE_FRUSTUM_H
+#define EOECORE_FRUSTUM_H
+
+#include "Bounds.h"
+#include "Matrix.h"
+
+//--------------------------------------------
+//
+//
+//				eoeFrustum
+//	   --six inward-facing planes of a view volume--
+//
+//
+// extracted from a view-projection matrix in opengl clip space
+// (-w <= x, y, z <= w), the convention of eoeMat4::GetPerspective
+// and eoeMat4::GetOrthographic, so planes are in the space
+// the matrix transforms from (world space for projection * view)
+//--------------------------------------------
+class eoeFrustum {
+public:
+
+	enum {
+		PLANE_LEFT,
+		PLANE_RIGHT,
+		PLANE_BOTTOM,
+		PLANE_TOP,
+		PLANE_NEAR,
+		PLANE_FAR,
+		NUM_PLANES
+	};
+
+							eoeFrustum() = default;
+	explicit				eoeFrustum(const eoeMat4 & viewProjection);
+
+	void					SetFromMatrix(const eoeMat4 & viewProjection);
+	const eoePlane &		GetPlane(const int plane) const;
+	const eoePlane *		GetPlanes() const;
+
+	bool					ContainsPoint(const eoeVec3 & point) const;
+	bool					Intersects(const eoeAABB & bounds) const;
+	bool					Intersects(const eoeSphere & sphere) const;
+
+	int						CullAABBs(int * visibleIndexes, const eoeAABB * bounds, const int count) const;
+	int						CullSpheres(int * visibleIndexes, const eoeSphere * spheres, const int count) const;
+
+private:
+
+	eoePlane				planes[NUM_PLANES];
+};
+
+//-------------------------
+// eoeFrustum::eoeFrustum
+//-------------------------
+inline eoeFrustum::eoeFrustum(const eoeMat4 & viewProjection) {
+	SetFromMatrix(viewProjection);
+}
+
+//-------------------------
+// eoeFrustum::GetPlane
+// plane is one of the PLANE_ enums, normals point into the frustum
+//-------------------------
+inline const eoePlane & eoeFrustum::GetPlane(const int plane) const {
+	return planes[plane];
+}
+
+//-------------------------
+// eoeFrustum::GetPlanes
+// returns all NUM_PLANES planes, in PLANE_ order
+//-------------------------
+inline const eoePlane * eoeFrustum::GetPlanes() const {
+	return planes;
+}
+
+#endif /* EOECORE_FRUSTUM_H */
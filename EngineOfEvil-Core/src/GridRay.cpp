@@ -0,0 +1,48 @@
+#include "GridRay.h"
+#include "ThreadPool.h"
+
+//-------------------------
+// eoeGridRay::GetCells
+// writes up to maxCells of the cells from start to end, in order, to cells
+// returns the number written, without allocating
+//-------------------------
+int eoeGridRay::GetCells(eoeVec2i * cells, const int maxCells, const eoeVec2 & start, const eoeVec2 & end, const float cellSize) {
+	if (maxCells <= 0)
+		return 0;
+
+	eoeGridRay ray(start, end, cellSize);
+	int numCells = 0;
+	do {
+		cells[numCells++] = ray.cell;
+	} while (numCells < maxCells && ray.Next());
+	return numCells;
+}
+
+//-------------------------
+// eoeGridRay::LineOfSight
+// sets visible[i] to whether from[i] can see to[i] over a row-major grid
+// width tiles wide, where a nonzero opaque[y * width + x] blocks sight
+// batches are split across EVIL_THREADS
+// DEBUG: from and to must be tiles on the grid, every tile between them is too
+//-------------------------
+void eoeGridRay::LineOfSight(bool * visible, const eoeVec2i * from, const eoeVec2i * to, const int count, const uint8_t * opaque, const int width) {
+	EVIL_THREADS.ParallelFor(count, [=](int begin, int end) {
+		for (int i = begin; i < end; ++i) {
+			visible[i] = LineOfSight(from[i], to[i], [=](const eoeVec2i & tile) {
+				return opaque[tile.y * width + tile.x] != 0;
+			});
+		}
+	}, MIN_LINE_OF_SIGHT_BATCH);
+}
+
+//-------------------------
+// eoeGridRay::PickTile
+// returns the tile under isoPoint, an isometric point such as the cursor
+// plus the camera offset, on a flat map of tileSize orthographic tiles
+//-------------------------
+eoeVec2i eoeGridRay::PickTile(const eoeVec2 & isoPoint, const float tileSize) {
+	eoeVec2 point(isoPoint);
+	eoeMath::IsometricToOrthographic(point.x, point.y);
+	const float invTileSize = 1.0f / tileSize;
+	return eoeVec2i((int)floorf(point.x * invTileSize), (int)floorf(point.y * invTileSize));
+}
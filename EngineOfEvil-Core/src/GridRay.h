@@ -0,0 +1,254 @@
+#ifndef EOECORE_GRID_RAY_H
+#define EOECORE_GRID_RAY_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "Math.h"
+#include "Vector.h"
+
+//--------------------------------------------
+//
+//
+//				eoeGridRay
+//	  --cells crossed by a segment, in order--
+//
+//
+// Amanatides-Woo traversal of a uniform grid of square cells (tiles)
+// in orthographic units: each step compares the distances to the next
+// vertical and horizontal cell edges and crosses the nearer one, so only
+// the cells the segment actually passes through are visited, start to end,
+// with no candidate rectangle and no per-cell intersection tests
+// the walk always ends exactly on the cell holding end
+// Walk and LineOfSight stop at the first cell their callback rejects
+// PickTile converts isometric (screen + camera) points through eoeMath,
+// and with tile heights walks the cursor's footprint from the tallest
+// possible tile down to the ground
+// LineOfSight steps tile center to tile center in exact integer arithmetic,
+// and where the line passes exactly through a tile corner it tests both
+// tiles beside the corner and is blocked by either, as eoePathfinder never
+// cuts a blocked corner, so a tile sees another exactly when it is seen back
+// DEBUG: Walk and GetCells pass a cell corner through only one of the two
+// cells beside it (the vertical neighbor)
+//--------------------------------------------
+class eoeGridRay {
+public:
+
+	explicit					eoeGridRay(const eoeVec2 & start, const eoeVec2 & end, const float cellSize = 1.0f);
+
+	bool						Next();
+	const eoeVec2i &			GetCell() const;
+	float						GetEntryFraction() const;
+	float						GetExitFraction() const;
+	int							NumRemaining() const;
+
+	template<typename visit_t>
+	static bool					Walk(const eoeVec2 & start, const eoeVec2 & end, const visit_t & visit, const float cellSize = 1.0f);
+	static int					GetCells(eoeVec2i * cells, const int maxCells, const eoeVec2 & start, const eoeVec2 & end, const float cellSize = 1.0f);
+
+	template<typename opaque_t>
+	static bool					LineOfSight(const eoeVec2i & from, const eoeVec2i & to, const opaque_t & isOpaque);
+	static void					LineOfSight(bool * visible, const eoeVec2i * from, const eoeVec2i * to, const int count, const uint8_t * opaque, const int width);
+
+	static eoeVec2i				PickTile(const eoeVec2 & isoPoint, const float tileSize);
+	template<typename height_t>
+	static bool					PickTile(eoeVec2i & tile, const eoeVec2 & isoPoint, const float tileSize, const float maxHeight, const height_t & topHeight);
+
+private:
+
+	static constexpr int		MIN_LINE_OF_SIGHT_BATCH = 64;		// checks per job, each is only a few dozen cells
+
+	eoeVec2i					cell;
+	eoeVec2i					step;								// -1, 0, or 1 cell per crossing
+	eoeVec2i					remaining;							// crossings left on each axis
+	eoeVec2						tMax;								// fraction at the next edge on each axis
+	eoeVec2						tDelta;								// fraction between edges on each axis
+	float						entryFraction		= 0.0f;
+};
+
+//-------------------------
+// eoeGridRay::eoeGridRay
+// starts on the cell holding start, cells are cellSize on a side
+// with cell (0, 0) spanning [0, cellSize) on both axes
+//-------------------------
+inline eoeGridRay::eoeGridRay(const eoeVec2 & start, const eoeVec2 & end, const float cellSize) {
+	const float invCellSize = 1.0f / cellSize;
+	const eoeVec2i endCell((int)floorf(end.x * invCellSize), (int)floorf(end.y * invCellSize));
+	cell.Set((int)floorf(start.x * invCellSize), (int)floorf(start.y * invCellSize));
+
+	for (int axis = 0; axis < 2; ++axis) {
+		const float delta = end[axis] - start[axis];
+		if (cell[axis] == endCell[axis] || delta == 0.0f) {
+			step[axis] = 0;
+			remaining[axis] = 0;
+			tMax[axis] = FLT_MAX;
+			tDelta[axis] = FLT_MAX;
+			continue;
+		}
+
+		const float invDelta = 1.0f / delta;
+		step[axis] = delta > 0.0f ? 1 : -1;
+		remaining[axis] = abs(endCell[axis] - cell[axis]);
+		tDelta[axis] = cellSize * fabsf(invDelta);
+		tMax[axis] = ((float)(cell[axis] + (step[axis] > 0)) * cellSize - start[axis]) * invDelta;
+	}
+}
+
+//-------------------------
+// eoeGridRay::Next
+// crosses into the next cell along the segment
+// returns false, without moving, once the cell holding end was reached
+//-------------------------
+inline bool eoeGridRay::Next() {
+	if (remaining.x > 0 && (remaining.y == 0 || tMax.x < tMax.y)) {
+		entryFraction = tMax.x;
+		tMax.x += tDelta.x;
+		cell.x += step.x;
+		--remaining.x;
+		return true;
+	}
+
+	if (remaining.y > 0) {
+		entryFraction = tMax.y;
+		tMax.y += tDelta.y;
+		cell.y += step.y;
+		--remaining.y;
+		return true;
+	}
+	return false;
+}
+
+//-------------------------
+// eoeGridRay::GetCell
+//-------------------------
+inline const eoeVec2i & eoeGridRay::GetCell() const {
+	return cell;
+}
+
+//-------------------------
+// eoeGridRay::GetEntryFraction
+// returns how far along the segment, in [0, 1], it entered the current cell
+//-------------------------
+inline float eoeGridRay::GetEntryFraction() const {
+	return entryFraction;
+}
+
+//-------------------------
+// eoeGridRay::GetExitFraction
+// returns how far along the segment, in [0, 1], it leaves the current cell
+//-------------------------
+inline float eoeGridRay::GetExitFraction() const {
+	if (remaining.x == 0 && remaining.y == 0)
+		return 1.0f;
+
+	const float exitX = remaining.x > 0 ? tMax.x : FLT_MAX;
+	const float exitY = remaining.y > 0 ? tMax.y : FLT_MAX;
+	const float exit = exitX < exitY ? exitX : exitY;
+	return exit < 1.0f ? exit : 1.0f;
+}
+
+//-------------------------
+// eoeGridRay::NumRemaining
+// returns the number of cells left after the current one
+//-------------------------
+inline int eoeGridRay::NumRemaining() const {
+	return remaining.x + remaining.y;
+}
+
+//-------------------------
+// eoeGridRay::Walk
+// calls visit(const eoeVec2i & cell, float entryFraction) for each cell
+// from start to end, stopping early if visit returns false
+// returns true if every cell was visited
+//-------------------------
+template<typename visit_t>
+inline bool eoeGridRay::Walk(const eoeVec2 & start, const eoeVec2 & end, const visit_t & visit, const float cellSize) {
+	eoeGridRay ray(start, end, cellSize);
+	do {
+		if (!visit(ray.cell, ray.entryFraction))
+			return false;
+	} while (ray.Next());
+	return true;
+}
+
+//-------------------------
+// eoeGridRay::LineOfSight
+// returns true if no tile strictly between from and to is opaque,
+// tested center to center, and stops at the first one that is
+// isOpaque(const eoeVec2i & tile) is never asked about from or to themselves
+// the line crosses its ith vertical edge at (2i + 1) / (2 * |dx|) and its jth
+// horizontal edge at (2j + 1) / (2 * |dy|) of the way, so cross multiplying
+// orders the crossings exactly, and equal fractions are a corner
+//-------------------------
+template<typename opaque_t>
+inline bool eoeGridRay::LineOfSight(const eoeVec2i & from, const eoeVec2i & to, const opaque_t & isOpaque) {
+	const int64_t dx = abs(to.x - from.x);
+	const int64_t dy = abs(to.y - from.y);
+	const eoeVec2i step((to.x > from.x) - (to.x < from.x), (to.y > from.y) - (to.y < from.y));
+	eoeVec2i tile(from);
+	int64_t crossedX = 0;
+	int64_t crossedY = 0;
+
+	while (crossedX < dx || crossedY < dy) {
+		int64_t order;
+		if (crossedX == dx)
+			order = 1;
+		else if (crossedY == dy)
+			order = -1;
+		else
+			order = (2 * crossedX + 1) * dy - (2 * crossedY + 1) * dx;
+
+		if (order == 0) {
+			if (isOpaque(eoeVec2i(tile.x + step.x, tile.y)) || isOpaque(eoeVec2i(tile.x, tile.y + step.y)))
+				return false;
+			tile += step;
+			++crossedX;
+			++crossedY;
+		} else if (order < 0) {
+			tile.x += step.x;
+			++crossedX;
+		} else {
+			tile.y += step.y;
+			++crossedY;
+		}
+
+		if (tile == to)
+			break;
+
+		if (isOpaque(tile))
+			return false;
+	}
+	return true;
+}
+
+//-------------------------
+// eoeGridRay::PickTile
+// sets tile to the frontmost tile drawn under isoPoint, an isometric point
+// such as the cursor plus the camera offset, where topHeight(const eoeVec2i & tile)
+// returns how far the tile's top is raised, in isometric units, or a negative
+// value if there is no tile there
+// maxHeight bounds every tile's top, and the walk runs from the tile that
+// a maxHeight tall tile would cover under isoPoint back to the ground tile
+// returns false if every tile along the way is missing
+// eg: PickTile(tile, eoeVec2(mouseX + cameraX, mouseY + cameraY), 32.0f, 64.0f, heights)
+//-------------------------
+template<typename height_t>
+inline bool eoeGridRay::PickTile(eoeVec2i & tile, const eoeVec2 & isoPoint, const float tileSize, const float maxHeight, const height_t & topHeight) {
+	eoeVec2 top(isoPoint.x, isoPoint.y + maxHeight);
+	eoeVec2 ground(isoPoint);
+	eoeMath::IsometricToOrthographic(top.x, top.y);
+	eoeMath::IsometricToOrthographic(ground.x, ground.y);
+
+	eoeGridRay ray(top, ground, tileSize);
+	do {
+		// lowest the line of sight gets over this tile, entering higher than it leaves
+		const float height = topHeight(ray.cell);
+		if (height >= 0.0f && height >= maxHeight * (1.0f - ray.GetExitFraction())) {
+			tile = ray.cell;
+			return true;
+		}
+	} while (ray.Next());
+	return false;
+}
+
+#endif /* EOECORE_GRID_RAY_H */
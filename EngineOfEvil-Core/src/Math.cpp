@@ -0,0 +1,161 @@
+#include "SIMD.h"
+
+//--------------------
+// eoeMath::IsometricToOrthographic
+// converts count x[i], y[i] pairs in place
+//--------------------
+void eoeMath::IsometricToOrthographic(float * x, float * y, const int count) {
+	EVIL_SIMD->Float_IsometricToOrthographic(x, y, count);
+}
+
+//--------------------
+// eoeMath::IsometricToOrthographic
+// converts count x[i], y[i] pairs in place
+//--------------------
+void eoeMath::IsometricToOrthographic(int * x, int * y, const int count) {
+	EVIL_SIMD->Int_IsometricToOrthographic(x, y, count);
+}
+
+//--------------------
+// eoeMath::OrthographicToIsometric
+// converts count x[i], y[i] pairs in place
+//--------------------
+void eoeMath::OrthographicToIsometric(float * x, float * y, const int count) {
+	EVIL_SIMD->Float_OrthographicToIsometric(x, y, count);
+}
+
+//--------------------
+// eoeMath::OrthographicToIsometric
+// converts count x[i], y[i] pairs in place
+//--------------------
+void eoeMath::OrthographicToIsometric(int * x, int * y, const int count) {
+	EVIL_SIMD->Int_OrthographicToIsometric(x, y, count);
+}
+
+//--------------------
+// eoeMath::SinCos
+// sin[i], cos[i] = SinCos(radians[i])
+//--------------------
+void eoeMath::SinCos(float * sin, float * cos, const float * radians, const int count) {
+	for (int i = 0; i < count; ++i)
+		SinCos(radians[i], sin[i], cos[i]);
+}
+
+//--------------------
+// eoeMath::SinCosFast
+// sin[i], cos[i] = SinCosFast(radians[i])
+//--------------------
+void eoeMath::SinCosFast(float * sin, float * cos, const float * radians, const int count) {
+	EVIL_SIMD->Float_SinCosFast(sin, cos, radians, count);
+}
+
+//--------------------
+// eoeMath::RSqrt
+// dst[i] = RSqrt(src[i])
+// dst may alias src
+//--------------------
+void eoeMath::RSqrt(float * dst, const float * src, const int count) {
+	for (int i = 0; i < count; ++i)
+		dst[i] = RSqrt(src[i]);
+}
+
+//--------------------
+// eoeMath::RSqrtFast
+// dst[i] = RSqrtFast(src[i])
+// dst may alias src
+//--------------------
+void eoeMath::RSqrtFast(float * dst, const float * src, const int count) {
+	EVIL_SIMD->Float_RSqrtFast(dst, src, count);
+}
+
+//--------------------
+// eoeMath::ATan2
+// dst[i] = ATan2(y[i], x[i])
+// dst may alias y or x
+//--------------------
+void eoeMath::ATan2(float * dst, const float * y, const float * x, const int count) {
+	for (int i = 0; i < count; ++i)
+		dst[i] = ATan2(y[i], x[i]);
+}
+
+//--------------------
+// eoeMath::ATan2Fast
+// dst[i] = ATan2Fast(y[i], x[i])
+// dst may alias y or x
+//--------------------
+void eoeMath::ATan2Fast(float * dst, const float * y, const float * x, const int count) {
+	EVIL_SIMD->Float_ATan2Fast(dst, y, x, count);
+}
+
+//--------------------
+// eoeMath::Lerp
+// dst[i] = Lerp(from[i], to[i], fractions[i])
+// dst may alias from or to
+//--------------------
+void eoeMath::Lerp(float * dst, const float * from, const float * to, const float * fractions, const int count) {
+	EVIL_SIMD->Float_Lerp(dst, from, to, fractions, 1, count);
+}
+
+//--------------------
+// eoeMath::Lerp
+// componentwise Lerp of each from[i], to[i] pair by fractions[i]
+// dst may alias from or to
+//--------------------
+void eoeMath::Lerp(eoeVec2 * dst, const eoeVec2 * from, const eoeVec2 * to, const float * fractions, const int count) {
+	EVIL_SIMD->Float_Lerp(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(from), reinterpret_cast<const float *>(to), fractions, 2, count);
+}
+
+//--------------------
+// eoeMath::Lerp
+// componentwise Lerp of each from[i], to[i] pair by fractions[i]
+// dst may alias from or to
+//--------------------
+void eoeMath::Lerp(eoeVec3 * dst, const eoeVec3 * from, const eoeVec3 * to, const float * fractions, const int count) {
+	EVIL_SIMD->Float_Lerp(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(from), reinterpret_cast<const float *>(to), fractions, 3, count);
+}
+
+//--------------------
+// eoeMath::Lerp
+// componentwise Lerp of each from[i], to[i] pair by fractions[i]
+// dst may alias from or to
+//--------------------
+void eoeMath::Lerp(eoeVec4 * dst, const eoeVec4 * from, const eoeVec4 * to, const float * fractions, const int count) {
+	EVIL_SIMD->Float_Lerp(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(from), reinterpret_cast<const float *>(to), fractions, 4, count);
+}
+
+//--------------------
+// eoeMath::Ease
+// dst[i] = Ease(type, fractions[i])
+// dst may alias fractions, eg: ease a span of tween progress values in place before a Lerp
+//--------------------
+void eoeMath::Ease(float * dst, const float * fractions, const int count, const eoeEase_t type) {
+	EVIL_SIMD->Float_Ease(dst, fractions, count, type);
+}
+
+//--------------------
+// eoeMath::Nlerp
+// dst[i] = eoeQuat::Nlerp(from[i], to[i], fractions[i])
+// dst may alias from or to
+//--------------------
+void eoeMath::Nlerp(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) {
+	EVIL_SIMD->Quat_Nlerp(dst, from, to, fractions, count);
+}
+
+//--------------------
+// eoeMath::Slerp
+// dst[i] = eoeQuat::Slerp(from[i], to[i], fractions[i])
+// dst may alias from or to
+//--------------------
+void eoeMath::Slerp(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeQuat::Slerp(from[i], to[i], fractions[i]);
+}
+
+//--------------------
+// eoeMath::SlerpFast
+// dst[i] = eoeQuat::SlerpFast(from[i], to[i], fractions[i])
+// dst may alias from or to
+//--------------------
+void eoeMath::SlerpFast(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) {
+	EVIL_SIMD->Quat_SlerpFast(dst, from, to, fractions, count);
+}
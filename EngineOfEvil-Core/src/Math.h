@@ -2,6 +2,26 @@
 #define EOECORE_MATH_H
 
 #include <math.h>
+#include <string.h>			// for memcpy
+
+template<typename type, int size>
+class eoeVec;
+class eoeQuat;
+
+// easing curves over a [0, 1] fraction, see eoeMath::Ease
+enum eoeEase_t {
+	EASE_LINEAR,
+	EASE_SMOOTHSTEP,		// 3t^2 - 2t^3, zero slope at both ends
+	EASE_SMOOTHERSTEP,		// 6t^5 - 15t^4 + 10t^3, zero slope and curvature at both ends
+	EASE_IN_QUAD,
+	EASE_OUT_QUAD,
+	EASE_IN_OUT_QUAD,
+	EASE_IN_CUBIC,
+	EASE_OUT_CUBIC,
+	EASE_IN_OUT_CUBIC,
+	EASE_IN_BACK,			// pulls back below 0 before starting
+	EASE_OUT_BACK			// overshoots past 1 before settling
+};
 
 //----------------------------------
 //			eoeMath
@@ -11,19 +31,79 @@ class eoeMath {
 public:
 
 	static float					NearestFloat(float x);
-	static int						NearestInt(float x);
+	static constexpr int			NearestInt(float x);
 	static void						IsometricToOrthographic(float & x, float & y);
 	static void						IsometricToOrthographic(int & x, int & y);
 	static void						OrthographicToIsometric(float & x, float & y);
 	static void						OrthographicToIsometric(int & x, int & y);
+	static void						IsometricToOrthographic(float * x, float * y, const int count);
+	static void						IsometricToOrthographic(int * x, int * y, const int count);
+	static void						OrthographicToIsometric(float * x, float * y, const int count);
+	static void						OrthographicToIsometric(int * x, int * y, const int count);
 	static float					GetAngle(float x, float y);
-	static float					ToDegrees(float radians);
-	static float					ToRadians(float degrees);
+	static constexpr float			ToDegrees(float radians);
+	static constexpr float			ToRadians(float degrees);
+
+	// exact tiers defer to libm (sqrtf, sinf, cosf, atan2f), fast tiers are
+	// polynomials whose batch versions run through EVIL_SIMD bit-for-bit identically
+	static void						SinCos(float radians, float & sin, float & cos);
+	static void						SinCosFast(float radians, float & sin, float & cos);
+	static float					RSqrt(float x);
+	static float					RSqrtFast(float x);
+	static float					ATan2(float y, float x);
+	static float					ATan2Fast(float y, float x);
+
+	static void						SinCos(float * sin, float * cos, const float * radians, const int count);
+	static void						SinCosFast(float * sin, float * cos, const float * radians, const int count);
+	static void						RSqrt(float * dst, const float * src, const int count);
+	static void						RSqrtFast(float * dst, const float * src, const int count);
+	static void						ATan2(float * dst, const float * y, const float * x, const int count);
+	static void						ATan2Fast(float * dst, const float * y, const float * x, const int count);
+
+	// interpolation, the batch versions take one fraction per element and run through EVIL_SIMD
+	static float					Lerp(const float from, const float to, const float fraction);
+	static float					Ease(const eoeEase_t type, float fraction);
+	static float					SmoothStep(const float edge0, const float edge1, const float x);
+
+	static void						Lerp(float * dst, const float * from, const float * to, const float * fractions, const int count);
+	static void						Lerp(eoeVec<float, 2> * dst, const eoeVec<float, 2> * from, const eoeVec<float, 2> * to, const float * fractions, const int count);
+	static void						Lerp(eoeVec<float, 3> * dst, const eoeVec<float, 3> * from, const eoeVec<float, 3> * to, const float * fractions, const int count);
+	static void						Lerp(eoeVec<float, 4> * dst, const eoeVec<float, 4> * from, const eoeVec<float, 4> * to, const float * fractions, const int count);
+	static void						Ease(float * dst, const float * fractions, const int count, const eoeEase_t type);
+	static void						Nlerp(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count);
+	static void						Slerp(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count);
+	static void						SlerpFast(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count);
 
 public:
 	
 	static const constexpr float	RAD2DEG_CFACTOR = 180.0f / (float)M_PI;
 	static const constexpr float	DEG2RAD_CFACTOR = (float)M_PI / 180.0f;
+	static const constexpr float	PI				= (float)M_PI;
+	static const constexpr float	HALF_PI			= (float)(M_PI * 0.5);
+	static const constexpr float	TWO_OVER_PI		= (float)(2.0 / M_PI);
+
+	// pi / 2 split so q * PIO2_HIGH and q * PIO2_MID are exact for |q| < 2^16
+	static const constexpr float	PIO2_HIGH		= 1.5703125f;
+	static const constexpr float	PIO2_MID		= 4.837512969970703125e-4f;
+	static const constexpr float	PIO2_LOW		= 7.54978995489188216e-8f;
+
+	// minimax polynomials on [-pi/4, pi/4] (sin, cos) and [0, 1] (atan)
+	static const constexpr float	SIN_C0			= -1.6666654611e-1f;
+	static const constexpr float	SIN_C1			= 8.3321608736e-3f;
+	static const constexpr float	SIN_C2			= -1.9515295891e-4f;
+	static const constexpr float	COS_C0			= 4.166664568298827e-2f;
+	static const constexpr float	COS_C1			= -1.388731625493765e-3f;
+	static const constexpr float	COS_C2			= 2.443315711809948e-5f;
+	static const constexpr float	ATAN_C0			= 0.9998660f;
+	static const constexpr float	ATAN_C1			= -0.3302995f;
+	static const constexpr float	ATAN_C2			= 0.1801410f;
+	static const constexpr float	ATAN_C3			= -0.0851330f;
+	static const constexpr float	ATAN_C4			= 0.0208351f;
+	static const constexpr int		RSQRT_MAGIC		= 0x5f375a86;
+
+	// EASE_IN_BACK and EASE_OUT_BACK overshoot by about 10%
+	static const constexpr float	BACK_C1			= 1.70158f;
+	static const constexpr float	BACK_C3			= BACK_C1 + 1.0f;
 };
 
 //--------------------
@@ -35,9 +115,12 @@ inline float eoeMath::NearestFloat(float x) {
 
 //--------------------
 // eoeMath::NearestInt
+// rounds halves up, like NearestFloat, including for negative values
 //--------------------
-inline int eoeMath::NearestInt(float x) {
-	return (int)(x + 0.5f);
+inline constexpr int eoeMath::NearestInt(float x) {
+	const float shifted = x + 0.5f;
+	const int truncated = (int)shifted;
+	return (shifted < (float)truncated) ? truncated - 1 : truncated;
 }
 
 //--------------------
@@ -54,12 +137,14 @@ inline void eoeMath::IsometricToOrthographic(float & x, float & y) {
 //--------------------
 // eoeMath::IsometricToOrthographic
 // rotates input coordinates ~45 degrees counter-clockwise
+// integer-only, rounds halves up exactly as NearestInt of the float version
+// DEBUG: assumes >> of a negative int is an arithmetic shift
 //--------------------
 inline void eoeMath::IsometricToOrthographic(int & x, int & y) {
-	float isoX = (float)x;
-	float isoY = (float)y;
-	x = NearestInt((2.0f * isoY + isoX) * 0.5f);
-	y = NearestInt((2.0f * isoY - isoX) * 0.5f);
+	const int isoX = x;
+	const int isoY = y;
+	x = isoY + ((isoX + 1) >> 1);
+	y = isoY + ((1 - isoX) >> 1);
 }
 
 //--------------------
@@ -76,47 +161,177 @@ inline void eoeMath::OrthographicToIsometric(float & x, float & y) {
 //--------------------
 // eoeMath::OrthographicToIsometric
 // rotates input coordinates ~45 degrees clockwise 
+// integer-only, rounds halves up exactly as NearestInt of the float version
+// DEBUG: assumes >> of a negative int is an arithmetic shift
 //--------------------
 inline void eoeMath::OrthographicToIsometric(int & x, int & y) {
-	int cartX = x;
-	int cartY = y;
+	const int cartX = x;
+	const int cartY = y;
 	x = cartX - cartY;
-	y = NearestInt((float)(cartX + cartY) * 0.5f);
+	y = (cartX + cartY + 1) >> 1;
 }
 
 //--------------------
 // eoeMath::GetAngle
-// returns the angle in degrees from the given components
+// returns the angle in degrees from the given components, within (-90, 270]
 // DEBUG: assumes components are part of a normalized vector
 //--------------------
 inline float eoeMath::GetAngle(float x, float y) {
-	float angle = 0.0f;
-	if (x == 0.0f && y > 0.0f) {
-		return 90.0f;
-	} else if (x == 0.0f && y < 0.0f) {
-		return 270.0f;
-	} else {
-		float tan = y / x;
-		angle = ToDegrees(atanf(tan));
-		if (x < 0)
-			angle += 180.0f;
-	}
+	float angle = ToDegrees(ATan2Fast(y, x));
+	if (angle <= -90.0f)
+		angle += 360.0f;
 	return angle;
 }
 
 //--------------------
 // eoeMath::ToDegrees
 //--------------------
-inline float eoeMath::ToDegrees(float radians) {
+inline constexpr float eoeMath::ToDegrees(float radians) {
 	return (radians * RAD2DEG_CFACTOR);
 }
 
 //--------------------
 // eoeMath::ToRadians
 //--------------------
-inline float eoeMath::ToRadians(float degrees) {
+inline constexpr float eoeMath::ToRadians(float degrees) {
 	return (degrees * DEG2RAD_CFACTOR);
 }
 
+//--------------------
+// eoeMath::SinCos
+// sin and cos of the same angle from libm's sinf and cosf,
+// so accuracy is whatever the platform's libm provides
+//--------------------
+inline void eoeMath::SinCos(float radians, float & sin, float & cos) {
+	sin = sinf(radians);
+	cos = cosf(radians);
+}
+
+//--------------------
+// eoeMath::SinCosFast
+// rounds radians * 2 / pi to the nearest quadrant, subtracts that many
+// pi / 2 in three parts, and evaluates both polynomials on the remainder,
+// then swaps and negates them by quadrant, here with conditionals that may
+// or may not compile to branches, in the SIMD kernels with masks
+// max absolute error 8e-8 for |radians| < 8192, degrades beyond that
+//--------------------
+inline void eoeMath::SinCosFast(float radians, float & sin, float & cos) {
+	const float q = rintf(radians * TWO_OVER_PI);
+	const int quadrant = (int)q;
+	const float r = ((radians - q * PIO2_HIGH) - q * PIO2_MID) - q * PIO2_LOW;
+	const float z = r * r;
+	const float sinR = ((SIN_C2 * z + SIN_C1) * z + SIN_C0) * z * r + r;
+	const float cosR = ((COS_C2 * z + COS_C1) * z + COS_C0) * z * z - 0.5f * z + 1.0f;
+
+	sin = (quadrant & 1) ? cosR : sinR;
+	cos = (quadrant & 1) ? sinR : cosR;
+	if (quadrant & 2)
+		sin = -sin;
+	if ((quadrant + 1) & 2)
+		cos = -cos;
+}
+
+//--------------------
+// eoeMath::RSqrt
+// 1 / sqrt(x), correctly rounded sqrt followed by one divide
+//--------------------
+inline float eoeMath::RSqrt(float x) {
+	return 1.0f / sqrtf(x);
+}
+
+//--------------------
+// eoeMath::RSqrtFast
+// integer estimate refined by two newton-raphson steps
+// max relative error 5e-6
+// DEBUG: returns a large finite value for 0 and garbage for negative x
+//--------------------
+inline float eoeMath::RSqrtFast(float x) {
+	int bits;
+	memcpy(&bits, &x, sizeof(bits));
+	bits = RSQRT_MAGIC - (bits >> 1);
+	float y;
+	memcpy(&y, &bits, sizeof(y));
+
+	const float halfX = 0.5f * x;
+	y = y * (1.5f - halfX * y * y);
+	y = y * (1.5f - halfX * y * y);
+	return y;
+}
+
+//--------------------
+// eoeMath::ATan2
+// angle of (x, y) from the +x axis in radians, within [-pi, pi]
+//--------------------
+inline float eoeMath::ATan2(float y, float x) {
+	return atan2f(y, x);
+}
+
+//--------------------
+// eoeMath::ATan2Fast
+// octant reduction onto atan of [0, 1]
+// max absolute error 1.2e-5 radians, the sign follows y's sign bit as
+// atan2f's does, so (-0, x < 0) gives -pi, and (±0, ±0) gives ±0
+//--------------------
+inline float eoeMath::ATan2Fast(float y, float x) {
+	const float absX = fabsf(x);
+	const float absY = fabsf(y);
+	const float maxXY = absX > absY ? absX : absY;
+	const float minXY = absX < absY ? absX : absY;
+	const float a = (maxXY == 0.0f) ? 0.0f : minXY / maxXY;
+	const float s = a * a;
+
+	float angle = ((((ATAN_C4 * s + ATAN_C3) * s + ATAN_C2) * s + ATAN_C1) * s + ATAN_C0) * a;
+	if (absY > absX)
+		angle = HALF_PI - angle;
+	if (x < 0.0f)
+		angle = PI - angle;
+	if (signbit(y))
+		angle = -angle;
+	return angle;
+}
+
+//--------------------
+// eoeMath::Lerp
+// from at fraction 0, to at fraction 1, extrapolates outside [0, 1]
+//--------------------
+inline float eoeMath::Lerp(const float from, const float to, const float fraction) {
+	return from + (to - from) * fraction;
+}
+
+//--------------------
+// eoeMath::Ease
+// fraction clamped to [0, 1] and mapped through the type curve,
+// eg: eoeMath::Lerp(start, end, eoeMath::Ease(EASE_OUT_CUBIC, elapsed / duration))
+// only the BACK curves leave [0, 1], every curve maps 0 to 0 and 1 to 1
+//--------------------
+inline float eoeMath::Ease(const eoeEase_t type, float fraction) {
+	float t = fraction > 0.0f ? fraction : 0.0f;
+	t = t < 1.0f ? t : 1.0f;
+	const float u = 1.0f - t;
+
+	switch (type) {
+		case EASE_SMOOTHSTEP:	return t * t * (3.0f - 2.0f * t);
+		case EASE_SMOOTHERSTEP:	return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+		case EASE_IN_QUAD:		return t * t;
+		case EASE_OUT_QUAD:		return 1.0f - u * u;
+		case EASE_IN_OUT_QUAD:	return t < 0.5f ? 2.0f * t * t : 1.0f - 2.0f * u * u;
+		case EASE_IN_CUBIC:		return t * t * t;
+		case EASE_OUT_CUBIC:	return 1.0f - u * u * u;
+		case EASE_IN_OUT_CUBIC:	return t < 0.5f ? 4.0f * t * t * t : 1.0f - 4.0f * u * u * u;
+		case EASE_IN_BACK:		return t * t * (BACK_C3 * t - BACK_C1);
+		case EASE_OUT_BACK:		return 1.0f - u * u * (BACK_C3 * u - BACK_C1);
+		default:				return t;
+	}
+}
+
+//--------------------
+// eoeMath::SmoothStep
+// 0 below edge0, 1 above edge1, and a smooth hermite ramp between
+// DEBUG: edge0 == edge1 divides by zero
+//--------------------
+inline float eoeMath::SmoothStep(const float edge0, const float edge1, const float x) {
+	return Ease(EASE_SMOOTHSTEP, (x - edge0) / (edge1 - edge0));
+}
+
 #endif /* EOECORE_MATH_H */
 
@@ -1,180 +1,382 @@
-#include "Matrix.h"
+#include <string.h>
+#include "SIMD.h"
 
-eoeMat4 mat4_identity(1.0f);
-eoeMat4 mat4_zero;
+//--------------------------
+// eoeMatrix4::operator*
+// column-vector matrix multiplication
+//--------------------------
+template<eoeMat4Layout_t layout>
+eoeVec4	eoeMatrix4<layout>::operator*(const eoeVec4 &v) const {
+	eoeVec4 result;
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		EVIL_SIMD->Mat4_MultiplyVec4(result, Storage(), v);
+	else
+		EVIL_SIMD->Mat4_MultiplyVec4Transposed(result, Storage(), v);
+	return result;
+}
 
 //--------------------------
-// eoeMat4::eoeMat4
+// eoeMatrix4::operator*
 //--------------------------
-eoeMat4::eoeMat4(const float diagonal) {
-	matrix[0].x = 1.0f;
-	matrix[1].y = 1.0f;
-	matrix[2].z = 1.0f;
-	matrix[3].w = 1.0f;
+template<eoeMat4Layout_t layout>
+eoeMatrix4<layout>	eoeMatrix4<layout>::operator*(const eoeMatrix4 &a) const {
+	eoeMatrix4 result;
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		EVIL_SIMD->Mat4_MultiplyMat4(result.Storage(), Storage(), a.Storage());
+	else
+		EVIL_SIMD->Mat4_MultiplyMat4(result.Storage(), a.Storage(), Storage());		// (this * a)^T == a^T * this^T
+	return result;
 }
 
 //--------------------------
-// eoeMat4::operator[]
-// returns the requested column of *this
+// eoeMatrix4::operator*=
 //--------------------------
-eoeVec4 & eoeMat4::operator[](int column) {
-	return matrix[column];
+template<eoeMat4Layout_t layout>
+eoeMatrix4<layout> & eoeMatrix4<layout>::operator*=(const eoeMatrix4 &a) {
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		EVIL_SIMD->Mat4_MultiplyMat4(Storage(), Storage(), a.Storage());
+	else
+		EVIL_SIMD->Mat4_MultiplyMat4(Storage(), a.Storage(), Storage());
+	return *this;
 }
 
 //--------------------------
-// eoeMat4::operator[]
-// returns a copy of the requested column of *this
+// eoeMatrix4::TransformPoints
+// dst[i] = *this * src[i], for count contiguous eoeVec4s
+// src w is used as-is, so homogeneous points keep their own w
+// dst may be src, but must not otherwise overlap it
 //--------------------------
-eoeVec4	eoeMat4::operator[](int column) const {
-	return matrix[column];
+template<eoeMat4Layout_t layout>
+void eoeMatrix4<layout>::TransformPoints(eoeVec4 * dst, const eoeVec4 * src, const int count) const {
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		EVIL_SIMD->Mat4_TransformVec4(dst, *this, src, count);
+	else
+		eoeMat4(*this).TransformPoints(dst, src, count);
 }
 
 //--------------------------
-// eoeMat4::operator*
-// column-vector matrix multiplication
+// eoeMatrix4::TransformPoints
+// dst[i] = (*this * eoeVec4(src[i], 1)).xyz, for count contiguous eoeVec3s
+// dst may be src, but must not otherwise overlap it
 //--------------------------
-eoeVec4	eoeMat4::operator*(const eoeVec4 &v) const {													
-	return eoeVec4( matrix[0][0] * v.x + matrix[0][1] * v.y + matrix[0][2] * v.z + matrix[0][3] * v.w,
-					matrix[1][0] * v.x + matrix[1][1] * v.y + matrix[1][2] * v.z + matrix[1][3] * v.w,
-					matrix[2][0] * v.x + matrix[2][1] * v.y + matrix[2][2] * v.z + matrix[2][3] * v.w,
-					matrix[3][0] * v.x + matrix[3][1] * v.y + matrix[3][2] * v.z + matrix[3][3] * v.w );
+template<eoeMat4Layout_t layout>
+void eoeMatrix4<layout>::TransformPoints(eoeVec3 * dst, const eoeVec3 * src, const int count) const {
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		EVIL_SIMD->Mat4_TransformVec3Points(dst, *this, src, count);
+	else
+		eoeMat4(*this).TransformPoints(dst, src, count);
 }
 
 //--------------------------
-// eoeMat4::operator*
+// eoeMatrix4::TransformDirections
+// dst[i] = *this * eoeVec4(src[i].xyz, 0), for count contiguous eoeVec4s
+// ignores translation, src w is treated as zero
+// dst may be src, but must not otherwise overlap it
+//--------------------------
+template<eoeMat4Layout_t layout>
+void eoeMatrix4<layout>::TransformDirections(eoeVec4 * dst, const eoeVec4 * src, const int count) const {
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		EVIL_SIMD->Mat4_TransformVec4Directions(dst, *this, src, count);
+	else
+		eoeMat4(*this).TransformDirections(dst, src, count);
+}
+
 //--------------------------
-eoeMat4	eoeMat4::operator*(const eoeMat4 &a) const {
-	eoeMat4 result;
-	const float * m1Ptr = reinterpret_cast<const float *>(this);	// faster than a function call to ToFloatPtr
-	const float * m2Ptr = reinterpret_cast<const float *>(&a);
-	float * resultPtr = reinterpret_cast<float *>(&result);
+// eoeMatrix4::TransformDirections
+// dst[i] = (*this * eoeVec4(src[i], 0)).xyz, for count contiguous eoeVec3s
+// ignores translation
+// dst may be src, but must not otherwise overlap it
+//--------------------------
+template<eoeMat4Layout_t layout>
+void eoeMatrix4<layout>::TransformDirections(eoeVec3 * dst, const eoeVec3 * src, const int count) const {
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		EVIL_SIMD->Mat4_TransformVec3Directions(dst, *this, src, count);
+	else
+		eoeMat4(*this).TransformDirections(dst, src, count);
+}
+
+//--------------------------
+// eoeMatrix4::TransformPointsProjective
+// dst[i] = *this * src[i] followed by the perspective divide, so dst[i].w == 1
+// dst may be src, but must not otherwise overlap it
+// DEBUG: allows divide by zero errors to occur
+//--------------------------
+template<eoeMat4Layout_t layout>
+void eoeMatrix4<layout>::TransformPointsProjective(eoeVec4 * dst, const eoeVec4 * src, const int count) const {
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		EVIL_SIMD->Mat4_TransformVec4Projective(dst, *this, src, count);
+	else
+		eoeMat4(*this).TransformPointsProjective(dst, src, count);
+}
+
+//--------------------------
+// eoeMatrix4::TransformPointsProjective
+// dst[i] = *this * eoeVec4(src[i], 1) followed by the perspective divide
+// dst may be src, but must not otherwise overlap it
+// DEBUG: allows divide by zero errors to occur
+//--------------------------
+template<eoeMat4Layout_t layout>
+void eoeMatrix4<layout>::TransformPointsProjective(eoeVec3 * dst, const eoeVec3 * src, const int count) const {
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		EVIL_SIMD->Mat4_TransformVec3Projective(dst, *this, src, count);
+	else
+		eoeMat4(*this).TransformPointsProjective(dst, src, count);
+}
 
-	for (int r = 0; r < 4; ++r) {
-		for (int c = 0; c < 4; ++c) {
-			*resultPtr = m1Ptr[0] * m2Ptr[ 0 * 4 + c ]
-					   + m1Ptr[1] * m2Ptr[ 1 * 4 + c ]
-					   + m1Ptr[2] * m2Ptr[ 2 * 4 + c ]
-					   + m1Ptr[3] * m2Ptr[ 3 * 4 + c ];
-			++resultPtr;
+//--------------------------
+// eoeMatrix4::MultiplyToColumnMajor
+// writes *this * models[i] for count contiguous matrices as 16 * count floats,
+// each one column-major so the block can be uploaded to GL as-is (eg: into a mapped buffer)
+// eg: viewProjection.MultiplyToColumnMajor(mvps, models, numVisible);
+// dst must not overlap this or models
+// a column-major matrix already stores its products column-major, so it multiplies one at a time
+//--------------------------
+template<eoeMat4Layout_t layout>
+void eoeMatrix4<layout>::MultiplyToColumnMajor(float * dst, const eoeMatrix4 * models, const int count) const {
+	if constexpr (layout == MAT4_ROW_MAJOR) {
+		EVIL_SIMD->Mat4_MultiplyMat4sColumnMajor(dst, *this, models, count);
+	} else {
+		eoeMatrix4 result;
+		for (int i = 0; i < count; ++i) {
+			EVIL_SIMD->Mat4_MultiplyMat4(result.Storage(), models[i].Storage(), Storage());
+			memcpy(dst + i * 16, result.ToFloatPtr(), 16 * sizeof(float));
 		}
-		m1Ptr += 4;
 	}
+}
+
+//--------------------------
+// eoeMatrix4::Determinant
+// expands along the 2x2 sub-determinants of the top and bottom row pairs
+//--------------------------
+template<eoeMat4Layout_t layout>
+float eoeMatrix4<layout>::Determinant() const {
+	const float * m = ToFloatPtr();
+
+	const float s0 = m[ 0] * m[ 5] - m[ 1] * m[ 4];
+	const float s1 = m[ 0] * m[ 6] - m[ 2] * m[ 4];
+	const float s2 = m[ 0] * m[ 7] - m[ 3] * m[ 4];
+	const float s3 = m[ 1] * m[ 6] - m[ 2] * m[ 5];
+	const float s4 = m[ 1] * m[ 7] - m[ 3] * m[ 5];
+	const float s5 = m[ 2] * m[ 7] - m[ 3] * m[ 6];
+
+	const float c0 = m[ 8] * m[13] - m[ 9] * m[12];
+	const float c1 = m[ 8] * m[14] - m[10] * m[12];
+	const float c2 = m[ 8] * m[15] - m[11] * m[12];
+	const float c3 = m[ 9] * m[14] - m[10] * m[13];
+	const float c4 = m[ 9] * m[15] - m[11] * m[13];
+	const float c5 = m[10] * m[15] - m[11] * m[14];
+
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+//--------------------------
+// eoeMatrix4::Transpose
+//--------------------------
+template<eoeMat4Layout_t layout>
+eoeMatrix4<layout> eoeMatrix4<layout>::Transpose() const {
+	eoeMatrix4 result;
+	EVIL_SIMD->Mat4_Transpose(result.Storage(), Storage());
 	return result;
 }
 
 //--------------------------
-// eoeMat4::operator*=
+// eoeMatrix4::TransposeSelf
+// transposes in place, eg: before handing a row-major matrix to glUniformMatrix4fv without GL_TRUE
 //--------------------------
-eoeMat4 & eoeMat4::operator*=(const eoeMat4 &a) {
-	*this = *this * a;
+template<eoeMat4Layout_t layout>
+eoeMatrix4<layout> & eoeMatrix4<layout>::TransposeSelf() {
+	EVIL_SIMD->Mat4_Transpose(Storage(), Storage());
 	return *this;
 }
 
+//--------------------------
+// eoeMatrix4::Inverse
+// DEBUG: returns an unmodified copy if the matrix is singular, use InverseSelf to detect that
+//--------------------------
+template<eoeMat4Layout_t layout>
+eoeMatrix4<layout> eoeMatrix4<layout>::Inverse() const {
+	eoeMatrix4 result = *this;
+	result.InverseSelf();
+	return result;
+}
+
+//--------------------------
+// eoeMatrix4::InverseSelf
+// inverts any non-singular matrix in place
+// returns false and leaves the matrix unmodified if it is singular
+//--------------------------
+template<eoeMat4Layout_t layout>
+bool eoeMatrix4<layout>::InverseSelf() {
+	return EVIL_SIMD->Mat4_Inverse(Storage(), Storage());		// inverse(m^T) == inverse(m)^T, so either layout
+}
+
+//--------------------------
+// eoeMatrix4::AffineInverse
+// DEBUG: returns an unmodified copy if any scale is zero, use AffineInverseSelf to detect that
+//--------------------------
+template<eoeMat4Layout_t layout>
+eoeMatrix4<layout> eoeMatrix4<layout>::AffineInverse() const {
+	eoeMatrix4 result = *this;
+	result.AffineInverseSelf();
+	return result;
+}
+
+//--------------------------
+// eoeMatrix4::AffineInverseSelf
+// inverts a GetTranslation * GetRotation * GetScale matrix in place
+// several times cheaper than InverseSelf, but wrong for anything with shear,
+// non-uniform scale applied after rotation, or a projection
+// returns false and leaves the matrix unmodified if any scale is zero
+//--------------------------
+template<eoeMat4Layout_t layout>
+bool eoeMatrix4<layout>::AffineInverseSelf() {
+	if constexpr (layout == MAT4_ROW_MAJOR) {
+		return EVIL_SIMD->Mat4_AffineInverse(*this, *this);
+	} else {
+		eoeMat4 rows(*this);
+		if (!EVIL_SIMD->Mat4_AffineInverse(rows, rows))
+			return false;
+		*this = eoeMatrix4(rows);
+		return true;
+	}
+}
+
 //-----------------------------------
-// eoeMat4::ToFloatPtr
+// eoeMatrix4::ToFloatPtr
 // returns a pointer to the first element of the matrix
+// the 16 floats follow the layout, so an eoeMat4CM's can be handed to GL unconverted
 //-----------------------------------
-const float * eoeMat4::ToFloatPtr() const {
+template<eoeMat4Layout_t layout>
+const float * eoeMatrix4<layout>::ToFloatPtr() const {
 	return matrix[0].ToFloatPtr();
 }
 
 //-----------------------------------
-// eoeMat4::ToFloatPtr
+// eoeMatrix4::ToFloatPtr
 // returns a pointer to the first element of the matrix
 //-----------------------------------
-float * eoeMat4::ToFloatPtr() {
+template<eoeMat4Layout_t layout>
+float * eoeMatrix4<layout>::ToFloatPtr() {
 	return matrix[0].ToFloatPtr();
 }
 
 //--------------------------
-// eoeMat4::GetIdentity
+// eoeMatrix4::GetPerspective
 //--------------------------
-eoeMat4 eoeMat4::GetIdentity() {
-	return mat4_identity;
-}
-
-//--------------------------
-// eoeMat4::GetPerspective
-//--------------------------
-eoeMat4	eoeMat4::GetPerspective(float fovDegrees, float aspectRatio, float near, float far) {
-	eoeMat4 result;
+template<eoeMat4Layout_t layout>
+eoeMatrix4<layout>	eoeMatrix4<layout>::GetPerspective(float fovDegrees, float aspectRatio, float near, float far) {
+	eoeMatrix4 result;
 	const float ithf = 1.0f / SDL_tanf(eoeMath::ToRadians(fovDegrees) * 0.5f);
 	const float inmf = 1.0f / (near - far);
 
-	result[0][0] = (1.0f / aspectRatio) * ithf;
-	result[1][1] = ithf;
-	result[2][2] = (far + near) * inmf;
-	result[3][2] = -1.0f;
-	result[2][3] = 2.0f * far * near * inmf;
-	return result;
-}
-
-//--------------------------
-// eoeMat4::GetOrthographic
-//--------------------------
-eoeMat4	eoeMat4::GetOrthographic(float left, float right, float bottom, float top, float near, float far) {
-	eoeMat4 result;
-	const float irml = 1.0f / (right - left);
-	const float itmb = 1.0f / (top - bottom);
-	const float ifmn = 1.0f / (far - near);
-
-	result[0][0] = 2.0f * irml;
-	result[1][1] = 2.0f * itmb;
-	result[2][2] = -2.0f * ifmn;
-	result[0][3] = (right + left) * -irml;
-	result[1][3] = (top + bottom) * -itmb;
-	result[2][3] = (far + near) * -ifmn;
-	result[3][3] = 1.0f;
+	result(0, 0) = (1.0f / aspectRatio) * ithf;
+	result(1, 1) = ithf;
+	result(2, 2) = (far + near) * inmf;
+	result(3, 2) = -1.0f;
+	result(2, 3) = 2.0f * far * near * inmf;
 	return result;
 }
 
 //--------------------------
-// eoeMat4::GetRotation
+// eoeMatrix4::GetRotation
 //--------------------------
-eoeMat4	eoeMat4::GetRotation(const eoeVec3 & axis, float angleDegrees) {
-	eoeMat4 result;
+template<eoeMat4Layout_t layout>
+eoeMatrix4<layout>	eoeMatrix4<layout>::GetRotation(const eoeVec3 & axis, float angleDegrees) {
+	eoeMatrix4 result;
 	const float angleRads = eoeMath::ToRadians(angleDegrees);
-	const float cos = SDL_cosf(angleRads);
-	const float sin = SDL_sinf(angleRads);
+	float sin, cos;
+	eoeMath::SinCosFast(angleRads, sin, cos);
 	const float omc = 1.0f - cos;
 	const float xy = axis.x * axis.y;
 	const float xz = axis.x * axis.z;
 	const float yz = axis.y * axis.z;
 
-	result[0][0] = cos + axis.x * axis.x * omc;
-	result[0][1] = xy * omc - axis.z * sin;
-	result[0][2] = xz * omc + axis.y * sin;
+	result(0, 0) = cos + axis.x * axis.x * omc;
+	result(0, 1) = xy * omc - axis.z * sin;
+	result(0, 2) = xz * omc + axis.y * sin;
 
-	result[1][0] = xy * omc + axis.z * sin;
-	result[1][1] = cos + axis.y * axis.y * omc;
-	result[1][2] = yz * omc - axis.x * sin;
+	result(1, 0) = xy * omc + axis.z * sin;
+	result(1, 1) = cos + axis.y * axis.y * omc;
+	result(1, 2) = yz * omc - axis.x * sin;
 
-	result[2][0] = xz * omc - axis.y * sin;
-	result[2][1] = yz * omc + axis.x * sin;
-	result[2][2] = cos + axis.z * axis.z * omc;
+	result(2, 0) = xz * omc - axis.y * sin;
+	result(2, 1) = yz * omc + axis.x * sin;
+	result(2, 2) = cos + axis.z * axis.z * omc;
 
-	result[3].w = 1.0f;
+	result(3, 3) = 1.0f;
 	return result;
 }
 
+template class eoeMatrix4<MAT4_ROW_MAJOR>;
+template class eoeMatrix4<MAT4_COLUMN_MAJOR>;
+
 //--------------------------
-// eoeMat4::GetTranslation
+// eoeMat3x2::TransformPoints
+// dst[i] = *this * src[i], for count contiguous eoeVec2s
+// dst may be src, but must not otherwise overlap it
 //--------------------------
-eoeMat4	eoeMat4::GetTranslation(const eoeVec3 & translation) {
-	eoeMat4 result(1.0f);
-	result[0][3]= translation.x;
-	result[1][3]= translation.y;
-	result[2][3]= translation.z;
-	return result;
+void eoeMat3x2::TransformPoints(eoeVec2 * dst, const eoeVec2 * src, const int count) const {
+	EVIL_SIMD->Mat3x2_TransformVec2(dst, *this, src, count);
 }
 
 //--------------------------
-// eoeMat4::GetScale
+// eoeMat3x2::InverseSelf
+// closed-form 2x2 inverse, with the translation carried through it
+// returns false and leaves the matrix unmodified if it is singular
 //--------------------------
-eoeMat4	eoeMat4::GetScale(const eoeVec3 & scale) {
-	eoeMat4 result(1.0f);
-	result[0][0]= scale.x;
-	result[1][1] = scale.y;
-	result[2][2] = scale.z;
-	return result;
-}
\ No newline at end of file
+bool eoeMat3x2::InverseSelf() {
+	const float det = Determinant();
+	if (fabsf(det) < INVERSE_EPSILON)
+		return false;
+
+	const float invDet = 1.0f / det;
+	const eoeVec2 xAxis( matrix[1].y * invDet, -matrix[0].y * invDet);
+	const eoeVec2 yAxis(-matrix[1].x * invDet,  matrix[0].x * invDet);
+	const eoeVec2 t = matrix[2];
+	matrix[2].Set(-(xAxis.x * t.x + yAxis.x * t.y), -(xAxis.y * t.x + yAxis.y * t.y));
+	matrix[0] = xAxis;
+	matrix[1] = yAxis;
+	return true;
+}
+
+//--------------------------
+// eoeMat3x2::ToMat4
+// the same transform in the xy plane, z passes through unchanged
+//--------------------------
+eoeMat4 eoeMat3x2::ToMat4() const {
+	return eoeMat4(eoeVec4(matrix[0].x, matrix[1].x, 0.0f, matrix[2].x),
+				   eoeVec4(matrix[0].y, matrix[1].y, 0.0f, matrix[2].y),
+				   eoeVec4(0.0f, 0.0f, 1.0f, 0.0f),
+				   eoeVec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+//--------------------------
+// eoeMat3x2::ToMat4CM
+// ToMat4 laid out for upload, see eoeMat4CM
+//--------------------------
+eoeMat4CM eoeMat3x2::ToMat4CM() const {
+	return eoeMat4CM(eoeVec4(matrix[0].x, matrix[1].x, 0.0f, matrix[2].x),
+					 eoeVec4(matrix[0].y, matrix[1].y, 0.0f, matrix[2].y),
+					 eoeVec4(0.0f, 0.0f, 1.0f, 0.0f),
+					 eoeVec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+//--------------------------
+// eoeMat3x2::GetRotation
+// counter-clockwise by degrees
+//--------------------------
+eoeMat3x2 eoeMat3x2::GetRotation(const float degrees) {
+	float sin, cos;
+	eoeMath::SinCosFast(eoeMath::ToRadians(degrees), sin, cos);
+	return eoeMat3x2(eoeVec2(cos, sin), eoeVec2(-sin, cos), eoeVec2(0.0f, 0.0f));
+}
+
+//--------------------------
+// eoeMat3x2::FromTRS
+// equivalent to GetTranslation * GetRotation * GetScale, without the two multiplies
+//--------------------------
+eoeMat3x2 eoeMat3x2::FromTRS(const eoeVec2 & translation, const float degrees, const eoeVec2 & scale) {
+	float sin, cos;
+	eoeMath::SinCosFast(eoeMath::ToRadians(degrees), sin, cos);
+	return eoeMat3x2(eoeVec2(cos * scale.x, sin * scale.x), eoeVec2(-sin * scale.y, cos * scale.y), translation);
+}
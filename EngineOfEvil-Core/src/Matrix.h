@@ -4,38 +4,417 @@
 #include "Vector.h"
 
 //-----------------------------------
-//			eoeMat4
-//	 4x4 row-major matrix
+//			eoeMatrix4
+//	 4x4 matrix in either storage layout
 //  default ctor is all zeros
-// TODO: model matrix (conversion from modelspace to worldspace) == (translation * rotation * scale), then  * modelCoordinate to get the new worldspace coordinate
+// both layouts mean the same thing mathematically (column vectors, m * v),
+// layout only decides whether matrix[] holds the rows or the columns:
+//	eoeMat4 (MAT4_ROW_MAJOR) is the engine's working type
+//	eoeMat4CM (MAT4_COLUMN_MAJOR) is what GL expects, so its ToFloatPtr goes
+//	straight to glUniformMatrix4fv(..., GL_FALSE, ...) or a memcpy into a UBO/SSBO
+// a column-major matrix's storage is exactly a row-major matrix of its transpose,
+// which is how eoeMat4CM reuses the row-major SIMD kernels
+// model matrix (conversion from modelspace to worldspace) == (translation * rotation * scale), see eoeTransform::ToMat4
 // TODO: camera matrix (translation * rotation) ?
+// 32-byte aligned so each pair of rows (or columns) shares one AVX register
 //-----------------------------------
-class eoeMat4 {
+template<eoeMat4Layout_t layout>
+class alignas(32) eoeMatrix4 {
 public:
 
-	eoeVec4						matrix[4];
+	eoeVec4							matrix[4];		// rows if MAT4_ROW_MAJOR, columns if MAT4_COLUMN_MAJOR
 
-								eoeMat4() = default;
-	explicit					eoeMat4(const float diagonal);
+									eoeMatrix4() = default;
+	explicit constexpr				eoeMatrix4(const float diagonal);
+	explicit constexpr				eoeMatrix4(const eoeVec4 & row0, const eoeVec4 & row1, const eoeVec4 & row2, const eoeVec4 & row3);
+	template<eoeMat4Layout_t otherLayout>
+	explicit						eoeMatrix4(const eoeMatrix4<otherLayout> & other);
 
-	eoeVec4 &					operator[](int column);
-	eoeVec4						operator[](int column) const;
-	eoeMat4						operator*(const eoeMat4 &a) const;
-	eoeVec4						operator*(const eoeVec4 &v) const;
-	eoeMat4 &					operator*=(const eoeMat4 &a);
+	constexpr eoeVec4 &				operator[](int index);
+	constexpr eoeVec4				operator[](int index) const;
+	float &							operator()(const int row, const int column);
+	float							operator()(const int row, const int column) const;
+	eoeVec4							GetRow(const int row) const;
+	eoeVec4							GetColumn(const int column) const;
 
-	const float *				ToFloatPtr() const;
-	float *						ToFloatPtr();
+	eoeMatrix4						operator*(const eoeMatrix4 &a) const;
+	eoeVec4							operator*(const eoeVec4 &v) const;
+	eoeMatrix4 &					operator*=(const eoeMatrix4 &a);
 
-	static eoeMat4				GetIdentity();
-	static eoeMat4				GetPerspective(float fov, float aspectRatio, float near, float far);
-	static eoeMat4				GetOrthographic(float left, float right, float bottom, float top, float near, float far);	
-	static eoeMat4				GetRotation(const eoeVec3 & axis, float degrees);
-	static eoeMat4				GetTranslation(const eoeVec3 & translation);
-	static eoeMat4				GetScale(const eoeVec3 & scale);
+	void							TransformPoints(eoeVec4 * dst, const eoeVec4 * src, const int count) const;
+	void							TransformPoints(eoeVec3 * dst, const eoeVec3 * src, const int count) const;
+	void							TransformDirections(eoeVec4 * dst, const eoeVec4 * src, const int count) const;
+	void							TransformDirections(eoeVec3 * dst, const eoeVec3 * src, const int count) const;
+	void							TransformPointsProjective(eoeVec4 * dst, const eoeVec4 * src, const int count) const;
+	void							TransformPointsProjective(eoeVec3 * dst, const eoeVec3 * src, const int count) const;
+	void							MultiplyToColumnMajor(float * dst, const eoeMatrix4 * models, const int count) const;
+
+	float							Determinant() const;
+	eoeMatrix4						Transpose() const;
+	eoeMatrix4 &					TransposeSelf();
+	eoeMatrix4						Inverse() const;
+	bool							InverseSelf();
+	eoeMatrix4						AffineInverse() const;
+	bool							AffineInverseSelf();
+
+	const float *					ToFloatPtr() const;
+	float *							ToFloatPtr();
+
+	static constexpr eoeMatrix4		GetIdentity();
+	static eoeMatrix4				GetPerspective(float fov, float aspectRatio, float near, float far);
+	static constexpr eoeMatrix4		GetOrthographic(float left, float right, float bottom, float top, float zNear, float zFar);
+	static eoeMatrix4				GetRotation(const eoeVec3 & axis, float degrees);
+	static constexpr eoeMatrix4		GetTranslation(const eoeVec3 & translation);
+	static constexpr eoeMatrix4		GetScale(const eoeVec3 & scale);
+
+public:
+
+	static constexpr float			INVERSE_EPSILON = 1e-14f;		// smaller determinants are treated as singular
+
+private:
+
+	const eoeMat4 &					Storage() const;
+	eoeMat4 &						Storage();
+};
+
+typedef eoeMatrix4<MAT4_COLUMN_MAJOR>	eoeMat4CM;
+
+//--------------------------
+// eoeMatrix4::eoeMatrix4
+// sets the main diagonal to the given value, everything else to zero
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline constexpr eoeMatrix4<layout>::eoeMatrix4(const float diagonal)
+	: matrix{ eoeVec4(diagonal, 0.0f, 0.0f, 0.0f),
+			  eoeVec4(0.0f, diagonal, 0.0f, 0.0f),
+			  eoeVec4(0.0f, 0.0f, diagonal, 0.0f),
+			  eoeVec4(0.0f, 0.0f, 0.0f, diagonal) } {
+}
+
+//--------------------------
+// eoeMatrix4::eoeMatrix4
+// from the mathematical rows, in either layout
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline constexpr eoeMatrix4<layout>::eoeMatrix4(const eoeVec4 & row0, const eoeVec4 & row1, const eoeVec4 & row2, const eoeVec4 & row3)
+	: matrix{ layout == MAT4_ROW_MAJOR ? row0 : eoeVec4(row0.x, row1.x, row2.x, row3.x),
+			  layout == MAT4_ROW_MAJOR ? row1 : eoeVec4(row0.y, row1.y, row2.y, row3.y),
+			  layout == MAT4_ROW_MAJOR ? row2 : eoeVec4(row0.z, row1.z, row2.z, row3.z),
+			  layout == MAT4_ROW_MAJOR ? row3 : eoeVec4(row0.w, row1.w, row2.w, row3.w) } {
+}
+
+//--------------------------
+// eoeMatrix4::eoeMatrix4
+// converts between layouts, the matrix itself is unchanged
+//--------------------------
+template<eoeMat4Layout_t layout>
+template<eoeMat4Layout_t otherLayout>
+inline eoeMatrix4<layout>::eoeMatrix4(const eoeMatrix4<otherLayout> & other)
+	: eoeMatrix4(other.GetRow(0), other.GetRow(1), other.GetRow(2), other.GetRow(3)) {
+}
+
+inline constexpr eoeMat4 mat4_identity(1.0f);
+inline constexpr eoeMat4 mat4_zero(0.0f);
+
+//--------------------------
+// eoeMatrix4::operator[]
+// returns the index-th row of a row-major matrix, or column of a column-major one
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline constexpr eoeVec4 & eoeMatrix4<layout>::operator[](int index) {
+	return matrix[index];
+}
+
+//--------------------------
+// eoeMatrix4::operator[]
+// returns a copy of the index-th row of a row-major matrix, or column of a column-major one
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline constexpr eoeVec4 eoeMatrix4<layout>::operator[](int index) const {
+	return matrix[index];
+}
+
+//--------------------------
+// eoeMatrix4::operator()
+// returns the element at row, column regardless of layout
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline float & eoeMatrix4<layout>::operator()(const int row, const int column) {
+	return layout == MAT4_ROW_MAJOR ? matrix[row][column] : matrix[column][row];
+}
+
+//--------------------------
+// eoeMatrix4::operator()
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline float eoeMatrix4<layout>::operator()(const int row, const int column) const {
+	return layout == MAT4_ROW_MAJOR ? matrix[row][column] : matrix[column][row];
+}
+
+//--------------------------
+// eoeMatrix4::GetRow
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline eoeVec4 eoeMatrix4<layout>::GetRow(const int row) const {
+	if constexpr (layout == MAT4_ROW_MAJOR)
+		return matrix[row];
+	else
+		return eoeVec4(matrix[0][row], matrix[1][row], matrix[2][row], matrix[3][row]);
+}
+
+//--------------------------
+// eoeMatrix4::GetColumn
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline eoeVec4 eoeMatrix4<layout>::GetColumn(const int column) const {
+	if constexpr (layout == MAT4_COLUMN_MAJOR)
+		return matrix[column];
+	else
+		return eoeVec4(matrix[0][column], matrix[1][column], matrix[2][column], matrix[3][column]);
+}
+
+//--------------------------
+// eoeMatrix4::Storage
+// the same memory seen as the row-major matrix the SIMD kernels take,
+// for a column-major matrix that is its transpose
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline const eoeMat4 & eoeMatrix4<layout>::Storage() const {
+	return reinterpret_cast<const eoeMat4 &>(*this);
+}
+
+//--------------------------
+// eoeMatrix4::Storage
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline eoeMat4 & eoeMatrix4<layout>::Storage() {
+	return reinterpret_cast<eoeMat4 &>(*this);
+}
+
+//--------------------------
+// eoeMatrix4::GetIdentity
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline constexpr eoeMatrix4<layout> eoeMatrix4<layout>::GetIdentity() {
+	return eoeMatrix4(1.0f);
+}
+
+//--------------------------
+// eoeMatrix4::GetOrthographic
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline constexpr eoeMatrix4<layout> eoeMatrix4<layout>::GetOrthographic(float left, float right, float bottom, float top, float zNear, float zFar) {
+	const float irml = 1.0f / (right - left);
+	const float itmb = 1.0f / (top - bottom);
+	const float ifmn = 1.0f / (zFar - zNear);
+
+	return eoeMatrix4(eoeVec4(2.0f * irml, 0.0f, 0.0f, (right + left) * -irml),
+					  eoeVec4(0.0f, 2.0f * itmb, 0.0f, (top + bottom) * -itmb),
+					  eoeVec4(0.0f, 0.0f, -2.0f * ifmn, (zFar + zNear) * -ifmn),
+					  eoeVec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+//--------------------------
+// eoeMatrix4::GetTranslation
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline constexpr eoeMatrix4<layout> eoeMatrix4<layout>::GetTranslation(const eoeVec3 & translation) {
+	return eoeMatrix4(eoeVec4(1.0f, 0.0f, 0.0f, translation.x),
+					  eoeVec4(0.0f, 1.0f, 0.0f, translation.y),
+					  eoeVec4(0.0f, 0.0f, 1.0f, translation.z),
+					  eoeVec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+//--------------------------
+// eoeMatrix4::GetScale
+//--------------------------
+template<eoeMat4Layout_t layout>
+inline constexpr eoeMatrix4<layout> eoeMatrix4<layout>::GetScale(const eoeVec3 & scale) {
+	return eoeMatrix4(eoeVec4(scale.x, 0.0f, 0.0f, 0.0f),
+					  eoeVec4(0.0f, scale.y, 0.0f, 0.0f),
+					  eoeVec4(0.0f, 0.0f, scale.z, 0.0f),
+					  eoeVec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+//-----------------------------------
+//			eoeMat3x2
+//	 2D affine transform, 6 floats
+//  default ctor leaves it uninitialized
+// the 3x3 matrix [ xAxis yAxis translation ; 0 0 1 ] with its constant row dropped,
+// stored as its three columns, for column vectors (m * v) like eoeMatrix4
+// composes and transforms eoeVec2s in about a fifth of the eoeMat4 work,
+// expand with ToMat4 or ToMat4CM only where a 4x4 is actually needed, eg: uploading to GL
+//-----------------------------------
+class eoeMat3x2 {
+public:
+
+	eoeVec2							matrix[3];		// columns: x axis, y axis, translation
+
+									eoeMat3x2() = default;
+	explicit constexpr				eoeMat3x2(const eoeVec2 & xAxis, const eoeVec2 & yAxis, const eoeVec2 & translation);
+
+	constexpr eoeVec2 &				operator[](int index);
+	constexpr eoeVec2				operator[](int index) const;
+
+	eoeMat3x2						operator*(const eoeMat3x2 & a) const;
+	eoeVec2							operator*(const eoeVec2 & point) const;
+	eoeMat3x2 &						operator*=(const eoeMat3x2 & a);
+	eoeVec2							TransformDirection(const eoeVec2 & direction) const;
+	void							TransformPoints(eoeVec2 * dst, const eoeVec2 * src, const int count) const;
+
+	float							Determinant() const;
+	eoeMat3x2						Inverse() const;
+	bool							InverseSelf();
+
+	eoeMat4							ToMat4() const;
+	eoeMat4CM						ToMat4CM() const;
+
+	const float *					ToFloatPtr() const;
+	float *							ToFloatPtr();
+
+	static constexpr eoeMat3x2		GetIdentity();
+	static constexpr eoeMat3x2		GetTranslation(const eoeVec2 & translation);
+	static eoeMat3x2				GetRotation(const float degrees);
+	static constexpr eoeMat3x2		GetScale(const eoeVec2 & scale);
+	static eoeMat3x2				FromTRS(const eoeVec2 & translation, const float degrees, const eoeVec2 & scale);
+	static constexpr eoeMat3x2		GetOrthographicToIsometric();
+	static constexpr eoeMat3x2		GetIsometricToOrthographic();
+
+public:
+
+	static constexpr float			INVERSE_EPSILON = 1e-14f;		// smaller determinants are treated as singular
 };
 
-extern eoeMat4 mat4_identity;
-extern eoeMat4 mat4_zero;
+//--------------------------
+// eoeMat3x2::eoeMat3x2
+//--------------------------
+inline constexpr eoeMat3x2::eoeMat3x2(const eoeVec2 & xAxis, const eoeVec2 & yAxis, const eoeVec2 & translation)
+	: matrix{ xAxis, yAxis, translation } {
+}
+
+inline constexpr eoeMat3x2 mat3x2_identity(eoeVec2(1.0f, 0.0f), eoeVec2(0.0f, 1.0f), eoeVec2(0.0f, 0.0f));
+
+//--------------------------
+// eoeMat3x2::operator[]
+// returns the index-th column
+//--------------------------
+inline constexpr eoeVec2 & eoeMat3x2::operator[](int index) {
+	return matrix[index];
+}
+
+//--------------------------
+// eoeMat3x2::operator[]
+// returns a copy of the index-th column
+//--------------------------
+inline constexpr eoeVec2 eoeMat3x2::operator[](int index) const {
+	return matrix[index];
+}
+
+//--------------------------
+// eoeMat3x2::operator*
+// transforms point, translation included
+// the batch TransformPoints matches this bit-for-bit
+//--------------------------
+inline eoeVec2 eoeMat3x2::operator*(const eoeVec2 & point) const {
+	return eoeVec2(matrix[0].x * point.x + matrix[1].x * point.y + matrix[2].x,
+				   matrix[0].y * point.x + matrix[1].y * point.y + matrix[2].y);
+}
+
+//--------------------------
+// eoeMat3x2::TransformDirection
+// transforms direction, translation ignored
+//--------------------------
+inline eoeVec2 eoeMat3x2::TransformDirection(const eoeVec2 & direction) const {
+	return eoeVec2(matrix[0].x * direction.x + matrix[1].x * direction.y,
+				   matrix[0].y * direction.x + matrix[1].y * direction.y);
+}
+
+//--------------------------
+// eoeMat3x2::operator*
+// applies a first, then *this, like eoeMatrix4
+//--------------------------
+inline eoeMat3x2 eoeMat3x2::operator*(const eoeMat3x2 & a) const {
+	return eoeMat3x2(TransformDirection(a.matrix[0]), TransformDirection(a.matrix[1]), *this * a.matrix[2]);
+}
+
+//--------------------------
+// eoeMat3x2::operator*=
+//--------------------------
+inline eoeMat3x2 & eoeMat3x2::operator*=(const eoeMat3x2 & a) {
+	*this = *this * a;
+	return *this;
+}
+
+//--------------------------
+// eoeMat3x2::Determinant
+// of the 2x2 linear part, the signed area scale of the transform
+//--------------------------
+inline float eoeMat3x2::Determinant() const {
+	return matrix[0].x * matrix[1].y - matrix[1].x * matrix[0].y;
+}
+
+//--------------------------
+// eoeMat3x2::Inverse
+// returns the inverse, or *this unchanged if it is singular
+//--------------------------
+inline eoeMat3x2 eoeMat3x2::Inverse() const {
+	eoeMat3x2 result = *this;
+	result.InverseSelf();
+	return result;
+}
+
+//--------------------------
+// eoeMat3x2::ToFloatPtr
+// xAxis.x, xAxis.y, yAxis.x, yAxis.y, translation.x, translation.y
+//--------------------------
+inline const float * eoeMat3x2::ToFloatPtr() const {
+	return reinterpret_cast<const float *>(matrix);
+}
+
+//--------------------------
+// eoeMat3x2::ToFloatPtr
+//--------------------------
+inline float * eoeMat3x2::ToFloatPtr() {
+	return reinterpret_cast<float *>(matrix);
+}
+
+//--------------------------
+// eoeMat3x2::GetIdentity
+//--------------------------
+inline constexpr eoeMat3x2 eoeMat3x2::GetIdentity() {
+	return mat3x2_identity;
+}
+
+//--------------------------
+// eoeMat3x2::GetTranslation
+//--------------------------
+inline constexpr eoeMat3x2 eoeMat3x2::GetTranslation(const eoeVec2 & translation) {
+	return eoeMat3x2(eoeVec2(1.0f, 0.0f), eoeVec2(0.0f, 1.0f), translation);
+}
+
+//--------------------------
+// eoeMat3x2::GetScale
+//--------------------------
+inline constexpr eoeMat3x2 eoeMat3x2::GetScale(const eoeVec2 & scale) {
+	return eoeMat3x2(eoeVec2(scale.x, 0.0f), eoeVec2(0.0f, scale.y), eoeVec2(0.0f, 0.0f));
+}
+
+//--------------------------
+// eoeMat3x2::GetOrthographicToIsometric
+// same mapping as eoeMath::OrthographicToIsometric, as a matrix to compose with
+// eg: camera * eoeMat3x2::GetOrthographicToIsometric() * tileLocal
+// DEBUG: may round differently than eoeMath::OrthographicToIsometric in the last bit
+//--------------------------
+inline constexpr eoeMat3x2 eoeMat3x2::GetOrthographicToIsometric() {
+	return eoeMat3x2(eoeVec2(1.0f, 0.5f), eoeVec2(-1.0f, 0.5f), eoeVec2(0.0f, 0.0f));
+}
+
+//--------------------------
+// eoeMat3x2::GetIsometricToOrthographic
+// same mapping as eoeMath::IsometricToOrthographic, the inverse of GetOrthographicToIsometric
+//--------------------------
+inline constexpr eoeMat3x2 eoeMat3x2::GetIsometricToOrthographic() {
+	return eoeMat3x2(eoeVec2(0.5f, -0.5f), eoeVec2(1.0f, 1.0f), eoeVec2(0.0f, 0.0f));
+}
 
 #endif /* EOECORE_MATRIX_H */
\ No newline at end of file
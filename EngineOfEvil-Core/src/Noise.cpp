@@ -0,0 +1,188 @@
+#include <string.h>
+#include "Noise.h"
+#include "SIMD.h"
+#include "ThreadPool.h"
+
+//--------------------------
+// eoeNoise::Fbm
+// sums params.octaves layers of noise, normalized by the total amplitude
+// same operation order as the batch Fbm, so single samples match grid samples exactly
+//--------------------------
+float eoeNoise::Fbm(const eoeVec2 & point, const eoeNoiseParams & params) {
+	float sum = 0.0f;
+	float frequency = params.frequency;
+	float amplitude = 1.0f;
+	float amplitudeSum = 0.0f;
+	for (int octave = 0; octave < params.octaves; ++octave) {
+		const float x = point.x * frequency;
+		const float y = point.y * frequency;
+		const uint32_t seed = params.seed + (uint32_t)octave;
+		const float noise = params.type == NOISE_VALUE ? Value2D(x, y, seed) : Simplex2D(x, y, seed);
+		sum = sum + noise * amplitude;
+		amplitudeSum += amplitude;
+		amplitude *= params.gain;
+		frequency *= params.lacunarity;
+	}
+	return amplitudeSum > 0.0f ? sum * (1.0f / amplitudeSum) : 0.0f;
+}
+
+//--------------------------
+// eoeNoise::Fbm
+//--------------------------
+float eoeNoise::Fbm(const eoeVec3 & point, const eoeNoiseParams & params) {
+	float sum = 0.0f;
+	float frequency = params.frequency;
+	float amplitude = 1.0f;
+	float amplitudeSum = 0.0f;
+	for (int octave = 0; octave < params.octaves; ++octave) {
+		const float x = point.x * frequency;
+		const float y = point.y * frequency;
+		const float z = point.z * frequency;
+		const uint32_t seed = params.seed + (uint32_t)octave;
+		const float noise = params.type == NOISE_VALUE ? Value3D(x, y, z, seed) : Simplex3D(x, y, z, seed);
+		sum = sum + noise * amplitude;
+		amplitudeSum += amplitude;
+		amplitude *= params.gain;
+		frequency *= params.lacunarity;
+	}
+	return amplitudeSum > 0.0f ? sum * (1.0f / amplitudeSum) : 0.0f;
+}
+
+//--------------------------
+// eoeNoise::Evaluate
+// dst[i] = one octave of type noise at (x[i], y[i])
+//--------------------------
+void eoeNoise::Evaluate(float * dst, const float * x, const float * y, const int count, const eoeNoiseType_t type, const uint32_t seed) {
+	if (type == NOISE_VALUE)
+		EVIL_SIMD->Noise_Value2D(dst, x, y, count, seed);
+	else
+		EVIL_SIMD->Noise_Simplex2D(dst, x, y, count, seed);
+}
+
+//--------------------------
+// eoeNoise::Evaluate
+// dst[i] = one octave of type noise at (x[i], y[i], z[i])
+//--------------------------
+void eoeNoise::Evaluate(float * dst, const float * x, const float * y, const float * z, const int count, const eoeNoiseType_t type, const uint32_t seed) {
+	if (type == NOISE_VALUE)
+		EVIL_SIMD->Noise_Value3D(dst, x, y, z, count, seed);
+	else
+		EVIL_SIMD->Noise_Simplex3D(dst, x, y, z, count, seed);
+}
+
+//--------------------------
+// eoeNoise::Fbm
+// dst[i] = Fbm((x[i], y[i]), params), octave by octave over blocks of points
+// so every kernel call runs a full block through the widest SIMD path
+//--------------------------
+void eoeNoise::Fbm(float * dst, const float * x, const float * y, const int count, const eoeNoiseParams & params) {
+	float octaveX[BLOCK_SIZE];
+	float octaveY[BLOCK_SIZE];
+	float noise[BLOCK_SIZE];
+
+	float amplitudeSum = 0.0f;
+	float amplitude = 1.0f;
+	for (int octave = 0; octave < params.octaves; ++octave) {
+		amplitudeSum += amplitude;
+		amplitude *= params.gain;
+	}
+
+	for (int done = 0; done < count; done += BLOCK_SIZE) {
+		const int num = count - done < BLOCK_SIZE ? count - done : BLOCK_SIZE;
+		float * sum = dst + done;
+		memset(sum, 0, num * sizeof(float));
+
+		float frequency = params.frequency;
+		amplitude = 1.0f;
+		for (int octave = 0; octave < params.octaves; ++octave) {
+			EVIL_SIMD->Float_Scale(octaveX, x + done, frequency, num);
+			EVIL_SIMD->Float_Scale(octaveY, y + done, frequency, num);
+			Evaluate(noise, octaveX, octaveY, num, params.type, params.seed + (uint32_t)octave);
+			EVIL_SIMD->Float_MultiplyAdd(sum, sum, noise, amplitude, num);
+			amplitude *= params.gain;
+			frequency *= params.lacunarity;
+		}
+
+		if (amplitudeSum > 0.0f)
+			EVIL_SIMD->Float_Scale(sum, sum, 1.0f / amplitudeSum, num);
+	}
+}
+
+//--------------------------
+// eoeNoise::Fbm
+// dst[i] = Fbm((x[i], y[i], z[i]), params)
+//--------------------------
+void eoeNoise::Fbm(float * dst, const float * x, const float * y, const float * z, const int count, const eoeNoiseParams & params) {
+	float octaveX[BLOCK_SIZE];
+	float octaveY[BLOCK_SIZE];
+	float octaveZ[BLOCK_SIZE];
+	float noise[BLOCK_SIZE];
+
+	float amplitudeSum = 0.0f;
+	float amplitude = 1.0f;
+	for (int octave = 0; octave < params.octaves; ++octave) {
+		amplitudeSum += amplitude;
+		amplitude *= params.gain;
+	}
+
+	for (int done = 0; done < count; done += BLOCK_SIZE) {
+		const int num = count - done < BLOCK_SIZE ? count - done : BLOCK_SIZE;
+		float * sum = dst + done;
+		memset(sum, 0, num * sizeof(float));
+
+		float frequency = params.frequency;
+		amplitude = 1.0f;
+		for (int octave = 0; octave < params.octaves; ++octave) {
+			EVIL_SIMD->Float_Scale(octaveX, x + done, frequency, num);
+			EVIL_SIMD->Float_Scale(octaveY, y + done, frequency, num);
+			EVIL_SIMD->Float_Scale(octaveZ, z + done, frequency, num);
+			Evaluate(noise, octaveX, octaveY, octaveZ, num, params.type, params.seed + (uint32_t)octave);
+			EVIL_SIMD->Float_MultiplyAdd(sum, sum, noise, amplitude, num);
+			amplitude *= params.gain;
+			frequency *= params.lacunarity;
+		}
+
+		if (amplitudeSum > 0.0f)
+			EVIL_SIMD->Float_Scale(sum, sum, 1.0f / amplitudeSum, num);
+	}
+}
+
+//--------------------------
+// eoeNoise::FbmGrid
+// row-major width x height samples, dst[row * width + col] = Fbm(origin + (col, row) * step, params)
+// eg: one value per tile of a map chunk, with origin at the chunk's first tile
+//--------------------------
+void eoeNoise::FbmGrid(float * dst, const int width, const int height, const eoeVec2 & origin, const float step, const eoeNoiseParams & params) {
+	float x[BLOCK_SIZE];
+	float y[BLOCK_SIZE];
+
+	const int count = width * height;
+	for (int done = 0; done < count; done += BLOCK_SIZE) {
+		const int num = count - done < BLOCK_SIZE ? count - done : BLOCK_SIZE;
+		int row = done / width;
+		int col = done - row * width;
+		for (int i = 0; i < num; ++i) {
+			x[i] = origin.x + (float)col * step;
+			y[i] = origin.y + (float)row * step;
+			if (++col == width) {
+				col = 0;
+				++row;
+			}
+		}
+		Fbm(dst + done, x, y, num, params);
+	}
+}
+
+//--------------------------
+// eoeNoise::FbmChunks
+// numChunks square chunkSize grids, chunk c written to dst + c * chunkSize * chunkSize
+// chunks are split across EVIL_THREADS, each is computed whole by one thread,
+// so the output does not depend on the number of threads or on scheduling
+//--------------------------
+void eoeNoise::FbmChunks(float * dst, const eoeVec2 * chunkOrigins, const int numChunks, const int chunkSize, const float step, const eoeNoiseParams & params) {
+	const int chunkArea = chunkSize * chunkSize;
+	EVIL_THREADS.ParallelFor(numChunks, [=, &params](int begin, int end) {
+		for (int chunk = begin; chunk < end; ++chunk)
+			FbmGrid(dst + chunk * chunkArea, chunkSize, chunkSize, chunkOrigins[chunk], step, params);
+	});
+}
@@ -0,0 +1,328 @@
+#ifndef EOECORE_NOISE_H
+#define EOECORE_NOISE_H
+
+#include <stdint.h>
+#include "Vector.h"
+
+enum eoeNoiseType_t {
+	NOISE_VALUE,			// smoothly interpolated random lattice values, blocky
+	NOISE_SIMPLEX			// gradient noise on a simplex grid, isotropic
+};
+
+//--------------------------------------------
+//			eoeNoiseParams
+// fractal brownian motion settings,
+// octave o samples at frequency * lacunarity^o
+// with amplitude gain^o and seed + o
+//--------------------------------------------
+struct eoeNoiseParams {
+	eoeNoiseType_t			type		= NOISE_SIMPLEX;
+	uint32_t				seed		= 0;
+	int						octaves		= 4;
+	float					frequency	= 1.0f;
+	float					lacunarity	= 2.0f;
+	float					gain		= 0.5f;
+};
+
+//--------------------------------------------
+//
+//
+//				eoeNoise
+//	   --seeded 2D/3D value and simplex noise--
+//
+//
+// lattice points are hashed from their integer coordinates and the seed
+// instead of looked up in a permutation table, so there is no state,
+// no table to share between threads, and the SIMD kernels need no gathers
+// results are in roughly [-1, 1] and identical on every processor for a given seed
+// batch entry points go through EVIL_SIMD, FbmChunks also through EVIL_THREADS
+// DEBUG: coordinates must stay within int range, precision fades well before that
+//--------------------------------------------
+class eoeNoise {
+public:
+
+	static float				Value(const eoeVec2 & point, const uint32_t seed);
+	static float				Value(const eoeVec3 & point, const uint32_t seed);
+	static float				Simplex(const eoeVec2 & point, const uint32_t seed);
+	static float				Simplex(const eoeVec3 & point, const uint32_t seed);
+	static float				Fbm(const eoeVec2 & point, const eoeNoiseParams & params);
+	static float				Fbm(const eoeVec3 & point, const eoeNoiseParams & params);
+
+	static void					Evaluate(float * dst, const float * x, const float * y, const int count, const eoeNoiseType_t type, const uint32_t seed);
+	static void					Evaluate(float * dst, const float * x, const float * y, const float * z, const int count, const eoeNoiseType_t type, const uint32_t seed);
+	static void					Fbm(float * dst, const float * x, const float * y, const int count, const eoeNoiseParams & params);
+	static void					Fbm(float * dst, const float * x, const float * y, const float * z, const int count, const eoeNoiseParams & params);
+	static void					FbmGrid(float * dst, const int width, const int height, const eoeVec2 & origin, const float step, const eoeNoiseParams & params);
+	static void					FbmChunks(float * dst, const eoeVec2 * chunkOrigins, const int numChunks, const int chunkSize, const float step, const eoeNoiseParams & params);
+
+	// the algorithms themselves, shared with the eoeSIMD_Generic kernels
+	static float				Value2D(const float x, const float y, const uint32_t seed);
+	static float				Value3D(const float x, const float y, const float z, const uint32_t seed);
+	static float				Simplex2D(const float x, const float y, const uint32_t seed);
+	static float				Simplex3D(const float x, const float y, const float z, const uint32_t seed);
+
+	static int					Floor(const float x);
+	static uint32_t				Hash(const int x, const int y, const uint32_t seed);
+	static uint32_t				Hash(const int x, const int y, const int z, const uint32_t seed);
+	static uint32_t				Mix(uint32_t hash);
+	static float				HashToFloat(const uint32_t hash);
+	static float				Fade(const float t);
+	static float				Lerp(const float a, const float b, const float t);
+	static float				Gradient(const uint32_t hash, const float x, const float y);
+	static float				Gradient(const uint32_t hash, const float x, const float y, const float z);
+	static float				Falloff(const float radiusSquared, const float x, const float y);
+	static float				Falloff(const float radiusSquared, const float x, const float y, const float z);
+
+public:
+
+	static constexpr uint32_t	HASH_X			= 0x8da6b343;		// odd multipliers spreading each axis across all 32 bits
+	static constexpr uint32_t	HASH_Y			= 0xd8163841;
+	static constexpr uint32_t	HASH_Z			= 0xcb1ab31f;
+	static constexpr uint32_t	MIX_0			= 0x7feb352d;		// lowbias32 finalizer
+	static constexpr uint32_t	MIX_1			= 0x846ca68b;
+
+	static constexpr float		SKEW_2D			= 0.36602540378f;	// (sqrt(3) - 1) / 2
+	static constexpr float		UNSKEW_2D		= 0.21132486540f;	// (3 - sqrt(3)) / 6
+	static constexpr float		UNSKEW_2D_2		= 2.0f * UNSKEW_2D;
+	static constexpr float		SKEW_3D			= 1.0f / 3.0f;
+	static constexpr float		UNSKEW_3D		= 1.0f / 6.0f;
+	static constexpr float		UNSKEW_3D_2		= 2.0f * UNSKEW_3D;
+	static constexpr float		UNSKEW_3D_3		= 3.0f * UNSKEW_3D;
+	static constexpr float		RADIUS_SQUARED	= 0.5f;				// kernel support, contributions reach zero before the next simplex
+	static constexpr float		SCALE_2D		= 45.0f;			// measured peaks of the raw sums, brings them to about +-1
+	static constexpr float		SCALE_3D		= 76.0f;
+
+private:
+
+	static constexpr int		BLOCK_SIZE		= 256;				// points per batch pass, scratch lives on the stack
+};
+
+//--------------------------
+// eoeNoise::Floor
+//--------------------------
+inline int eoeNoise::Floor(const float x) {
+	const int truncated = (int)x;
+	return (float)truncated > x ? truncated - 1 : truncated;
+}
+
+//--------------------------
+// eoeNoise::Mix
+//--------------------------
+inline uint32_t eoeNoise::Mix(uint32_t hash) {
+	hash ^= hash >> 16;
+	hash *= MIX_0;
+	hash ^= hash >> 15;
+	hash *= MIX_1;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+//--------------------------
+// eoeNoise::Hash
+//--------------------------
+inline uint32_t eoeNoise::Hash(const int x, const int y, const uint32_t seed) {
+	return Mix(seed ^ ((uint32_t)x * HASH_X) ^ ((uint32_t)y * HASH_Y));
+}
+
+//--------------------------
+// eoeNoise::Hash
+//--------------------------
+inline uint32_t eoeNoise::Hash(const int x, const int y, const int z, const uint32_t seed) {
+	return Mix(seed ^ ((uint32_t)x * HASH_X) ^ ((uint32_t)y * HASH_Y) ^ ((uint32_t)z * HASH_Z));
+}
+
+//--------------------------
+// eoeNoise::HashToFloat
+// the high 24 bits mapped onto [-1, 1)
+//--------------------------
+inline float eoeNoise::HashToFloat(const uint32_t hash) {
+	return (float)(int)(hash >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+//--------------------------
+// eoeNoise::Fade
+// 6t^5 - 15t^4 + 10t^3, flat first and second derivatives at 0 and 1
+//--------------------------
+inline float eoeNoise::Fade(const float t) {
+	return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+}
+
+//--------------------------
+// eoeNoise::Lerp
+//--------------------------
+inline float eoeNoise::Lerp(const float a, const float b, const float t) {
+	return a + (b - a) * t;
+}
+
+//--------------------------
+// eoeNoise::Gradient
+// dot of (x, y) with one of the 8 directions (+-1, +-2), (+-2, +-1)
+//--------------------------
+inline float eoeNoise::Gradient(const uint32_t hash, const float x, const float y) {
+	const float u = (hash & 4) ? y : x;
+	const float v = (hash & 4) ? x : y;
+	return ((hash & 1) ? -u : u) + ((hash & 2) ? -2.0f * v : 2.0f * v);
+}
+
+//--------------------------
+// eoeNoise::Gradient
+// dot of (x, y, z) with one of the 12 cube edge directions, 4 of them repeated
+//--------------------------
+inline float eoeNoise::Gradient(const uint32_t hash, const float x, const float y, const float z) {
+	const uint32_t edge = hash & 15;
+	const float u = edge < 8 ? x : y;
+	const float v = edge < 4 ? y : (edge == 12 || edge == 14 ? x : z);
+	return ((edge & 1) ? -u : u) + ((edge & 2) ? -v : v);
+}
+
+//--------------------------
+// eoeNoise::Falloff
+// (r^2 - |offset|^2)^4 clamped at zero, the weight of one simplex corner
+//--------------------------
+inline float eoeNoise::Falloff(const float radiusSquared, const float x, const float y) {
+	float t = radiusSquared - x * x - y * y;
+	t = t > 0.0f ? t : 0.0f;
+	t = t * t;
+	return t * t;
+}
+
+//--------------------------
+// eoeNoise::Falloff
+//--------------------------
+inline float eoeNoise::Falloff(const float radiusSquared, const float x, const float y, const float z) {
+	float t = radiusSquared - x * x - y * y - z * z;
+	t = t > 0.0f ? t : 0.0f;
+	t = t * t;
+	return t * t;
+}
+
+//--------------------------
+// eoeNoise::Value2D
+//--------------------------
+inline float eoeNoise::Value2D(const float x, const float y, const uint32_t seed) {
+	const int ix = Floor(x);
+	const int iy = Floor(y);
+	const float u = Fade(x - (float)ix);
+	const float v = Fade(y - (float)iy);
+
+	const float bottom = Lerp(HashToFloat(Hash(ix, iy, seed)), HashToFloat(Hash(ix + 1, iy, seed)), u);
+	const float top = Lerp(HashToFloat(Hash(ix, iy + 1, seed)), HashToFloat(Hash(ix + 1, iy + 1, seed)), u);
+	return Lerp(bottom, top, v);
+}
+
+//--------------------------
+// eoeNoise::Value3D
+//--------------------------
+inline float eoeNoise::Value3D(const float x, const float y, const float z, const uint32_t seed) {
+	const int ix = Floor(x);
+	const int iy = Floor(y);
+	const int iz = Floor(z);
+	const float u = Fade(x - (float)ix);
+	const float v = Fade(y - (float)iy);
+	const float w = Fade(z - (float)iz);
+
+	const float nearBottom = Lerp(HashToFloat(Hash(ix, iy, iz, seed)), HashToFloat(Hash(ix + 1, iy, iz, seed)), u);
+	const float nearTop = Lerp(HashToFloat(Hash(ix, iy + 1, iz, seed)), HashToFloat(Hash(ix + 1, iy + 1, iz, seed)), u);
+	const float farBottom = Lerp(HashToFloat(Hash(ix, iy, iz + 1, seed)), HashToFloat(Hash(ix + 1, iy, iz + 1, seed)), u);
+	const float farTop = Lerp(HashToFloat(Hash(ix, iy + 1, iz + 1, seed)), HashToFloat(Hash(ix + 1, iy + 1, iz + 1, seed)), u);
+	return Lerp(Lerp(nearBottom, nearTop, v), Lerp(farBottom, farTop, v), w);
+}
+
+//--------------------------
+// eoeNoise::Simplex2D
+// sums the three corners of the skewed-grid triangle containing (x, y)
+//--------------------------
+inline float eoeNoise::Simplex2D(const float x, const float y, const uint32_t seed) {
+	const float skew = (x + y) * SKEW_2D;
+	const int i = Floor(x + skew);
+	const int j = Floor(y + skew);
+	const float unskew = (float)(i + j) * UNSKEW_2D;
+	const float x0 = x - ((float)i - unskew);
+	const float y0 = y - ((float)j - unskew);
+
+	// lower or upper triangle of the cell
+	const int i1 = x0 > y0 ? 1 : 0;
+	const int j1 = 1 - i1;
+
+	const float x1 = (x0 - (float)i1) + UNSKEW_2D;
+	const float y1 = (y0 - (float)j1) + UNSKEW_2D;
+	const float x2 = (x0 - 1.0f) + UNSKEW_2D_2;
+	const float y2 = (y0 - 1.0f) + UNSKEW_2D_2;
+
+	const float n0 = Falloff(RADIUS_SQUARED, x0, y0) * Gradient(Hash(i, j, seed), x0, y0);
+	const float n1 = Falloff(RADIUS_SQUARED, x1, y1) * Gradient(Hash(i + i1, j + j1, seed), x1, y1);
+	const float n2 = Falloff(RADIUS_SQUARED, x2, y2) * Gradient(Hash(i + 1, j + 1, seed), x2, y2);
+	return (n0 + n1 + n2) * SCALE_2D;
+}
+
+//--------------------------
+// eoeNoise::Simplex3D
+// sums the four corners of the skewed-grid tetrahedron containing (x, y, z),
+// the corner ordering is picked branchlessly so the SIMD kernels can follow it exactly
+//--------------------------
+inline float eoeNoise::Simplex3D(const float x, const float y, const float z, const uint32_t seed) {
+	const float skew = (x + y + z) * SKEW_3D;
+	const int i = Floor(x + skew);
+	const int j = Floor(y + skew);
+	const int k = Floor(z + skew);
+	const float unskew = (float)(i + j + k) * UNSKEW_3D;
+	const float x0 = x - ((float)i - unskew);
+	const float y0 = y - ((float)j - unskew);
+	const float z0 = z - ((float)k - unskew);
+
+	const bool xy = x0 >= y0;
+	const bool xz = x0 >= z0;
+	const bool yz = y0 >= z0;
+	const int i1 = xy && xz;
+	const int j1 = !xy && yz;
+	const int k1 = !xz && !yz;
+	const int i2 = xy || xz;
+	const int j2 = !xy || yz;
+	const int k2 = !(xz && yz);
+
+	const float x1 = (x0 - (float)i1) + UNSKEW_3D;
+	const float y1 = (y0 - (float)j1) + UNSKEW_3D;
+	const float z1 = (z0 - (float)k1) + UNSKEW_3D;
+	const float x2 = (x0 - (float)i2) + UNSKEW_3D_2;
+	const float y2 = (y0 - (float)j2) + UNSKEW_3D_2;
+	const float z2 = (z0 - (float)k2) + UNSKEW_3D_2;
+	const float x3 = (x0 - 1.0f) + UNSKEW_3D_3;
+	const float y3 = (y0 - 1.0f) + UNSKEW_3D_3;
+	const float z3 = (z0 - 1.0f) + UNSKEW_3D_3;
+
+	const float n0 = Falloff(RADIUS_SQUARED, x0, y0, z0) * Gradient(Hash(i, j, k, seed), x0, y0, z0);
+	const float n1 = Falloff(RADIUS_SQUARED, x1, y1, z1) * Gradient(Hash(i + i1, j + j1, k + k1, seed), x1, y1, z1);
+	const float n2 = Falloff(RADIUS_SQUARED, x2, y2, z2) * Gradient(Hash(i + i2, j + j2, k + k2, seed), x2, y2, z2);
+	const float n3 = Falloff(RADIUS_SQUARED, x3, y3, z3) * Gradient(Hash(i + 1, j + 1, k + 1, seed), x3, y3, z3);
+	return (n0 + n1 + n2 + n3) * SCALE_3D;
+}
+
+//--------------------------
+// eoeNoise::Value
+//--------------------------
+inline float eoeNoise::Value(const eoeVec2 & point, const uint32_t seed) {
+	return Value2D(point.x, point.y, seed);
+}
+
+//--------------------------
+// eoeNoise::Value
+//--------------------------
+inline float eoeNoise::Value(const eoeVec3 & point, const uint32_t seed) {
+	return Value3D(point.x, point.y, point.z, seed);
+}
+
+//--------------------------
+// eoeNoise::Simplex
+//--------------------------
+inline float eoeNoise::Simplex(const eoeVec2 & point, const uint32_t seed) {
+	return Simplex2D(point.x, point.y, seed);
+}
+
+//--------------------------
+// eoeNoise::Simplex
+//--------------------------
+inline float eoeNoise::Simplex(const eoeVec3 & point, const uint32_t seed) {
+	return Simplex3D(point.x, point.y, point.z, seed);
+}
+
+#endif /* EOECORE_NOISE_H */
@@ -0,0 +1,375 @@
+#include "Pathfinder.h"
+#include "ThreadPool.h"
+
+//-------------------------
+// eoePathfinder::eoePathfinder
+//-------------------------
+eoePathfinder::eoePathfinder(const uint8_t * costs, const int width, const int height) {
+	SetGrid(costs, width, height);
+}
+
+//-------------------------
+// eoePathfinder::SetGrid
+// costs is width * height tiles, row-major, and must outlive every search
+// pooled search state is resized by the next search if the tile count changed
+//-------------------------
+void eoePathfinder::SetGrid(const uint8_t * costs, const int width, const int height) {
+	this->costs = costs;
+	this->width = width;
+	this->height = height;
+}
+
+//-------------------------
+// eoePathfinder::FindPath
+// writes up to maxPath tiles of the cheapest path, start first and goal last, to path
+// returns the number of tiles in the whole path, which may exceed maxPath,
+// or 0 if goal cannot be reached
+//-------------------------
+int eoePathfinder::FindPath(eoeVec2i * path, const int maxPath, const eoeVec2i & start, const eoeVec2i & goal,
+							const eoePathHeuristic_t heuristic, const eoePathSearch_t search) {
+	search_t & state = AcquireSearch();
+	const int length = Search(state, path, maxPath, start, goal, heuristic, search);
+	ReleaseSearch(state);
+	return length;
+}
+
+//-------------------------
+// eoePathfinder::FindPaths
+// finds the path from starts[i] to goals[i] for count paths, writing up to maxPath tiles
+// of each to paths + i * maxPath and its FindPath result to pathLengths[i]
+// batches are split across EVIL_THREADS
+//-------------------------
+void eoePathfinder::FindPaths(int * pathLengths, eoeVec2i * paths, const int maxPath, const eoeVec2i * starts, const eoeVec2i * goals, const int count,
+							  const eoePathHeuristic_t heuristic, const eoePathSearch_t search) {
+	EVIL_THREADS.ParallelFor(count, [=](int begin, int end) {
+		search_t & state = AcquireSearch();
+		for (int i = begin; i < end; ++i)
+			pathLengths[i] = Search(state, paths + i * maxPath, maxPath, starts[i], goals[i], heuristic, search);
+		ReleaseSearch(state);
+	}, MIN_PATH_BATCH);
+}
+
+//-------------------------
+// eoePathfinder::AcquireSearch
+// returns an idle search state, adding one only when every state is in use
+//-------------------------
+eoePathfinder::search_t & eoePathfinder::AcquireSearch() {
+	std::lock_guard<std::mutex> lock(searchMutex);
+	if (freeSearches.empty()) {
+		searches.emplace_back();
+		return searches.back();
+	}
+
+	search_t & search = *freeSearches.back();
+	freeSearches.pop_back();
+	return search;
+}
+
+//-------------------------
+// eoePathfinder::ReleaseSearch
+//-------------------------
+void eoePathfinder::ReleaseSearch(search_t & search) {
+	std::lock_guard<std::mutex> lock(searchMutex);
+	freeSearches.push_back(&search);
+}
+
+//-------------------------
+// eoePathfinder::Search
+// A* from start to goal, expanding either every open neighbor or, for
+// PATH_JUMP_POINT, only the jump points reached along the pruned directions
+// tiles left by earlier searches are told apart by their generation,
+// and the heuristics are consistent, so an expanded tile is never reopened
+//-------------------------
+int eoePathfinder::Search(search_t & search, eoeVec2i * path, const int maxPath, const eoeVec2i & start, const eoeVec2i & goal,
+						  const eoePathHeuristic_t heuristic, const eoePathSearch_t searchType) const {
+	std::vector<node_t> & nodes = search.nodes;
+	if ((int)nodes.size() != width * height) {
+		nodes.assign(width * height, node_t{ 0.0f, -1, CLOSED, 0 });
+		search.generation = 0;
+	}
+
+	if (++search.generation == 0) {
+		for (node_t & node : nodes)
+			node.generation = 0;
+		search.generation = 1;
+	}
+	search.heap.clear();
+
+	if (!IsOpen(start.x, start.y) || !IsOpen(goal.x, goal.y))
+		return 0;
+
+	const uint32_t generation = search.generation;
+	const int startIndex = start.y * width + start.x;
+	const int goalIndex = goal.y * width + goal.x;
+	nodes[startIndex] = node_t{ 0.0f, -1, 0, generation };
+	PushOpen(search, open_t{ Distance(heuristic, start, goal), 0.0f, startIndex });
+
+	bool found = false;
+	while (!search.heap.empty()) {
+		const open_t current = PopOpen(search);
+		if (current.node == goalIndex) {
+			found = true;
+			break;
+		}
+
+		const int x = current.node % width;
+		const int y = current.node / width;
+
+		// opens or improves tile at cost g through current
+		const auto relax = [&](const int tile, const float g) {
+			node_t & next = nodes[tile];
+			if (next.generation != generation) {
+				next = node_t{ g, current.node, 0, generation };
+				PushOpen(search, open_t{ g + Distance(heuristic, eoeVec2i(tile % width, tile / width), goal), g, tile });
+			} else if (next.heapIndex != CLOSED && g < next.g) {
+				open_t & entry = search.heap[next.heapIndex];
+				entry.f += g - next.g;
+				entry.g = g;
+				next.g = g;
+				next.parent = current.node;
+				SiftUp(search, next.heapIndex);
+			}
+		};
+
+		if (searchType == PATH_ASTAR) {
+			for (int dy = -1; dy <= 1; ++dy) {
+				for (int dx = -1; dx <= 1; ++dx) {
+					if ((dx == 0 && dy == 0) || !IsOpen(x + dx, y + dy))
+						continue;
+
+					if (dx != 0 && dy != 0 && (!IsOpen(x + dx, y) || !IsOpen(x, y + dy)))
+						continue;
+
+					const int tile = current.node + dy * width + dx;
+					relax(tile, current.g + MoveCost(heuristic, dx, dy) * (float)costs[tile]);
+				}
+			}
+			continue;
+		}
+
+		// the start jumps every way, later jump points only continue
+		// their parent's direction and turn where a blocked tile forced it
+		int directions[8][2];
+		int numDirections = 0;
+		const int parent = nodes[current.node].parent;
+		if (parent < 0) {
+			for (int dy = -1; dy <= 1; ++dy) {
+				for (int dx = -1; dx <= 1; ++dx) {
+					if (dx != 0 || dy != 0) {
+						directions[numDirections][0] = dx;
+						directions[numDirections++][1] = dy;
+					}
+				}
+			}
+		} else {
+			const int parentX = parent % width;
+			const int parentY = parent / width;
+			const int dx = (x > parentX) - (x < parentX);
+			const int dy = (y > parentY) - (y < parentY);
+			if (dx != 0 && dy != 0) {
+				// diagonal: both of its straight parts and itself
+				const int diagonal[3][2] = { { dx, dy }, { dx, 0 }, { 0, dy } };
+				for (int i = 0; i < 3; ++i) {
+					directions[numDirections][0] = diagonal[i][0];
+					directions[numDirections++][1] = diagonal[i][1];
+				}
+			} else {
+				// straight: onward, both sides, and the diagonals between them
+				const int sideX = dy != 0;
+				const int sideY = dx != 0;
+				const int straight[5][2] = {
+					{ dx, dy },
+					{ sideX, sideY },
+					{ -sideX, -sideY },
+					{ dx + sideX, dy + sideY },
+					{ dx - sideX, dy - sideY }
+				};
+				for (int i = 0; i < 5; ++i) {
+					directions[numDirections][0] = straight[i][0];
+					directions[numDirections++][1] = straight[i][1];
+				}
+			}
+		}
+
+		for (int i = 0; i < numDirections; ++i) {
+			const int dx = directions[i][0];
+			const int dy = directions[i][1];
+			int jumpPoint;
+			if (dx != 0 && dy != 0) {
+				if (!IsOpen(x + dx, y) || !IsOpen(x, y + dy))
+					continue;
+				jumpPoint = JumpDiagonal(x + dx, y + dy, dx, dy, goalIndex);
+			} else {
+				jumpPoint = JumpStraight(x + dx, y + dy, dx, dy, goalIndex);
+			}
+
+			if (jumpPoint < 0)
+				continue;
+
+			const int stepsX = abs(jumpPoint % width - x);
+			const int stepsY = abs(jumpPoint / width - y);
+			relax(jumpPoint, current.g + MoveCost(heuristic, dx, dy) * (float)(stepsX > stepsY ? stepsX : stepsY));
+		}
+	}
+
+	if (!found)
+		return 0;
+
+	// jump points may be several tiles apart, so count every tile between them first
+	int length = 1;
+	for (int tile = goalIndex; nodes[tile].parent >= 0; tile = nodes[tile].parent) {
+		const int parent = nodes[tile].parent;
+		const int stepsX = abs(tile % width - parent % width);
+		const int stepsY = abs(tile / width - parent / width);
+		length += stepsX > stepsY ? stepsX : stepsY;
+	}
+
+	int index = length - 1;
+	for (int tile = goalIndex; tile >= 0; tile = nodes[tile].parent) {
+		eoeVec2i cell(tile % width, tile / width);
+		const int parent = nodes[tile].parent;
+		if (parent < 0) {
+			if (index < maxPath)
+				path[index] = cell;
+			break;
+		}
+
+		const eoeVec2i parentCell(parent % width, parent / width);
+		const eoeVec2i step((parentCell.x > cell.x) - (parentCell.x < cell.x), (parentCell.y > cell.y) - (parentCell.y < cell.y));
+		for (; cell != parentCell; cell += step, --index) {
+			if (index < maxPath)
+				path[index] = cell;
+		}
+	}
+	return length;
+}
+
+//-------------------------
+// eoePathfinder::JumpStraight
+// walks from (x, y) along (dx, dy), one of them 0, and returns the first tile
+// that is the goal or has an open side tile reachable only through it,
+// or -1 if a blocked tile or the grid's edge comes first
+//-------------------------
+int eoePathfinder::JumpStraight(int x, int y, const int dx, const int dy, const int goal) const {
+	for (;; x += dx, y += dy) {
+		if (!IsOpen(x, y))
+			return -1;
+
+		const int tile = y * width + x;
+		if (tile == goal)
+			return tile;
+
+		if (dx != 0) {
+			if ((IsOpen(x, y - 1) && !IsOpen(x - dx, y - 1)) || (IsOpen(x, y + 1) && !IsOpen(x - dx, y + 1)))
+				return tile;
+		} else {
+			if ((IsOpen(x - 1, y) && !IsOpen(x - 1, y - dy)) || (IsOpen(x + 1, y) && !IsOpen(x + 1, y - dy)))
+				return tile;
+		}
+	}
+}
+
+//-------------------------
+// eoePathfinder::JumpDiagonal
+// walks from (x, y) along the diagonal (dx, dy) and returns the first tile
+// that is the goal or from which either straight part of the diagonal finds a jump point,
+// or -1 if a blocked tile, a corner it may not cut, or the grid's edge comes first
+//-------------------------
+int eoePathfinder::JumpDiagonal(int x, int y, const int dx, const int dy, const int goal) const {
+	for (;; x += dx, y += dy) {
+		if (!IsOpen(x, y))
+			return -1;
+
+		const int tile = y * width + x;
+		if (tile == goal || JumpStraight(x + dx, y, dx, 0, goal) >= 0 || JumpStraight(x, y + dy, 0, dy, goal) >= 0)
+			return tile;
+
+		if (!IsOpen(x + dx, y) || !IsOpen(x, y + dy))
+			return -1;
+	}
+}
+
+//-------------------------
+// eoePathfinder::PushOpen
+//-------------------------
+void eoePathfinder::PushOpen(search_t & search, const open_t & entry) {
+	search.heap.push_back(entry);
+	SiftUp(search, (int)search.heap.size() - 1);
+}
+
+//-------------------------
+// eoePathfinder::PopOpen
+// removes and returns the entry with the lowest f, the highest g among equals,
+// and closes its tile
+//-------------------------
+eoePathfinder::open_t eoePathfinder::PopOpen(search_t & search) {
+	std::vector<open_t> & heap = search.heap;
+	const open_t top = heap[0];
+	search.nodes[top.node].heapIndex = CLOSED;
+
+	const open_t last = heap.back();
+	heap.pop_back();
+	const int size = (int)heap.size();
+	if (size == 0)
+		return top;
+
+	int index = 0;
+	for (;;) {
+		int child = 2 * index + 1;
+		if (child >= size)
+			break;
+
+		if (child + 1 < size && (heap[child + 1].f < heap[child].f || (heap[child + 1].f == heap[child].f && heap[child + 1].g > heap[child].g)))
+			++child;
+
+		if (last.f < heap[child].f || (last.f == heap[child].f && last.g >= heap[child].g))
+			break;
+
+		heap[index] = heap[child];
+		search.nodes[heap[index].node].heapIndex = index;
+		index = child;
+	}
+	heap[index] = last;
+	search.nodes[last.node].heapIndex = index;
+	return top;
+}
+
+//-------------------------
+// eoePathfinder::SiftUp
+// moves the entry at index toward the root until its parent orders before it
+//-------------------------
+void eoePathfinder::SiftUp(search_t & search, int index) {
+	std::vector<open_t> & heap = search.heap;
+	const open_t entry = heap[index];
+	while (index > 0) {
+		const int parent = (index - 1) >> 1;
+		if (heap[parent].f < entry.f || (heap[parent].f == entry.f && heap[parent].g >= entry.g))
+			break;
+
+		heap[index] = heap[parent];
+		search.nodes[heap[index].node].heapIndex = index;
+		index = parent;
+	}
+	heap[index] = entry;
+	search.nodes[entry.node].heapIndex = index;
+}
+
+//-------------------------
+// eoePathfinder::MoveCost
+// returns the cost of one move of (dx, dy) onto a cost 1 tile
+//-------------------------
+float eoePathfinder::MoveCost(const eoePathHeuristic_t heuristic, const int dx, const int dy) {
+	if (heuristic == PATH_ISOMETRIC) {
+		if (dx == 0 || dy == 0)
+			return 1.11803399f;
+		return dx == dy ? 1.0f : 2.0f;
+	}
+	return (dx == 0 || dy == 0) ? 1.0f : 1.41421356f;
+}
+
+//-------------------------
+// eoePathfinder::Distance
+//-------------------------
+float eoePathfinder::Distance(const eoePathHeuristic_t heuristic, const eoeVec2i & from, const eoeVec2i & to) {
+	return heuristic == PATH_ISOMETRIC ? IsometricDistance(from, to) : OctileDistance(from, to);
+}
@@ -0,0 +1,158 @@
+#ifndef EOECORE_PATHFINDER_H
+#define EOECORE_PATHFINDER_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <deque>
+#include <mutex>
+#include <vector>
+#include "Vector.h"
+
+enum eoePathHeuristic_t {
+	PATH_OCTILE,			// straight moves cost 1, diagonals sqrt(2)
+	PATH_ISOMETRIC			// moves cost their on-screen length, see eoePathfinder::IsometricDistance
+};
+
+enum eoePathSearch_t {
+	PATH_ASTAR,				// every neighbor of every expanded tile, honors tile costs
+	PATH_JUMP_POINT			// jumps over symmetric runs of open tiles, uniform cost only
+};
+
+//--------------------------------------------
+//
+//
+//				eoePathfinder
+//	  --A* and jump point search on tile grids--
+//
+//
+// searches a row-major grid of tile costs, where 0 blocks a tile and
+// any other value multiplies the cost of every move onto that tile,
+// over 8 neighbors, never cutting the corner of a blocked tile
+// the grid is read in place, so edits show up in the next search
+// per-tile search state lives in arrays stamped with a search generation,
+// so a new search never clears them, and the open set is a binary heap
+// over one reused array: after the first search on a grid, searches
+// allocate nothing
+// every search borrows its state from a pool and returns it, so FindPath
+// may run on several threads at once, and FindPaths splits batches
+// across EVIL_THREADS with one pooled state per running slice
+// DEBUG: PATH_JUMP_POINT treats every open tile as cost 1
+//--------------------------------------------
+class eoePathfinder {
+public:
+
+								eoePathfinder() = default;
+	explicit					eoePathfinder(const uint8_t * costs, const int width, const int height);
+
+	void						SetGrid(const uint8_t * costs, const int width, const int height);
+	int							GetWidth() const;
+	int							GetHeight() const;
+	bool						IsOpen(const int x, const int y) const;
+
+	int							FindPath(eoeVec2i * path, const int maxPath, const eoeVec2i & start, const eoeVec2i & goal,
+										 const eoePathHeuristic_t heuristic = PATH_OCTILE, const eoePathSearch_t search = PATH_ASTAR);
+	void						FindPaths(int * pathLengths, eoeVec2i * paths, const int maxPath, const eoeVec2i * starts, const eoeVec2i * goals, const int count,
+										  const eoePathHeuristic_t heuristic = PATH_OCTILE, const eoePathSearch_t search = PATH_ASTAR);
+
+	static float				OctileDistance(const eoeVec2i & from, const eoeVec2i & to);
+	static float				IsometricDistance(const eoeVec2i & from, const eoeVec2i & to);
+
+private:
+
+	struct node_t {
+		float					g;					// cost from the start
+		int						parent;				// tile index, -1 for the start
+		int						heapIndex;			// CLOSED once expanded
+		uint32_t				generation;			// search that last touched this tile
+	};
+
+	struct open_t {
+		float					f;					// g plus the heuristic
+		float					g;					// breaks f ties toward the goal
+		int						node;
+	};
+
+	struct search_t {
+		std::vector<node_t>		nodes;				// indexed by tile
+		std::vector<open_t>		heap;
+		uint32_t				generation		= 0;
+	};
+
+	search_t &					AcquireSearch();
+	void						ReleaseSearch(search_t & search);
+	int							Search(search_t & search, eoeVec2i * path, const int maxPath, const eoeVec2i & start, const eoeVec2i & goal,
+									   const eoePathHeuristic_t heuristic, const eoePathSearch_t searchType) const;
+	int							JumpStraight(int x, int y, const int dx, const int dy, const int goal) const;
+	int							JumpDiagonal(int x, int y, const int dx, const int dy, const int goal) const;
+
+	static void					PushOpen(search_t & search, const open_t & entry);
+	static open_t				PopOpen(search_t & search);
+	static void					SiftUp(search_t & search, int index);
+	static float				MoveCost(const eoePathHeuristic_t heuristic, const int dx, const int dy);
+	static float				Distance(const eoePathHeuristic_t heuristic, const eoeVec2i & from, const eoeVec2i & to);
+
+private:
+
+	static constexpr int		CLOSED				= -1;
+	static constexpr int		MIN_PATH_BATCH		= 4;		// searches per job, each can be thousands of tiles
+
+	const uint8_t *				costs				= nullptr;
+	int							width				= 0;
+	int							height				= 0;
+
+	std::mutex					searchMutex;								// guards the pool below
+	std::deque<search_t>		searches;									// never moves an element once added
+	std::vector<search_t *>		freeSearches;
+};
+
+//-------------------------
+// eoePathfinder::GetWidth
+//-------------------------
+inline int eoePathfinder::GetWidth() const {
+	return width;
+}
+
+//-------------------------
+// eoePathfinder::GetHeight
+//-------------------------
+inline int eoePathfinder::GetHeight() const {
+	return height;
+}
+
+//-------------------------
+// eoePathfinder::IsOpen
+// returns true if the tile is on the grid and not blocked
+//-------------------------
+inline bool eoePathfinder::IsOpen(const int x, const int y) const {
+	return (unsigned)x < (unsigned)width && (unsigned)y < (unsigned)height && costs[y * width + x] != 0;
+}
+
+//-------------------------
+// eoePathfinder::OctileDistance
+// cheapest 8 neighbor path cost on an open octile grid
+//-------------------------
+inline float eoePathfinder::OctileDistance(const eoeVec2i & from, const eoeVec2i & to) {
+	const int dx = abs(to.x - from.x);
+	const int dy = abs(to.y - from.y);
+	const int diagonal = dx < dy ? dx : dy;
+	return (float)(dx + dy) + (1.41421356f - 2.0f) * (float)diagonal;
+}
+
+//-------------------------
+// eoePathfinder::IsometricDistance
+// cheapest 8 neighbor path cost on an open grid where each move costs
+// the length of eoeMath::OrthographicToIsometric of the move:
+// straight moves sqrt(1.25), diagonals along x == y 1 (straight down the screen),
+// and diagonals along x == -y 2 (straight across the screen)
+//-------------------------
+inline float eoePathfinder::IsometricDistance(const eoeVec2i & from, const eoeVec2i & to) {
+	const int deltaX = to.x - from.x;
+	const int deltaY = to.y - from.y;
+	const int dx = abs(deltaX);
+	const int dy = abs(deltaY);
+	const int diagonal = dx < dy ? dx : dy;
+	const float diagonalCost = (deltaX < 0) == (deltaY < 0) ? 1.0f : 2.0f;
+	return 1.11803399f * (float)(dx + dy) + (diagonalCost - 2.0f * 1.11803399f) * (float)diagonal;
+}
+
+#endif /* EOECORE_PATHFINDER_H */
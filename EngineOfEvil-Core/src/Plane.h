@@ -0,0 +1,99 @@
+#ifndef EOECORE_PLANE_H
+#define EOECORE_PLANE_H
+
+#include "Vector.h"
+
+//--------------------------------------------
+//
+//
+//				eoePlane
+//	   --all points p where normal * p + d == 0--
+//
+//
+// positive distances are on the side the normal points to
+//--------------------------------------------
+class eoePlane {
+public:
+
+	eoeVec3				normal;
+	float				d = 0.0f;
+
+						eoePlane() = default;
+	explicit constexpr	eoePlane(const eoeVec3 & normal, const float d);
+	explicit constexpr	eoePlane(const eoeVec4 & coefficients);
+
+	void				Set(const eoeVec3 & normal, const float d);
+	float				Normalize();
+	constexpr float		Distance(const eoeVec3 & point) const;
+	constexpr eoeVec4	ToVec4() const;
+
+	static eoePlane		FromPointNormal(const eoeVec3 & point, const eoeVec3 & normal);
+};
+
+//-------------------------
+// eoePlane::eoePlane
+//-------------------------
+inline constexpr eoePlane::eoePlane(const eoeVec3 & normal, const float d)
+	: normal(normal),
+	  d(d) {
+}
+
+//-------------------------
+// eoePlane::eoePlane
+// from the a, b, c, d of ax + by + cz + d = 0
+//-------------------------
+inline constexpr eoePlane::eoePlane(const eoeVec4 & coefficients)
+	: normal(coefficients.x, coefficients.y, coefficients.z),
+	  d(coefficients.w) {
+}
+
+//-------------------------
+// eoePlane::Set
+//-------------------------
+inline void eoePlane::Set(const eoeVec3 & normal, const float d) {
+	this->normal = normal;
+	this->d = d;
+}
+
+//-------------------------
+// eoePlane::Normalize
+// scales the whole equation so normal is unit length,
+// which makes Distance a true euclidean distance
+// returns the original normal length
+//-------------------------
+inline float eoePlane::Normalize() {
+	const float length = normal.Length();
+	if (length == 0.0f)
+		return 0.0f;
+
+	const float invLength = 1.0f / length;
+	normal *= invLength;
+	d *= invLength;
+	return length;
+}
+
+//-------------------------
+// eoePlane::Distance
+// signed distance of point from the plane, scaled by the normal's length
+//-------------------------
+inline constexpr float eoePlane::Distance(const eoeVec3 & point) const {
+	return normal * point + d;
+}
+
+//-------------------------
+// eoePlane::ToVec4
+// returns a, b, c, d of ax + by + cz + d = 0
+//-------------------------
+inline constexpr eoeVec4 eoePlane::ToVec4() const {
+	return eoeVec4(normal.x, normal.y, normal.z, d);
+}
+
+//-------------------------
+// eoePlane::FromPointNormal
+// DEBUG: normal is assumed to be unit length
+//-------------------------
+inline eoePlane eoePlane::FromPointNormal(const eoeVec3 & point, const eoeVec3 & normal) {
+	return eoePlane(normal, -(normal * point));
+}
+
+#endif /* EOECORE_PLANE_H */
@@ -0,0 +1,38 @@
+#include "QuatRotator.h"
+#include "SIMD.h"
+
+//-------------------------
+// eoeQuatRotator::Set
+// caches the terms eoeQuat::operator* would compute for every vector
+// --only deals with unit length quaternions--
+//-------------------------
+void eoeQuatRotator::Set(const eoeQuat & rotation) {
+	const float x = rotation.x;
+	const float y = rotation.y;
+	const float z = rotation.z;
+	const float w = rotation.w;
+
+	const float xxzz = x*x - z*z;
+	const float wwyy = w*w - y*y;
+
+	const float xw2 = x*w*2.0f;
+	const float xy2 = x*y*2.0f;
+	const float xz2 = x*z*2.0f;
+	const float yw2 = y*w*2.0f;
+	const float yz2 = y*z*2.0f;
+	const float zw2 = z*w*2.0f;
+
+	matrix[0] = eoeVec4(xxzz + wwyy, xy2 - zw2, xz2 + yw2, 0.0f);
+	matrix[1] = eoeVec4(xy2 + zw2, y*y + w*w - x*x - z*z, yz2 - xw2, 0.0f);
+	matrix[2] = eoeVec4(xz2 - yw2, yz2 + xw2, wwyy - xxzz, 0.0f);
+	matrix[3] = eoeVec4(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+//-------------------------
+// eoeQuatRotator::RotateMany
+// dst[i] = Rotate(src[i])
+// dst may alias src
+//-------------------------
+void eoeQuatRotator::RotateMany(eoeVec3 * dst, const eoeVec3 * src, const int count) const {
+	EVIL_SIMD->Mat4_TransformVec3Directions(dst, matrix, src, count);
+}
@@ -0,0 +1,79 @@
+#ifndef EOECORE_QUAT_ROTATOR_H
+#define EOECORE_QUAT_ROTATOR_H
+
+#include "Matrix.h"
+
+//--------------------------------------------
+//
+//
+//				eoeQuatRotator
+//	--an eoeQuat expanded into its rotation matrix--
+//	 for rotating many vectors by the same rotation
+//
+//
+//--------------------------------------------
+class eoeQuatRotator {
+public:
+
+							eoeQuatRotator();
+	explicit				eoeQuatRotator(const eoeQuat & rotation);
+
+	void					Set(const eoeQuat & rotation);
+	const eoeMat4 &			ToMat4() const;
+
+	eoeVec3					Rotate(const eoeVec3 & a) const;
+	eoeVec2					Rotate(const eoeVec2 & a) const;
+	void					RotateMany(eoeVec3 * dst, const eoeVec3 * src, const int count) const;
+
+private:
+
+	eoeMat4					matrix;		// rotation in the upper 3x3, identity elsewhere
+};
+
+//-------------------------
+// eoeQuatRotator::eoeQuatRotator
+// starts as the identity rotation
+//-------------------------
+inline eoeQuatRotator::eoeQuatRotator()
+	: matrix(1.0f) {
+}
+
+//-------------------------
+// eoeQuatRotator::eoeQuatRotator
+//-------------------------
+inline eoeQuatRotator::eoeQuatRotator(const eoeQuat & rotation) {
+	Set(rotation);
+}
+
+//-------------------------
+// eoeQuatRotator::ToMat4
+// returns the rotation as a column-vector eoeMat4
+//-------------------------
+inline const eoeMat4 & eoeQuatRotator::ToMat4() const {
+	return matrix;
+}
+
+//-------------------------
+// eoeQuatRotator::Rotate
+// same result as eoeQuat::operator* without re-deriving the matrix terms
+//-------------------------
+inline eoeVec3 eoeQuatRotator::Rotate(const eoeVec3 & a) const {
+	return eoeVec3(
+		matrix[0].x * a.x + matrix[0].y * a.y + matrix[0].z * a.z,
+		matrix[1].x * a.x + matrix[1].y * a.y + matrix[1].z * a.z,
+		matrix[2].x * a.x + matrix[2].y * a.y + matrix[2].z * a.z
+	);
+}
+
+//-------------------------
+// eoeQuatRotator::Rotate
+// same result as eoeQuat::operator* without re-deriving the matrix terms
+//-------------------------
+inline eoeVec2 eoeQuatRotator::Rotate(const eoeVec2 & a) const {
+	return eoeVec2(
+		matrix[0].x * a.x + matrix[0].y * a.y,
+		matrix[1].x * a.x + matrix[1].y * a.y
+	);
+}
+
+#endif /* EOECORE_QUAT_ROTATOR_H */
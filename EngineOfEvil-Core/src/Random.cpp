@@ -0,0 +1,226 @@
+#include "Random.h"
+#include "SIMD.h"
+
+// xoshiro128 jump polynomials, equivalent to 2^64 and 2^96 calls to NextUInt
+static constexpr uint32_t RANDOM_JUMP[4]		= { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+static constexpr uint32_t RANDOM_LONG_JUMP[4]	= { 0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662 };
+
+//--------------------------
+// eoeRandom::Seed
+// expands the seed with splitmix64 so that similar seeds (0, 1, 2...)
+// still start from unrelated, never all-zero, states
+//--------------------------
+void eoeRandom::Seed(const uint64_t seed) {
+	uint64_t x = seed;
+	for (int i = 0; i < 4; i += 2) {
+		x += 0x9e3779b97f4a7c15ull;
+		uint64_t z = x;
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+		z ^= z >> 31;
+		state[i] = (uint32_t)z;
+		state[i + 1] = (uint32_t)(z >> 32);
+	}
+}
+
+//--------------------------
+// eoeRandom::JumpBy
+//--------------------------
+void eoeRandom::JumpBy(const uint32_t * polynomial) {
+	uint32_t jumped[4] = { 0, 0, 0, 0 };
+	for (int i = 0; i < 4; ++i) {
+		for (int bit = 0; bit < 32; ++bit) {
+			if (polynomial[i] & (1u << bit)) {
+				jumped[0] ^= state[0];
+				jumped[1] ^= state[1];
+				jumped[2] ^= state[2];
+				jumped[3] ^= state[3];
+			}
+			NextUInt();
+		}
+	}
+	memcpy(state, jumped, sizeof(state));
+}
+
+//--------------------------
+// eoeRandom::Jump
+// advances 2^64 outputs, used to split one stream into non-overlapping lanes
+//--------------------------
+void eoeRandom::Jump() {
+	JumpBy(RANDOM_JUMP);
+}
+
+//--------------------------
+// eoeRandom::LongJump
+// advances 2^96 outputs, used to split one seed into non-overlapping streams
+//--------------------------
+void eoeRandom::LongJump() {
+	JumpBy(RANDOM_LONG_JUMP);
+}
+
+//--------------------------
+// eoeRandom::ForStream
+// the stream-th independent generator of seed
+// each stream leaves room for 2^32 lanes of 2^64 outputs before meeting the next
+// DEBUG: costs stream long jumps, create streams once up front rather than per frame
+//--------------------------
+eoeRandom eoeRandom::ForStream(const uint64_t seed, const int stream) {
+	eoeRandom result(seed);
+	for (int i = 0; i < stream; ++i)
+		result.LongJump();
+	return result;
+}
+
+//--------------------------
+// eoeRandom::NextUnitVec2
+// uniform direction on the unit circle
+//--------------------------
+eoeVec2 eoeRandom::NextUnitVec2() {
+	float sin;
+	float cos;
+	eoeMath::SinCosFast(NextFloat(-eoeMath::PI, eoeMath::PI), sin, cos);
+	return eoeVec2(cos, sin);
+}
+
+//--------------------------
+// eoeRandom::NextUnitVec3
+// uniform direction on the unit sphere, by archimedes:
+// uniform height and uniform angle around it
+//--------------------------
+eoeVec3 eoeRandom::NextUnitVec3() {
+	const float z = NextFloat(-1.0f, 1.0f);
+	const float r = sqrtf(1.0f - z * z);
+	float sin;
+	float cos;
+	eoeMath::SinCosFast(NextFloat(-eoeMath::PI, eoeMath::PI), sin, cos);
+	return eoeVec3(r * cos, r * sin, z);
+}
+
+//--------------------------
+// eoeRandom::NextQuat
+// uniform rotation, by shoemake's subgroup algorithm
+//--------------------------
+eoeQuat eoeRandom::NextQuat() {
+	const float u = NextFloat();
+	const float r1 = sqrtf(1.0f - u);
+	const float r2 = sqrtf(u);
+	float sin1;
+	float cos1;
+	float sin2;
+	float cos2;
+	eoeMath::SinCosFast(NextFloat(-eoeMath::PI, eoeMath::PI), sin1, cos1);
+	eoeMath::SinCosFast(NextFloat(-eoeMath::PI, eoeMath::PI), sin2, cos2);
+	return eoeQuat(r1 * sin1, r1 * cos1, r2 * sin2, r2 * cos2);
+}
+
+//--------------------------
+// eoeRandomLanes::eoeRandomLanes
+//--------------------------
+eoeRandomLanes::eoeRandomLanes(const uint64_t seed, const int stream) {
+	Seed(seed, stream);
+}
+
+//--------------------------
+// eoeRandomLanes::Seed
+// lane i starts where eoeRandom::ForStream(seed, stream) would be after i jumps
+//--------------------------
+void eoeRandomLanes::Seed(const uint64_t seed, const int stream) {
+	eoeRandom lane = eoeRandom::ForStream(seed, stream);
+	for (int i = 0; i < EOE_RANDOM_LANES; ++i) {
+		for (int word = 0; word < 4; ++word)
+			state[word * EOE_RANDOM_LANES + i] = lane.state[word];
+		lane.Jump();
+	}
+}
+
+//--------------------------
+// eoeRandomLanes::FillUInts
+// raw 32-bit outputs
+//--------------------------
+void eoeRandomLanes::FillUInts(uint32_t * dst, const int count) {
+	EVIL_SIMD->Random_FillUInts(state, dst, count);
+}
+
+//--------------------------
+// eoeRandomLanes::FillFloats
+// uniform in [min, max)
+//--------------------------
+void eoeRandomLanes::FillFloats(float * dst, const int count, const float min, const float max) {
+	EVIL_SIMD->Random_FillFloats(state, dst, count, min, max - min);
+}
+
+//--------------------------
+// eoeRandomLanes::FillInts
+// uniform in [min, max], both inclusive
+// DEBUG: assumes min <= max
+//--------------------------
+void eoeRandomLanes::FillInts(int * dst, const int count, const int min, const int max) {
+	EVIL_SIMD->Random_FillInts(state, dst, count, min, eoeRandom::IntSpan(min, max));
+}
+
+//--------------------------
+// eoeRandomLanes::FillUnitVec2s
+// same distribution as eoeRandom::NextUnitVec2
+//--------------------------
+void eoeRandomLanes::FillUnitVec2s(eoeVec2 * dst, const int count) {
+	float angle[BLOCK_SIZE];
+	float sin[BLOCK_SIZE];
+	float cos[BLOCK_SIZE];
+
+	for (int done = 0; done < count; done += BLOCK_SIZE) {
+		const int num = count - done < BLOCK_SIZE ? count - done : BLOCK_SIZE;
+		FillFloats(angle, num, -eoeMath::PI, eoeMath::PI);
+		EVIL_SIMD->Float_SinCosFast(sin, cos, angle, num);
+		for (int i = 0; i < num; ++i)
+			dst[done + i] = eoeVec2(cos[i], sin[i]);
+	}
+}
+
+//--------------------------
+// eoeRandomLanes::FillUnitVec3s
+// same distribution as eoeRandom::NextUnitVec3
+//--------------------------
+void eoeRandomLanes::FillUnitVec3s(eoeVec3 * dst, const int count) {
+	float z[BLOCK_SIZE];
+	float angle[BLOCK_SIZE];
+	float sin[BLOCK_SIZE];
+	float cos[BLOCK_SIZE];
+
+	for (int done = 0; done < count; done += BLOCK_SIZE) {
+		const int num = count - done < BLOCK_SIZE ? count - done : BLOCK_SIZE;
+		FillFloats(z, num, -1.0f, 1.0f);
+		FillFloats(angle, num, -eoeMath::PI, eoeMath::PI);
+		EVIL_SIMD->Float_SinCosFast(sin, cos, angle, num);
+		for (int i = 0; i < num; ++i) {
+			const float r = sqrtf(1.0f - z[i] * z[i]);
+			dst[done + i] = eoeVec3(r * cos[i], r * sin[i], z[i]);
+		}
+	}
+}
+
+//--------------------------
+// eoeRandomLanes::FillQuats
+// same distribution as eoeRandom::NextQuat
+//--------------------------
+void eoeRandomLanes::FillQuats(eoeQuat * dst, const int count) {
+	float u[BLOCK_SIZE];
+	float angle[BLOCK_SIZE];
+	float sin1[BLOCK_SIZE];
+	float cos1[BLOCK_SIZE];
+	float sin2[BLOCK_SIZE];
+	float cos2[BLOCK_SIZE];
+
+	for (int done = 0; done < count; done += BLOCK_SIZE) {
+		const int num = count - done < BLOCK_SIZE ? count - done : BLOCK_SIZE;
+		FillFloats(u, num);
+		FillFloats(angle, num, -eoeMath::PI, eoeMath::PI);
+		EVIL_SIMD->Float_SinCosFast(sin1, cos1, angle, num);
+		FillFloats(angle, num, -eoeMath::PI, eoeMath::PI);
+		EVIL_SIMD->Float_SinCosFast(sin2, cos2, angle, num);
+		for (int i = 0; i < num; ++i) {
+			const float r1 = sqrtf(1.0f - u[i]);
+			const float r2 = sqrtf(u[i]);
+			dst[done + i] = eoeQuat(r1 * sin1[i], r1 * cos1[i], r2 * sin2[i], r2 * cos2[i]);
+		}
+	}
+}
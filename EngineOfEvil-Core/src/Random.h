@@ -0,0 +1,193 @@
+#ifndef EOECORE_RANDOM_H
+#define EOECORE_RANDOM_H
+
+#include <stdint.h>
+#include "Vector.h"
+
+// lanes stepped together by the Random_ SIMD kernels (see SIMD.h),
+// eoeRandomLanes output is identical on every processor
+#define EOE_RANDOM_LANES 8
+
+//--------------------------------------------
+//
+//
+//				eoeRandom
+//	   --seedable xoshiro128** generator--
+//
+//
+// 128 bits of state, period 2^128 - 1, same sequence on every platform and compiler
+// for per-thread streams give each job its own generator from ForStream instead of sharing one,
+// eg: eoeRandom rng = eoeRandom::ForStream(levelSeed, chunkIndex);
+// key streams by the work item (chunk, ParallelFor batch begin) rather than the thread
+// that happens to run it, otherwise results depend on scheduling
+//--------------------------------------------
+class eoeRandom {
+public:
+
+	static constexpr uint64_t	DEFAULT_SEED = 0x5eed0f0e71c0ffeeull;
+
+	explicit					eoeRandom(const uint64_t seed = DEFAULT_SEED);
+
+	void						Seed(const uint64_t seed);
+	void						Jump();
+	void						LongJump();
+
+	uint32_t					NextUInt();
+	float						NextFloat();
+	float						NextFloat(const float min, const float max);
+	int							NextInt(const int min, const int max);
+	bool						NextBool();
+	eoeVec2						NextUnitVec2();
+	eoeVec3						NextUnitVec3();
+	eoeQuat						NextQuat();
+
+	static eoeRandom			ForStream(const uint64_t seed, const int stream);
+
+	// the algorithm itself, shared with the eoeSIMD_Generic kernels
+	static uint32_t				Step(uint32_t & s0, uint32_t & s1, uint32_t & s2, uint32_t & s3);
+	static float				ToUnitFloat(const uint32_t bits);
+	static float				ToFloat(const uint32_t bits, const float min, const float range);
+	static int					ToInt(const uint32_t bits, const int min, const uint64_t span);
+	static uint64_t				IntSpan(const int min, const int max);
+
+public:
+
+	uint32_t					state[4];
+
+private:
+
+	void						JumpBy(const uint32_t * polynomial);
+};
+
+//--------------------------------------------
+//
+//
+//				eoeRandomLanes
+//	   --EOE_RANDOM_LANES interleaved eoeRandoms--
+//
+//
+// fills whole spans through EVIL_SIMD, lane i is the stream's generator
+// jumped i times, and output k comes from lane k % EOE_RANDOM_LANES
+// each Fill call consumes whole steps of every lane, so the sequence depends
+// only on the seed and the call pattern, never on the processor
+//--------------------------------------------
+class eoeRandomLanes {
+public:
+
+	explicit					eoeRandomLanes(const uint64_t seed = eoeRandom::DEFAULT_SEED, const int stream = 0);
+
+	void						Seed(const uint64_t seed, const int stream = 0);
+
+	void						FillUInts(uint32_t * dst, const int count);
+	void						FillFloats(float * dst, const int count, const float min = 0.0f, const float max = 1.0f);
+	void						FillInts(int * dst, const int count, const int min, const int max);
+	void						FillUnitVec2s(eoeVec2 * dst, const int count);
+	void						FillUnitVec3s(eoeVec3 * dst, const int count);
+	void						FillQuats(eoeQuat * dst, const int count);
+
+private:
+
+	static constexpr int		BLOCK_SIZE = 256;		// vectors composed per pass from stack scratch
+
+	uint32_t					state[4 * EOE_RANDOM_LANES];	// s0 of every lane, then s1, s2, s3
+};
+
+//--------------------------
+// eoeRandom::eoeRandom
+//--------------------------
+inline eoeRandom::eoeRandom(const uint64_t seed) {
+	Seed(seed);
+}
+
+//--------------------------
+// eoeRandom::Step
+// returns the next output of the generator in s0..s3 and advances it
+//--------------------------
+inline uint32_t eoeRandom::Step(uint32_t & s0, uint32_t & s1, uint32_t & s2, uint32_t & s3) {
+	const uint32_t scrambled = s1 * 5;
+	const uint32_t result = ((scrambled << 7) | (scrambled >> 25)) * 9;
+	const uint32_t t = s1 << 9;
+
+	s2 ^= s0;
+	s3 ^= s1;
+	s1 ^= s2;
+	s0 ^= s3;
+	s2 ^= t;
+	s3 = (s3 << 11) | (s3 >> 21);
+	return result;
+}
+
+//--------------------------
+// eoeRandom::ToUnitFloat
+// the high 24 bits as a float in [0, 1), every value exactly representable
+//--------------------------
+inline float eoeRandom::ToUnitFloat(const uint32_t bits) {
+	return (float)(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+//--------------------------
+// eoeRandom::ToFloat
+// min + [0, 1) * range
+// DEBUG: rounding can return min + range itself
+//--------------------------
+inline float eoeRandom::ToFloat(const uint32_t bits, const float min, const float range) {
+	return min + ToUnitFloat(bits) * range;
+}
+
+//--------------------------
+// eoeRandom::ToInt
+// scales bits onto [0, span) by a 32x32->64 multiply instead of a modulo
+// DEBUG: bias is at most span / 2^32, irrelevant for gameplay-sized ranges
+//--------------------------
+inline int eoeRandom::ToInt(const uint32_t bits, const int min, const uint64_t span) {
+	return (int)((uint32_t)min + (uint32_t)(((uint64_t)bits * span) >> 32));
+}
+
+//--------------------------
+// eoeRandom::IntSpan
+// number of values in [min, max], up to 2^32
+//--------------------------
+inline uint64_t eoeRandom::IntSpan(const int min, const int max) {
+	return (uint64_t)((int64_t)max - (int64_t)min) + 1;
+}
+
+//--------------------------
+// eoeRandom::NextUInt
+//--------------------------
+inline uint32_t eoeRandom::NextUInt() {
+	return Step(state[0], state[1], state[2], state[3]);
+}
+
+//--------------------------
+// eoeRandom::NextFloat
+// uniform in [0, 1)
+//--------------------------
+inline float eoeRandom::NextFloat() {
+	return ToUnitFloat(NextUInt());
+}
+
+//--------------------------
+// eoeRandom::NextFloat
+// uniform in [min, max)
+//--------------------------
+inline float eoeRandom::NextFloat(const float min, const float max) {
+	return ToFloat(NextUInt(), min, max - min);
+}
+
+//--------------------------
+// eoeRandom::NextInt
+// uniform in [min, max], both inclusive
+// DEBUG: assumes min <= max
+//--------------------------
+inline int eoeRandom::NextInt(const int min, const int max) {
+	return ToInt(NextUInt(), min, IntSpan(min, max));
+}
+
+//--------------------------
+// eoeRandom::NextBool
+//--------------------------
+inline bool eoeRandom::NextBool() {
+	return (NextUInt() >> 31) != 0;
+}
+
+#endif /* EOECORE_RANDOM_H */
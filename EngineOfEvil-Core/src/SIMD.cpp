@@ -0,0 +1,39 @@
+#include "SIMD_AVX2.h"
+
+static eoeSIMD_Generic		genericProcessor;
+#ifdef EOE_SIMD_X86
+static eoeSIMD_SSE2			sse2Processor;
+static eoeSIMD_SSE41		sse41Processor;
+static eoeSIMD_AVX2			avx2Processor;
+#endif
+
+eoeSIMDProcessor * eoeSIMD::processor = &genericProcessor;
+eoeSIMDProcessor * eoeSIMD::generic = &genericProcessor;
+
+//--------------------------
+// eoeSIMD::Init
+// selects the fastest processor the cpu supports
+//--------------------------
+void eoeSIMD::Init() {
+	InitProcessor(false);
+}
+
+//--------------------------
+// eoeSIMD::InitProcessor
+// forceGeneric selects the scalar reference regardless of cpu support
+// (eg: to compare results or timings against it)
+//--------------------------
+void eoeSIMD::InitProcessor(bool forceGeneric) {
+	processor = &genericProcessor;
+	if (forceGeneric)
+		return;
+
+#ifdef EOE_SIMD_X86
+	if (SDL_HasAVX() && SDL_HasAVX2())
+		processor = &avx2Processor;
+	else if (SDL_HasSSE41())
+		processor = &sse41Processor;
+	else if (SDL_HasSSE2())
+		processor = &sse2Processor;
+#endif
+}
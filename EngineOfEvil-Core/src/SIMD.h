@@ -0,0 +1,162 @@
+#ifndef EOECORE_SIMD_H
+#define EOECORE_SIMD_H
+
+#include "Bounds.h"
+#include "Matrix.h"
+#include "Random.h"
+#include "Noise.h"
+
+#define EVIL_SIMD (eoeSIMD::processor)
+
+// x86 builds carry the SSE2/SSE4.1/AVX2 processors, everything else runs the generic reference
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define EOE_SIMD_X86
+#endif
+
+// gcc and clang only expose an instruction set's intrinsics inside functions targeting it,
+// msvc exposes them everywhere, so each kernel states its own isa instead of the whole
+// translation unit being compiled with -mavx2 (which would leak avx into shared inline code)
+#if defined(__GNUC__) || defined(__clang__)
+#define EOE_SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define EOE_SIMD_TARGET(isa)
+#endif
+
+// eoeMat4, eoeVec4, and eoeQuat arguments are aligned by their types (see Vector.h),
+// so kernels load and store them with aligned instructions, while raw float and eoeVec3
+// arrays can start anywhere and always go through the unaligned forms
+// DEBUG: an eoeVec4 * cast from arbitrary float memory must still be 16-byte aligned
+
+// the Random_ kernels step the EOE_RANDOM_LANES interleaved generators of an eoeRandomLanes
+// (state holds s0 of every lane, then s1, s2, s3) a whole step at a time, writing
+// output k from lane k % EOE_RANDOM_LANES and dropping what a partial final step leaves over
+
+// the Noise_ kernels evaluate eoeNoise at count independent points given as separate
+// x, y (and z) arrays, following the scalar eoeNoise functions operation for operation
+
+// Float_Lerp interpolates count packed numComponents-vectors (1 to 4 floats each)
+// with one fraction per vector, dst may alias from or to so tweens can update in place
+
+// components per structure-of-arrays vector the SoA_ kernels accept
+#define EOE_SOA_MAX_COMPONENTS 4
+
+// batch transform variants sharing one kernel body
+enum eoeTransformMode_t {
+	TRANSFORM_FULL,			// m * v
+	TRANSFORM_DIRECTION,	// m * (v.xyz, 0)
+	TRANSFORM_PROJECTIVE	// m * v, divided through by w
+};
+
+//--------------------------------------------
+//			eoeSIMDProcessor
+// interface to the math kernels that have
+// instruction-set specific implementations
+// eoeSIMD_Generic is the scalar reference, every other
+// processor derives from the next weaker one and overrides
+// only the kernels it actually improves
+//--------------------------------------------
+class eoeSIMDProcessor {
+public:
+
+	virtual							~eoeSIMDProcessor() = default;
+
+	virtual const char *			GetName() const = 0;
+
+	virtual void					Mat4_MultiplyMat4(eoeMat4 & dst, const eoeMat4 & a, const eoeMat4 & b) const = 0;
+	virtual void					Mat4_MultiplyVec4(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const = 0;
+	virtual void					Mat4_MultiplyVec4Transposed(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const = 0;
+	virtual void					Mat4_MultiplyMat4sColumnMajor(float * dst, const eoeMat4 & a, const eoeMat4 * b, const int count) const = 0;
+
+	virtual void					Mat4_Transpose(eoeMat4 & dst, const eoeMat4 & src) const = 0;
+	virtual bool					Mat4_Inverse(eoeMat4 & dst, const eoeMat4 & src) const = 0;
+	virtual bool					Mat4_AffineInverse(eoeMat4 & dst, const eoeMat4 & src) const = 0;
+
+	virtual void					Mat4_TransformVec4(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const = 0;
+	virtual void					Mat4_TransformVec4Directions(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const = 0;
+	virtual void					Mat4_TransformVec4Projective(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const = 0;
+	virtual void					Mat4_TransformVec3Points(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const = 0;
+	virtual void					Mat4_TransformVec3Directions(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const = 0;
+	virtual void					Mat4_TransformVec3Projective(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const = 0;
+
+	virtual void					Mat3x2_TransformVec2(eoeVec2 * dst, const eoeMat3x2 & m, const eoeVec2 * src, const int count) const = 0;
+
+	virtual void					Float_Add(float * dst, const float * a, const float * b, const int count) const = 0;
+	virtual void					Float_Scale(float * dst, const float * a, const float scale, const int count) const = 0;
+	virtual void					Float_MultiplyAdd(float * dst, const float * a, const float * b, const float scale, const int count) const = 0;
+	virtual void					Float_SnapInt(float * dst, const float * src, const int count) const = 0;
+	virtual void					Float_SinCosFast(float * sin, float * cos, const float * radians, const int count) const = 0;
+	virtual void					Float_RSqrtFast(float * dst, const float * src, const int count) const = 0;
+	virtual void					Float_ATan2Fast(float * dst, const float * y, const float * x, const int count) const = 0;
+	virtual void					Float_IsometricToOrthographic(float * x, float * y, const int count) const = 0;
+	virtual void					Float_OrthographicToIsometric(float * x, float * y, const int count) const = 0;
+	virtual void					Int_IsometricToOrthographic(int * x, int * y, const int count) const = 0;
+	virtual void					Int_OrthographicToIsometric(int * x, int * y, const int count) const = 0;
+	virtual void					SoA_Dot(float * dst, const float * const * a, const float * const * b, const int numComponents, const int count) const = 0;
+	virtual void					SoA_Length(float * dst, const float * const * a, const int numComponents, const int count) const = 0;
+	virtual void					SoA_Normalize(float * const * a, const int numComponents, const int count) const = 0;
+	virtual void					SoA_Cross(float * const * dst, const float * const * a, const float * const * b, const int count) const = 0;
+	virtual void					SoA_FromVec3(float * const * dst, const eoeVec3 * src, const int count) const = 0;
+	virtual void					SoA_FromVec4(float * const * dst, const eoeVec4 * src, const int count) const = 0;
+	virtual void					SoA_ToVec3(eoeVec3 * dst, const float * const * src, const int count) const = 0;
+	virtual void					SoA_ToVec4(eoeVec4 * dst, const float * const * src, const int count) const = 0;
+
+	virtual int						Cull_AABBs(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeAABB * bounds, const int count) const = 0;
+	virtual int						Cull_Spheres(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeSphere * spheres, const int count) const = 0;
+
+	virtual void					Random_FillUInts(uint32_t * state, uint32_t * dst, const int count) const = 0;
+	virtual void					Random_FillFloats(uint32_t * state, float * dst, const int count, const float min, const float range) const = 0;
+	virtual void					Random_FillInts(uint32_t * state, int * dst, const int count, const int min, const uint64_t span) const = 0;
+
+	virtual void					Noise_Value2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const = 0;
+	virtual void					Noise_Value3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const = 0;
+	virtual void					Noise_Simplex2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const = 0;
+	virtual void					Noise_Simplex3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const = 0;
+
+	virtual void					Float_Lerp(float * dst, const float * from, const float * to, const float * fractions, const int numComponents, const int count) const = 0;
+	virtual void					Float_Ease(float * dst, const float * fractions, const int count, const eoeEase_t type) const = 0;
+	virtual void					Quat_Nlerp(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const = 0;
+	virtual void					Quat_SlerpFast(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const = 0;
+};
+
+//--------------------------
+// SoA_Offset
+// points dst at element [offset] of each of the numComponents arrays in src
+// used by processors to hand the remainder of a batch to a weaker processor
+//--------------------------
+template<typename type>
+inline void SoA_Offset(type ** dst, type * const * src, const int numComponents, const int offset) {
+	for (int c = 0; c < numComponents; ++c)
+		dst[c] = src[c] + offset;
+}
+
+//--------------------------
+// CompactIndexes
+// appends first + k for each set bit k of a lane mask without branching
+// used by the Cull_ kernels, every lane's slot is written but only set lanes
+// advance numVisible, so visibleIndexes needs room for numLanes past it
+//--------------------------
+inline void CompactIndexes(int * visibleIndexes, int & numVisible, const int first, const int mask, const int numLanes) {
+	for (int k = 0; k < numLanes; ++k) {
+		visibleIndexes[numVisible] = first + k;
+		numVisible += (mask >> k) & 1;
+	}
+}
+
+//--------------------------------------------
+//				eoeSIMD
+// selects the fastest eoeSIMDProcessor the host cpu supports
+// EVIL_SIMD is the generic processor until Init is called
+//--------------------------------------------
+class eoeSIMD {
+public:
+
+	static void						Init();
+	static void						InitProcessor(bool forceGeneric);
+
+public:
+
+	static eoeSIMDProcessor *		processor;
+	static eoeSIMDProcessor *		generic;
+};
+
+#endif /* EOECORE_SIMD_H */
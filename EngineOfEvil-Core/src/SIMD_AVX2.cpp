@@ -0,0 +1,1743 @@
+#include "SIMD_AVX2.h"
+
+#ifdef EOE_SIMD_X86
+
+#include <immintrin.h>
+
+//--------------------------
+// LoadVec3x8_AVX2
+// splits eight packed eoeVec3s into x, y, and z registers
+// each 128-bit lane repeats the SSE2 four-vector shuffle
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline void LoadVec3x8_AVX2(const float * src, __m256 & x, __m256 & y, __m256 & z) {
+	__m256 a = _mm256_castps128_ps256(_mm_loadu_ps(src + 0));
+	__m256 b = _mm256_castps128_ps256(_mm_loadu_ps(src + 4));
+	__m256 c = _mm256_castps128_ps256(_mm_loadu_ps(src + 8));
+	a = _mm256_insertf128_ps(a, _mm_loadu_ps(src + 12), 1);
+	b = _mm256_insertf128_ps(b, _mm_loadu_ps(src + 16), 1);
+	c = _mm256_insertf128_ps(c, _mm_loadu_ps(src + 20), 1);
+
+	const __m256 xy = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+	const __m256 yz = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+	x = _mm256_shuffle_ps(a, xy, _MM_SHUFFLE(2, 0, 3, 0));
+	y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+	z = _mm256_shuffle_ps(yz, c, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+//--------------------------
+// StoreVec3x8_AVX2
+// packs x, y, and z registers into eight eoeVec3s
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline void StoreVec3x8_AVX2(float * dst, const __m256 x, const __m256 y, const __m256 z) {
+	const __m256 xy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+	const __m256 yz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+	const __m256 zx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+	const __m256 a = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+	const __m256 b = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+	const __m256 c = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+	_mm_storeu_ps(dst + 0, _mm256_castps256_ps128(a));
+	_mm_storeu_ps(dst + 4, _mm256_castps256_ps128(b));
+	_mm_storeu_ps(dst + 8, _mm256_castps256_ps128(c));
+	_mm_storeu_ps(dst + 12, _mm256_extractf128_ps(a, 1));
+	_mm_storeu_ps(dst + 16, _mm256_extractf128_ps(b, 1));
+	_mm_storeu_ps(dst + 20, _mm256_extractf128_ps(c, 1));
+}
+
+//--------------------------
+// Mat4_MultiplyMat4_AVX2
+// computes two result rows per pass, one per 128-bit lane,
+// summed in the same order as the generic loop so the result is bit-exact
+// the row pairs use unaligned 256-bit access, so dst and a only need the
+// 16-byte alignment the SSE2 kernels already require, eg: matrices in
+// caller-packed float buffers, and on aligned addresses it costs the same
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static void Mat4_MultiplyMat4_AVX2(float * dst, const float * a, const float * b) {
+	const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 0));
+	const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 4));
+	const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 8));
+	const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 12));
+
+	for (int r = 0; r < 4; r += 2) {
+		const __m256 rows = _mm256_loadu_ps(a);
+		__m256 result = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+		result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+		result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+		result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+		_mm256_storeu_ps(dst, result);
+		a += 8;
+		dst += 8;
+	}
+}
+
+//--------------------------
+// Mat4_MultiplyMat4sColumnMajor_AVX2
+// two result columns per pass, one per 128-bit lane, each lane
+// picking its own column of b[i] out of the broadcast rows
+// summed in the same order as the generic loop so the result is bit-exact
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static void Mat4_MultiplyMat4sColumnMajor_AVX2(float * dst, const float * a, const float * b, const int count) {
+	__m128 r0 = _mm_load_ps(a + 0);
+	__m128 r1 = _mm_load_ps(a + 4);
+	__m128 r2 = _mm_load_ps(a + 8);
+	__m128 r3 = _mm_load_ps(a + 12);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	const __m256 a0 = _mm256_insertf128_ps(_mm256_castps128_ps256(r0), r0, 1);
+	const __m256 a1 = _mm256_insertf128_ps(_mm256_castps128_ps256(r1), r1, 1);
+	const __m256 a2 = _mm256_insertf128_ps(_mm256_castps128_ps256(r2), r2, 1);
+	const __m256 a3 = _mm256_insertf128_ps(_mm256_castps128_ps256(r3), r3, 1);
+	const __m256i columns01 = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+	const __m256i columns23 = _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3);
+
+	for (int i = 0; i < count; ++i) {
+		const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 0));
+		const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 4));
+		const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 8));
+		const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b + 12));
+
+		for (int c = 0; c < 2; ++c) {
+			const __m256i columns = c == 0 ? columns01 : columns23;
+			__m256 result = _mm256_mul_ps(a0, _mm256_permutevar_ps(b0, columns));
+			result = _mm256_add_ps(result, _mm256_mul_ps(a1, _mm256_permutevar_ps(b1, columns)));
+			result = _mm256_add_ps(result, _mm256_mul_ps(a2, _mm256_permutevar_ps(b2, columns)));
+			result = _mm256_add_ps(result, _mm256_mul_ps(a3, _mm256_permutevar_ps(b3, columns)));
+			_mm256_storeu_ps(dst + c * 8, result);
+		}
+		b += 16;
+		dst += 16;
+	}
+}
+
+//--------------------------
+// Mat4_TransformVec4_AVX2
+// two eoeVec4s per pass, one per 128-bit lane, against the transposed matrix
+// returns the number of vectors transformed, the caller finishes the remainder
+//--------------------------
+template<eoeTransformMode_t mode>
+EOE_SIMD_TARGET("avx2")
+static int Mat4_TransformVec4_AVX2(float * dst, const float * m, const float * src, const int count) {
+	__m128 r0 = _mm_load_ps(m + 0);
+	__m128 r1 = _mm_load_ps(m + 4);
+	__m128 r2 = _mm_load_ps(m + 8);
+	__m128 r3 = _mm_load_ps(m + 12);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	const __m256 c0 = _mm256_insertf128_ps(_mm256_castps128_ps256(r0), r0, 1);
+	const __m256 c1 = _mm256_insertf128_ps(_mm256_castps128_ps256(r1), r1, 1);
+	const __m256 c2 = _mm256_insertf128_ps(_mm256_castps128_ps256(r2), r2, 1);
+	const __m256 c3 = _mm256_insertf128_ps(_mm256_castps128_ps256(r3), r3, 1);
+	const __m256 one = _mm256_set1_ps(1.0f);
+
+	int i = 0;
+	for (; i + 2 <= count; i += 2) {
+		const __m256 v = _mm256_loadu_ps(src);
+		__m256 result = _mm256_mul_ps(c0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+		result = _mm256_add_ps(result, _mm256_mul_ps(c1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1))));
+		result = _mm256_add_ps(result, _mm256_mul_ps(c2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2))));
+		if (mode != TRANSFORM_DIRECTION)
+			result = _mm256_add_ps(result, _mm256_mul_ps(c3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3))));
+
+		if (mode == TRANSFORM_PROJECTIVE) {
+			const __m256 invW = _mm256_div_ps(one, _mm256_permute_ps(result, _MM_SHUFFLE(3, 3, 3, 3)));
+			result = _mm256_blend_ps(_mm256_mul_ps(result, invW), one, 0x88);
+		}
+		_mm256_storeu_ps(dst, result);
+		src += 8;
+		dst += 8;
+	}
+	return i;
+}
+
+//--------------------------
+// Mat4_TransformVec3_AVX2
+// eight eoeVec3s per pass, split into x, y, and z registers
+// with every matrix element held in its own register
+// returns the number of vectors transformed, the caller finishes the remainder
+//--------------------------
+template<eoeTransformMode_t mode>
+EOE_SIMD_TARGET("avx2")
+static int Mat4_TransformVec3_AVX2(float * dst, const float * m, const float * src, const int count) {
+	const __m256 m00 = _mm256_set1_ps(m[ 0]), m01 = _mm256_set1_ps(m[ 1]), m02 = _mm256_set1_ps(m[ 2]), m03 = _mm256_set1_ps(m[ 3]);
+	const __m256 m10 = _mm256_set1_ps(m[ 4]), m11 = _mm256_set1_ps(m[ 5]), m12 = _mm256_set1_ps(m[ 6]), m13 = _mm256_set1_ps(m[ 7]);
+	const __m256 m20 = _mm256_set1_ps(m[ 8]), m21 = _mm256_set1_ps(m[ 9]), m22 = _mm256_set1_ps(m[10]), m23 = _mm256_set1_ps(m[11]);
+	const __m256 m30 = _mm256_set1_ps(m[12]), m31 = _mm256_set1_ps(m[13]), m32 = _mm256_set1_ps(m[14]), m33 = _mm256_set1_ps(m[15]);
+	const __m256 one = _mm256_set1_ps(1.0f);
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256 x, y, z;
+		LoadVec3x8_AVX2(src, x, y, z);
+
+		__m256 rx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m00, x), _mm256_mul_ps(m01, y)), _mm256_mul_ps(m02, z));
+		__m256 ry = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m10, x), _mm256_mul_ps(m11, y)), _mm256_mul_ps(m12, z));
+		__m256 rz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m20, x), _mm256_mul_ps(m21, y)), _mm256_mul_ps(m22, z));
+		if (mode != TRANSFORM_DIRECTION) {
+			rx = _mm256_add_ps(rx, m03);
+			ry = _mm256_add_ps(ry, m13);
+			rz = _mm256_add_ps(rz, m23);
+		}
+
+		if (mode == TRANSFORM_PROJECTIVE) {
+			const __m256 rw = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m30, x), _mm256_mul_ps(m31, y)), _mm256_mul_ps(m32, z)), m33);
+			const __m256 invW = _mm256_div_ps(one, rw);
+			rx = _mm256_mul_ps(rx, invW);
+			ry = _mm256_mul_ps(ry, invW);
+			rz = _mm256_mul_ps(rz, invW);
+		}
+		StoreVec3x8_AVX2(dst, rx, ry, rz);
+		src += 24;
+		dst += 24;
+	}
+	return i;
+}
+
+//--------------------------
+// Mat3x2_TransformVec2_AVX2
+// four eoeVec2s per register, eight per pass, with x and y duplicated across
+// each pair so the columns can be applied without transposing
+// returns the number of vectors transformed, the caller finishes the remainder
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Mat3x2_TransformVec2_AVX2(float * dst, const float * m, const float * src, const int count) {
+	const __m256 xAxis = _mm256_setr_ps(m[0], m[1], m[0], m[1], m[0], m[1], m[0], m[1]);
+	const __m256 yAxis = _mm256_setr_ps(m[2], m[3], m[2], m[3], m[2], m[3], m[2], m[3]);
+	const __m256 translation = _mm256_setr_ps(m[4], m[5], m[4], m[5], m[4], m[5], m[4], m[5]);
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 p0 = _mm256_loadu_ps(src);
+		const __m256 p1 = _mm256_loadu_ps(src + 8);
+		const __m256 x0 = _mm256_moveldup_ps(p0);
+		const __m256 y0 = _mm256_movehdup_ps(p0);
+		const __m256 x1 = _mm256_moveldup_ps(p1);
+		const __m256 y1 = _mm256_movehdup_ps(p1);
+
+		_mm256_storeu_ps(dst, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xAxis, x0), _mm256_mul_ps(yAxis, y0)), translation));
+		_mm256_storeu_ps(dst + 8, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xAxis, x1), _mm256_mul_ps(yAxis, y1)), translation));
+		src += 16;
+		dst += 16;
+	}
+	return i;
+}
+
+//--------------------------
+// Float_Add_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_Add_AVX2(float * dst, const float * a, const float * b, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+	return i;
+}
+
+//--------------------------
+// Float_Scale_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_Scale_AVX2(float * dst, const float * a, const float scale, const int count) {
+	const __m256 s = _mm256_set1_ps(scale);
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), s));
+	return i;
+}
+
+//--------------------------
+// Float_MultiplyAdd_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_MultiplyAdd_AVX2(float * dst, const float * a, const float * b, const float scale, const int count) {
+	const __m256 s = _mm256_set1_ps(scale);
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_mul_ps(_mm256_loadu_ps(b + i), s)));
+	return i;
+}
+
+//--------------------------
+// Float_SnapInt_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_SnapInt_AVX2(float * dst, const float * src, const int count) {
+	const __m256 half = _mm256_set1_ps(0.5f);
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(dst + i, _mm256_floor_ps(_mm256_add_ps(_mm256_loadu_ps(src + i), half)));
+	return i;
+}
+
+//--------------------------
+// SinCosFast_AVX2
+// same reduction, polynomials, and operation order as eoeMath::SinCosFast
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline void SinCosFast_AVX2(const __m256 x, __m256 & sin, __m256 & cos) {
+	const __m256i oneInt = _mm256_set1_epi32(1);
+	const __m256i twoInt = _mm256_set1_epi32(2);
+	const __m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(eoeMath::TWO_OVER_PI)));
+	const __m256 q = _mm256_cvtepi32_ps(quadrant);
+	__m256 r = _mm256_sub_ps(x, _mm256_mul_ps(q, _mm256_set1_ps(eoeMath::PIO2_HIGH)));
+	r = _mm256_sub_ps(r, _mm256_mul_ps(q, _mm256_set1_ps(eoeMath::PIO2_MID)));
+	r = _mm256_sub_ps(r, _mm256_mul_ps(q, _mm256_set1_ps(eoeMath::PIO2_LOW)));
+	const __m256 z = _mm256_mul_ps(r, r);
+
+	__m256 sinR = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(eoeMath::SIN_C2), z), _mm256_set1_ps(eoeMath::SIN_C1));
+	sinR = _mm256_add_ps(_mm256_mul_ps(sinR, z), _mm256_set1_ps(eoeMath::SIN_C0));
+	sinR = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(sinR, z), r), r);
+
+	__m256 cosR = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(eoeMath::COS_C2), z), _mm256_set1_ps(eoeMath::COS_C1));
+	cosR = _mm256_add_ps(_mm256_mul_ps(cosR, z), _mm256_set1_ps(eoeMath::COS_C0));
+	cosR = _mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(cosR, z), z), _mm256_mul_ps(_mm256_set1_ps(0.5f), z));
+	cosR = _mm256_add_ps(cosR, _mm256_set1_ps(1.0f));
+
+	const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, oneInt), oneInt));
+	const __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, twoInt), 30));
+	const __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, oneInt), twoInt), 30));
+	sin = _mm256_xor_ps(_mm256_or_ps(_mm256_and_ps(swap, cosR), _mm256_andnot_ps(swap, sinR)), sinSign);
+	cos = _mm256_xor_ps(_mm256_or_ps(_mm256_and_ps(swap, sinR), _mm256_andnot_ps(swap, cosR)), cosSign);
+}
+
+//--------------------------
+// Float_SinCosFast_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_SinCosFast_AVX2(float * sin, float * cos, const float * radians, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256 s;
+		__m256 c;
+		SinCosFast_AVX2(_mm256_loadu_ps(radians + i), s, c);
+		_mm256_storeu_ps(sin + i, s);
+		_mm256_storeu_ps(cos + i, c);
+	}
+	return i;
+}
+
+//--------------------------
+// Float_RSqrtFast_AVX2
+// same integer estimate and newton-raphson steps as eoeMath::RSqrtFast
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_RSqrtFast_AVX2(float * dst, const float * src, const int count) {
+	const __m256i magic = _mm256_set1_epi32(eoeMath::RSQRT_MAGIC);
+	const __m256 half = _mm256_set1_ps(0.5f);
+	const __m256 threeHalves = _mm256_set1_ps(1.5f);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 x = _mm256_loadu_ps(src + i);
+		const __m256 halfX = _mm256_mul_ps(half, x);
+		__m256 y = _mm256_castsi256_ps(_mm256_sub_epi32(magic, _mm256_srai_epi32(_mm256_castps_si256(x), 1)));
+		y = _mm256_mul_ps(y, _mm256_sub_ps(threeHalves, _mm256_mul_ps(_mm256_mul_ps(halfX, y), y)));
+		y = _mm256_mul_ps(y, _mm256_sub_ps(threeHalves, _mm256_mul_ps(_mm256_mul_ps(halfX, y), y)));
+		_mm256_storeu_ps(dst + i, y);
+	}
+	return i;
+}
+
+//--------------------------
+// ATan2Fast_AVX2
+// same octant reduction and polynomial as eoeMath::ATan2Fast
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 ATan2Fast_AVX2(const __m256 vy, const __m256 vx) {
+	const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+	const __m256 signMask = _mm256_set1_ps(-0.0f);
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 absX = _mm256_and_ps(vx, absMask);
+	const __m256 absY = _mm256_and_ps(vy, absMask);
+	const __m256 maxXY = _mm256_max_ps(absX, absY);
+	const __m256 minXY = _mm256_min_ps(absX, absY);
+	const __m256 a = _mm256_and_ps(_mm256_div_ps(minXY, maxXY), _mm256_cmp_ps(maxXY, zero, _CMP_NEQ_UQ));
+	const __m256 s = _mm256_mul_ps(a, a);
+
+	__m256 angle = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(eoeMath::ATAN_C4), s), _mm256_set1_ps(eoeMath::ATAN_C3));
+	angle = _mm256_add_ps(_mm256_mul_ps(angle, s), _mm256_set1_ps(eoeMath::ATAN_C2));
+	angle = _mm256_add_ps(_mm256_mul_ps(angle, s), _mm256_set1_ps(eoeMath::ATAN_C1));
+	angle = _mm256_add_ps(_mm256_mul_ps(angle, s), _mm256_set1_ps(eoeMath::ATAN_C0));
+	angle = _mm256_mul_ps(angle, a);
+
+	const __m256 steep = _mm256_cmp_ps(absY, absX, _CMP_GT_OQ);
+	angle = _mm256_or_ps(_mm256_and_ps(steep, _mm256_sub_ps(_mm256_set1_ps(eoeMath::HALF_PI), angle)), _mm256_andnot_ps(steep, angle));
+	const __m256 negativeX = _mm256_cmp_ps(vx, zero, _CMP_LT_OQ);
+	angle = _mm256_or_ps(_mm256_and_ps(negativeX, _mm256_sub_ps(_mm256_set1_ps(eoeMath::PI), angle)), _mm256_andnot_ps(negativeX, angle));
+	angle = _mm256_xor_ps(angle, _mm256_and_ps(vy, signMask));
+	return angle;
+}
+
+//--------------------------
+// Float_ATan2Fast_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_ATan2Fast_AVX2(float * dst, const float * y, const float * x, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(dst + i, ATan2Fast_AVX2(_mm256_loadu_ps(y + i), _mm256_loadu_ps(x + i)));
+	return i;
+}
+
+//--------------------------
+// Float_IsometricToOrthographic_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_IsometricToOrthographic_AVX2(float * x, float * y, const int count) {
+	const __m256 two = _mm256_set1_ps(2.0f);
+	const __m256 half = _mm256_set1_ps(0.5f);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 isoX = _mm256_loadu_ps(x + i);
+		const __m256 twoIsoY = _mm256_mul_ps(two, _mm256_loadu_ps(y + i));
+		_mm256_storeu_ps(x + i, _mm256_mul_ps(_mm256_add_ps(twoIsoY, isoX), half));
+		_mm256_storeu_ps(y + i, _mm256_mul_ps(_mm256_sub_ps(twoIsoY, isoX), half));
+	}
+	return i;
+}
+
+//--------------------------
+// Float_OrthographicToIsometric_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_OrthographicToIsometric_AVX2(float * x, float * y, const int count) {
+	const __m256 half = _mm256_set1_ps(0.5f);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 cartX = _mm256_loadu_ps(x + i);
+		const __m256 cartY = _mm256_loadu_ps(y + i);
+		_mm256_storeu_ps(x + i, _mm256_sub_ps(cartX, cartY));
+		_mm256_storeu_ps(y + i, _mm256_mul_ps(_mm256_add_ps(cartX, cartY), half));
+	}
+	return i;
+}
+
+//--------------------------
+// Int_IsometricToOrthographic_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Int_IsometricToOrthographic_AVX2(int * x, int * y, const int count) {
+	const __m256i one = _mm256_set1_epi32(1);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256i isoX = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i));
+		const __m256i isoY = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(x + i), _mm256_add_epi32(isoY, _mm256_srai_epi32(_mm256_add_epi32(isoX, one), 1)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(y + i), _mm256_add_epi32(isoY, _mm256_srai_epi32(_mm256_sub_epi32(one, isoX), 1)));
+	}
+	return i;
+}
+
+//--------------------------
+// Int_OrthographicToIsometric_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Int_OrthographicToIsometric_AVX2(int * x, int * y, const int count) {
+	const __m256i one = _mm256_set1_epi32(1);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256i cartX = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i));
+		const __m256i cartY = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(x + i), _mm256_sub_epi32(cartX, cartY));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(y + i), _mm256_srai_epi32(_mm256_add_epi32(_mm256_add_epi32(cartX, cartY), one), 1));
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_Dot_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int SoA_Dot_AVX2(float * dst, const float * const * a, const float * const * b, const int numComponents, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256 dot = _mm256_mul_ps(_mm256_loadu_ps(a[0] + i), _mm256_loadu_ps(b[0] + i));
+		for (int c = 1; c < numComponents; ++c)
+			dot = _mm256_add_ps(dot, _mm256_mul_ps(_mm256_loadu_ps(a[c] + i), _mm256_loadu_ps(b[c] + i)));
+		_mm256_storeu_ps(dst + i, dot);
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_Length_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int SoA_Length_AVX2(float * dst, const float * const * a, const int numComponents, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256 v = _mm256_loadu_ps(a[0] + i);
+		__m256 lengthSquared = _mm256_mul_ps(v, v);
+		for (int c = 1; c < numComponents; ++c) {
+			v = _mm256_loadu_ps(a[c] + i);
+			lengthSquared = _mm256_add_ps(lengthSquared, _mm256_mul_ps(v, v));
+		}
+		_mm256_storeu_ps(dst + i, _mm256_sqrt_ps(lengthSquared));
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_Normalize_AVX2
+// divides by the correctly rounded sqrt, so it matches eoeVec3::Normalize exactly
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int SoA_Normalize_AVX2(float * const * a, const int numComponents, const int count) {
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 zero = _mm256_setzero_ps();
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256 v = _mm256_loadu_ps(a[0] + i);
+		__m256 length = _mm256_mul_ps(v, v);
+		for (int c = 1; c < numComponents; ++c) {
+			v = _mm256_loadu_ps(a[c] + i);
+			length = _mm256_add_ps(length, _mm256_mul_ps(v, v));
+		}
+		length = _mm256_sqrt_ps(length);
+
+		const __m256 invLength = _mm256_andnot_ps(_mm256_cmp_ps(length, zero, _CMP_EQ_OQ), _mm256_div_ps(one, length));
+		for (int c = 0; c < numComponents; ++c)
+			_mm256_storeu_ps(a[c] + i, _mm256_mul_ps(_mm256_loadu_ps(a[c] + i), invLength));
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_Cross_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int SoA_Cross_AVX2(float * const * dst, const float * const * a, const float * const * b, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 ax = _mm256_loadu_ps(a[0] + i), ay = _mm256_loadu_ps(a[1] + i), az = _mm256_loadu_ps(a[2] + i);
+		const __m256 bx = _mm256_loadu_ps(b[0] + i), by = _mm256_loadu_ps(b[1] + i), bz = _mm256_loadu_ps(b[2] + i);
+		_mm256_storeu_ps(dst[0] + i, _mm256_sub_ps(_mm256_mul_ps(ay, bz), _mm256_mul_ps(az, by)));
+		_mm256_storeu_ps(dst[1] + i, _mm256_sub_ps(_mm256_mul_ps(az, bx), _mm256_mul_ps(ax, bz)));
+		_mm256_storeu_ps(dst[2] + i, _mm256_sub_ps(_mm256_mul_ps(ax, by), _mm256_mul_ps(ay, bx)));
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_FromVec3_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int SoA_FromVec3_AVX2(float * const * dst, const float * src, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256 x, y, z;
+		LoadVec3x8_AVX2(src + i * 3, x, y, z);
+		_mm256_storeu_ps(dst[0] + i, x);
+		_mm256_storeu_ps(dst[1] + i, y);
+		_mm256_storeu_ps(dst[2] + i, z);
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_FromVec4_AVX2
+// transposes two 4x4 blocks at once, one per 128-bit lane
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int SoA_FromVec4_AVX2(float * const * dst, const float * src, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const float * v = src + i * 4;
+		const __m256 v04 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(v + 0)), _mm_load_ps(v + 16), 1);
+		const __m256 v15 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(v + 4)), _mm_load_ps(v + 20), 1);
+		const __m256 v26 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(v + 8)), _mm_load_ps(v + 24), 1);
+		const __m256 v37 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_load_ps(v + 12)), _mm_load_ps(v + 28), 1);
+		const __m256 xy01 = _mm256_unpacklo_ps(v04, v15);
+		const __m256 zw01 = _mm256_unpackhi_ps(v04, v15);
+		const __m256 xy23 = _mm256_unpacklo_ps(v26, v37);
+		const __m256 zw23 = _mm256_unpackhi_ps(v26, v37);
+		_mm256_storeu_ps(dst[0] + i, _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0)));
+		_mm256_storeu_ps(dst[1] + i, _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2)));
+		_mm256_storeu_ps(dst[2] + i, _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0)));
+		_mm256_storeu_ps(dst[3] + i, _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2)));
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_ToVec3_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int SoA_ToVec3_AVX2(float * dst, const float * const * src, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+		StoreVec3x8_AVX2(dst + i * 3, _mm256_loadu_ps(src[0] + i), _mm256_loadu_ps(src[1] + i), _mm256_loadu_ps(src[2] + i));
+	return i;
+}
+
+//--------------------------
+// SoA_ToVec4_AVX2
+// transposes two 4x4 blocks at once, one per 128-bit lane
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int SoA_ToVec4_AVX2(float * dst, const float * const * src, const int count) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 x = _mm256_loadu_ps(src[0] + i);
+		const __m256 y = _mm256_loadu_ps(src[1] + i);
+		const __m256 z = _mm256_loadu_ps(src[2] + i);
+		const __m256 w = _mm256_loadu_ps(src[3] + i);
+		const __m256 xy01 = _mm256_unpacklo_ps(x, y);
+		const __m256 xy23 = _mm256_unpackhi_ps(x, y);
+		const __m256 zw01 = _mm256_unpacklo_ps(z, w);
+		const __m256 zw23 = _mm256_unpackhi_ps(z, w);
+		const __m256 v04 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0));
+		const __m256 v15 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2));
+		const __m256 v26 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+		const __m256 v37 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+		float * v = dst + i * 4;
+		_mm256_storeu_ps(v + 0, _mm256_permute2f128_ps(v04, v15, 0x20));
+		_mm256_storeu_ps(v + 8, _mm256_permute2f128_ps(v26, v37, 0x20));
+		_mm256_storeu_ps(v + 16, _mm256_permute2f128_ps(v04, v15, 0x31));
+		_mm256_storeu_ps(v + 24, _mm256_permute2f128_ps(v26, v37, 0x31));
+	}
+	return i;
+}
+
+//--------------------------
+// Load4x4Pairs_AVX2
+// loads four rows of four floats from lo and the same from hi = lo + hiOffset,
+// then transposes both 4x4 blocks at once, one per 128-bit lane
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline void Load4x4Pairs_AVX2(const float * lo, const int rowStride, const int hiOffset, __m256 & c0, __m256 & c1, __m256 & c2, __m256 & c3) {
+	const __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo + 0 * rowStride)), _mm_loadu_ps(lo + hiOffset + 0 * rowStride), 1);
+	const __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo + 1 * rowStride)), _mm_loadu_ps(lo + hiOffset + 1 * rowStride), 1);
+	const __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo + 2 * rowStride)), _mm_loadu_ps(lo + hiOffset + 2 * rowStride), 1);
+	const __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo + 3 * rowStride)), _mm_loadu_ps(lo + hiOffset + 3 * rowStride), 1);
+	const __m256 xy01 = _mm256_unpacklo_ps(r0, r1);
+	const __m256 zw01 = _mm256_unpackhi_ps(r0, r1);
+	const __m256 xy23 = _mm256_unpacklo_ps(r2, r3);
+	const __m256 zw23 = _mm256_unpackhi_ps(r2, r3);
+	c0 = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+	c1 = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+	c2 = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+	c3 = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+//--------------------------
+// Cull_AABBs_AVX2
+// eight boxes per iteration, each plane tested in the same order as eoeAABB::IsOutside
+// returns the number of boxes tested, numVisible receives how many indexes were written
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Cull_AABBs_AVX2(int * visibleIndexes, int & numVisible, const eoePlane * planes, const int numPlanes, const eoeAABB * bounds, const int count) {
+	const __m256 half = _mm256_set1_ps(0.5f);
+	const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+	const __m256 zero = _mm256_setzero_ps();
+	const float * src = reinterpret_cast<const float *>(bounds);
+	numVisible = 0;
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8, src += 48) {
+		// (mins.x, mins.y, mins.z, maxs.x) and (mins.z, maxs.x, maxs.y, maxs.z) of each box, transposed
+		__m256 minX, minY, minZ, maxX, maxY, maxZ, skip0, skip1;
+		Load4x4Pairs_AVX2(src, 6, 24, minX, minY, minZ, maxX);
+		Load4x4Pairs_AVX2(src + 2, 6, 24, skip0, skip1, maxY, maxZ);
+
+		const __m256 centerX = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+		const __m256 centerY = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+		const __m256 centerZ = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+		const __m256 extentX = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+		const __m256 extentY = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+		const __m256 extentZ = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+		__m256 outside = zero;
+		for (int p = 0; p < numPlanes; ++p) {
+			const __m256 normalX = _mm256_broadcast_ss(&planes[p].normal.x);
+			const __m256 normalY = _mm256_broadcast_ss(&planes[p].normal.y);
+			const __m256 normalZ = _mm256_broadcast_ss(&planes[p].normal.z);
+			__m256 distance = _mm256_add_ps(_mm256_mul_ps(normalX, centerX), _mm256_mul_ps(normalY, centerY));
+			distance = _mm256_add_ps(distance, _mm256_mul_ps(normalZ, centerZ));
+			distance = _mm256_add_ps(distance, _mm256_broadcast_ss(&planes[p].d));
+			__m256 radius = _mm256_add_ps(_mm256_mul_ps(_mm256_and_ps(normalX, absMask), extentX), _mm256_mul_ps(_mm256_and_ps(normalY, absMask), extentY));
+			radius = _mm256_add_ps(radius, _mm256_mul_ps(_mm256_and_ps(normalZ, absMask), extentZ));
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_LT_OQ));
+		}
+		CompactIndexes(visibleIndexes, numVisible, i, ~_mm256_movemask_ps(outside) & 0xff, 8);
+	}
+	return i;
+}
+
+//--------------------------
+// Cull_Spheres_AVX2
+// eight spheres per iteration, each plane tested in the same order as eoeSphere::IsOutside
+// returns the number of spheres tested, numVisible receives how many indexes were written
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Cull_Spheres_AVX2(int * visibleIndexes, int & numVisible, const eoePlane * planes, const int numPlanes, const eoeSphere * spheres, const int count) {
+	const __m256 signMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+	const float * src = reinterpret_cast<const float *>(spheres);
+	numVisible = 0;
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8, src += 32) {
+		__m256 originX, originY, originZ, radius;
+		Load4x4Pairs_AVX2(src, 4, 16, originX, originY, originZ, radius);
+		const __m256 negRadius = _mm256_xor_ps(radius, signMask);
+
+		__m256 outside = _mm256_setzero_ps();
+		for (int p = 0; p < numPlanes; ++p) {
+			__m256 distance = _mm256_add_ps(_mm256_mul_ps(_mm256_broadcast_ss(&planes[p].normal.x), originX), _mm256_mul_ps(_mm256_broadcast_ss(&planes[p].normal.y), originY));
+			distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_broadcast_ss(&planes[p].normal.z), originZ));
+			distance = _mm256_add_ps(distance, _mm256_broadcast_ss(&planes[p].d));
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negRadius, _CMP_LT_OQ));
+		}
+		CompactIndexes(visibleIndexes, numVisible, i, ~_mm256_movemask_ps(outside) & 0xff, 8);
+	}
+	return i;
+}
+
+//--------------------------
+// Random_Step_AVX2
+// one eoeRandom::Step of eight lanes, the multiplies by 5 and 9 as shifts and adds
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256i Random_Step_AVX2(__m256i * s) {
+	const __m256i scrambled = _mm256_add_epi32(_mm256_slli_epi32(s[1], 2), s[1]);
+	const __m256i rotated = _mm256_or_si256(_mm256_slli_epi32(scrambled, 7), _mm256_srli_epi32(scrambled, 25));
+	const __m256i result = _mm256_add_epi32(_mm256_slli_epi32(rotated, 3), rotated);
+	const __m256i t = _mm256_slli_epi32(s[1], 9);
+
+	s[2] = _mm256_xor_si256(s[2], s[0]);
+	s[3] = _mm256_xor_si256(s[3], s[1]);
+	s[1] = _mm256_xor_si256(s[1], s[2]);
+	s[0] = _mm256_xor_si256(s[0], s[3]);
+	s[2] = _mm256_xor_si256(s[2], t);
+	s[3] = _mm256_or_si256(_mm256_slli_epi32(s[3], 11), _mm256_srli_epi32(s[3], 21));
+	return result;
+}
+
+//--------------------------
+// Random_MulHigh_AVX2
+// high 32 bits of each unsigned 32x32 product of bits and span
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256i Random_MulHigh_AVX2(const __m256i bits, const __m256i span) {
+	const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(bits, span), 32);
+	const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(bits, 32), span);
+	return _mm256_or_si256(even, _mm256_and_si256(odd, _mm256_set_epi32(-1, 0, -1, 0, -1, 0, -1, 0)));
+}
+
+//--------------------------
+// Random_FillUInts_AVX2
+// whole steps only, returns the number of outputs written
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Random_FillUInts_AVX2(uint32_t * state, uint32_t * dst, const int count) {
+	__m256i s[4];
+	for (int word = 0; word < 4; ++word)
+		s[word] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state + word * EOE_RANDOM_LANES));
+	int i = 0;
+	for (; i + EOE_RANDOM_LANES <= count; i += EOE_RANDOM_LANES) {
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), Random_Step_AVX2(s));
+	}
+	for (int word = 0; word < 4; ++word)
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(state + word * EOE_RANDOM_LANES), s[word]);
+	return i;
+}
+
+//--------------------------
+// Random_FillFloats_AVX2
+// same operation order as eoeRandom::ToFloat
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Random_FillFloats_AVX2(uint32_t * state, float * dst, const int count, const float min, const float range) {
+	__m256i s[4];
+	for (int word = 0; word < 4; ++word)
+		s[word] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state + word * EOE_RANDOM_LANES));
+	const __m256 toUnit = _mm256_set1_ps(1.0f / 16777216.0f);
+	const __m256 minV = _mm256_set1_ps(min);
+	const __m256 rangeV = _mm256_set1_ps(range);
+	int i = 0;
+	for (; i + EOE_RANDOM_LANES <= count; i += EOE_RANDOM_LANES) {
+		const __m256 unit = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(Random_Step_AVX2(s), 8)), toUnit);
+		_mm256_storeu_ps(dst + i, _mm256_add_ps(minV, _mm256_mul_ps(unit, rangeV)));
+	}
+	for (int word = 0; word < 4; ++word)
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(state + word * EOE_RANDOM_LANES), s[word]);
+	return i;
+}
+
+//--------------------------
+// Random_FillInts_AVX2
+// same as eoeRandom::ToInt, a span of 2^32 passes the bits straight through
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Random_FillInts_AVX2(uint32_t * state, int * dst, const int count, const int min, const uint64_t span) {
+	__m256i s[4];
+	for (int word = 0; word < 4; ++word)
+		s[word] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(state + word * EOE_RANDOM_LANES));
+	const bool fullRange = span > 0xffffffffull;
+	const __m256i spanV = _mm256_set1_epi32((int)(uint32_t)span);
+	const __m256i minV = _mm256_set1_epi32(min);
+	int i = 0;
+	for (; i + EOE_RANDOM_LANES <= count; i += EOE_RANDOM_LANES) {
+		const __m256i bits = Random_Step_AVX2(s);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_add_epi32(minV, fullRange ? bits : Random_MulHigh_AVX2(bits, spanV)));
+	}
+	for (int word = 0; word < 4; ++word)
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(state + word * EOE_RANDOM_LANES), s[word]);
+	return i;
+}
+
+//--------------------------
+// Select_AVX2
+// mask ? a : b per lane, mask lanes all ones or all zeros
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 Select_AVX2(const __m256 mask, const __m256 a, const __m256 b) {
+	return _mm256_blendv_ps(b, a, mask);
+}
+
+//--------------------------
+// Noise_Floor_AVX2
+// same as eoeNoise::Floor
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256i Noise_Floor_AVX2(const __m256 x) {
+	const __m256i truncated = _mm256_cvttps_epi32(x);
+	return _mm256_add_epi32(truncated, _mm256_castps_si256(_mm256_cmp_ps(_mm256_cvtepi32_ps(truncated), x, _CMP_GT_OQ)));
+}
+
+//--------------------------
+// Noise_Mix_AVX2
+// same as eoeNoise::Mix
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256i Noise_Mix_AVX2(__m256i hash) {
+	hash = _mm256_xor_si256(hash, _mm256_srli_epi32(hash, 16));
+	hash = _mm256_mullo_epi32(hash, _mm256_set1_epi32((int)eoeNoise::MIX_0));
+	hash = _mm256_xor_si256(hash, _mm256_srli_epi32(hash, 15));
+	hash = _mm256_mullo_epi32(hash, _mm256_set1_epi32((int)eoeNoise::MIX_1));
+	return _mm256_xor_si256(hash, _mm256_srli_epi32(hash, 16));
+}
+
+//--------------------------
+// Noise_Hash2_AVX2
+// same as eoeNoise::Hash of x, y
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256i Noise_Hash2_AVX2(const __m256i x, const __m256i y, const __m256i seed) {
+	const __m256i hx = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)eoeNoise::HASH_X));
+	const __m256i hy = _mm256_mullo_epi32(y, _mm256_set1_epi32((int)eoeNoise::HASH_Y));
+	return Noise_Mix_AVX2(_mm256_xor_si256(_mm256_xor_si256(seed, hx), hy));
+}
+
+//--------------------------
+// Noise_Hash3_AVX2
+// same as eoeNoise::Hash of x, y, z
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256i Noise_Hash3_AVX2(const __m256i x, const __m256i y, const __m256i z, const __m256i seed) {
+	const __m256i hx = _mm256_mullo_epi32(x, _mm256_set1_epi32((int)eoeNoise::HASH_X));
+	const __m256i hy = _mm256_mullo_epi32(y, _mm256_set1_epi32((int)eoeNoise::HASH_Y));
+	const __m256i hz = _mm256_mullo_epi32(z, _mm256_set1_epi32((int)eoeNoise::HASH_Z));
+	return Noise_Mix_AVX2(_mm256_xor_si256(_mm256_xor_si256(_mm256_xor_si256(seed, hx), hy), hz));
+}
+
+//--------------------------
+// Noise_HashToFloat_AVX2
+// same as eoeNoise::HashToFloat
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 Noise_HashToFloat_AVX2(const __m256i hash) {
+	const __m256 high = _mm256_cvtepi32_ps(_mm256_srli_epi32(hash, 8));
+	return _mm256_sub_ps(_mm256_mul_ps(high, _mm256_set1_ps(2.0f / 16777216.0f)), _mm256_set1_ps(1.0f));
+}
+
+//--------------------------
+// Noise_Fade_AVX2
+// same as eoeNoise::Fade
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 Noise_Fade_AVX2(const __m256 t) {
+	const __m256 cube = _mm256_mul_ps(_mm256_mul_ps(t, t), t);
+	const __m256 inner = _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f));
+	return _mm256_mul_ps(cube, _mm256_add_ps(_mm256_mul_ps(t, inner), _mm256_set1_ps(10.0f)));
+}
+
+//--------------------------
+// Noise_Lerp_AVX2
+// same as eoeNoise::Lerp
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 Noise_Lerp_AVX2(const __m256 a, const __m256 b, const __m256 t) {
+	return _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), t));
+}
+
+//--------------------------
+// Noise_Gradient2_AVX2
+// same as the 2D eoeNoise::Gradient, the negations as sign flips
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 Noise_Gradient2_AVX2(const __m256i hash, const __m256 x, const __m256 y) {
+	const __m256i four = _mm256_set1_epi32(4);
+	const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(hash, four), four));
+	const __m256 u = Select_AVX2(swap, y, x);
+	const __m256 v = _mm256_mul_ps(_mm256_set1_ps(2.0f), Select_AVX2(swap, x, y));
+	const __m256 uSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(hash, _mm256_set1_epi32(1)), 31));
+	const __m256 vSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(hash, _mm256_set1_epi32(2)), 30));
+	return _mm256_add_ps(_mm256_xor_ps(u, uSign), _mm256_xor_ps(v, vSign));
+}
+
+//--------------------------
+// Noise_Gradient3_AVX2
+// same as the 3D eoeNoise::Gradient, the negations as sign flips
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 Noise_Gradient3_AVX2(const __m256i hash, const __m256 x, const __m256 y, const __m256 z) {
+	const __m256i edge = _mm256_and_si256(hash, _mm256_set1_epi32(15));
+	const __m256 uIsX = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(8), edge));
+	const __m256 vIsY = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), edge));
+	const __m256 vIsX = _mm256_castsi256_ps(_mm256_or_si256(_mm256_cmpeq_epi32(edge, _mm256_set1_epi32(12)), _mm256_cmpeq_epi32(edge, _mm256_set1_epi32(14))));
+	const __m256 u = Select_AVX2(uIsX, x, y);
+	const __m256 v = Select_AVX2(vIsY, y, Select_AVX2(vIsX, x, z));
+	const __m256 uSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(edge, _mm256_set1_epi32(1)), 31));
+	const __m256 vSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(edge, _mm256_set1_epi32(2)), 30));
+	return _mm256_add_ps(_mm256_xor_ps(u, uSign), _mm256_xor_ps(v, vSign));
+}
+
+//--------------------------
+// Noise_Falloff2_AVX2
+// same as the 2D eoeNoise::Falloff
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 Noise_Falloff2_AVX2(const __m256 x, const __m256 y) {
+	__m256 t = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(eoeNoise::RADIUS_SQUARED), _mm256_mul_ps(x, x)), _mm256_mul_ps(y, y));
+	t = _mm256_max_ps(t, _mm256_setzero_ps());
+	t = _mm256_mul_ps(t, t);
+	return _mm256_mul_ps(t, t);
+}
+
+//--------------------------
+// Noise_Falloff3_AVX2
+// same as the 3D eoeNoise::Falloff
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 Noise_Falloff3_AVX2(const __m256 x, const __m256 y, const __m256 z) {
+	__m256 t = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(eoeNoise::RADIUS_SQUARED), _mm256_mul_ps(x, x)), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z));
+	t = _mm256_max_ps(t, _mm256_setzero_ps());
+	t = _mm256_mul_ps(t, t);
+	return _mm256_mul_ps(t, t);
+}
+
+//--------------------------
+// Noise_Value2D_AVX2
+// same lattice, fade, and lerp order as eoeNoise::Value2D
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Noise_Value2D_AVX2(float * dst, const float * x, const float * y, const int count, const uint32_t seed) {
+	const __m256i seedV = _mm256_set1_epi32((int)seed);
+	const __m256i one = _mm256_set1_epi32(1);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 vx = _mm256_loadu_ps(x + i);
+		const __m256 vy = _mm256_loadu_ps(y + i);
+		const __m256i ix = Noise_Floor_AVX2(vx);
+		const __m256i iy = Noise_Floor_AVX2(vy);
+		const __m256i ix1 = _mm256_add_epi32(ix, one);
+		const __m256i iy1 = _mm256_add_epi32(iy, one);
+		const __m256 u = Noise_Fade_AVX2(_mm256_sub_ps(vx, _mm256_cvtepi32_ps(ix)));
+		const __m256 v = Noise_Fade_AVX2(_mm256_sub_ps(vy, _mm256_cvtepi32_ps(iy)));
+
+		const __m256 bottom = Noise_Lerp_AVX2(Noise_HashToFloat_AVX2(Noise_Hash2_AVX2(ix, iy, seedV)), Noise_HashToFloat_AVX2(Noise_Hash2_AVX2(ix1, iy, seedV)), u);
+		const __m256 top = Noise_Lerp_AVX2(Noise_HashToFloat_AVX2(Noise_Hash2_AVX2(ix, iy1, seedV)), Noise_HashToFloat_AVX2(Noise_Hash2_AVX2(ix1, iy1, seedV)), u);
+		_mm256_storeu_ps(dst + i, Noise_Lerp_AVX2(bottom, top, v));
+	}
+	return i;
+}
+
+//--------------------------
+// Noise_Value3D_AVX2
+// same lattice, fade, and lerp order as eoeNoise::Value3D
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Noise_Value3D_AVX2(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) {
+	const __m256i seedV = _mm256_set1_epi32((int)seed);
+	const __m256i one = _mm256_set1_epi32(1);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 vx = _mm256_loadu_ps(x + i);
+		const __m256 vy = _mm256_loadu_ps(y + i);
+		const __m256 vz = _mm256_loadu_ps(z + i);
+		const __m256i ix = Noise_Floor_AVX2(vx);
+		const __m256i iy = Noise_Floor_AVX2(vy);
+		const __m256i iz = Noise_Floor_AVX2(vz);
+		const __m256i ix1 = _mm256_add_epi32(ix, one);
+		const __m256i iy1 = _mm256_add_epi32(iy, one);
+		const __m256i iz1 = _mm256_add_epi32(iz, one);
+		const __m256 u = Noise_Fade_AVX2(_mm256_sub_ps(vx, _mm256_cvtepi32_ps(ix)));
+		const __m256 v = Noise_Fade_AVX2(_mm256_sub_ps(vy, _mm256_cvtepi32_ps(iy)));
+		const __m256 w = Noise_Fade_AVX2(_mm256_sub_ps(vz, _mm256_cvtepi32_ps(iz)));
+
+		const __m256 nearBottom = Noise_Lerp_AVX2(Noise_HashToFloat_AVX2(Noise_Hash3_AVX2(ix, iy, iz, seedV)), Noise_HashToFloat_AVX2(Noise_Hash3_AVX2(ix1, iy, iz, seedV)), u);
+		const __m256 nearTop = Noise_Lerp_AVX2(Noise_HashToFloat_AVX2(Noise_Hash3_AVX2(ix, iy1, iz, seedV)), Noise_HashToFloat_AVX2(Noise_Hash3_AVX2(ix1, iy1, iz, seedV)), u);
+		const __m256 farBottom = Noise_Lerp_AVX2(Noise_HashToFloat_AVX2(Noise_Hash3_AVX2(ix, iy, iz1, seedV)), Noise_HashToFloat_AVX2(Noise_Hash3_AVX2(ix1, iy, iz1, seedV)), u);
+		const __m256 farTop = Noise_Lerp_AVX2(Noise_HashToFloat_AVX2(Noise_Hash3_AVX2(ix, iy1, iz1, seedV)), Noise_HashToFloat_AVX2(Noise_Hash3_AVX2(ix1, iy1, iz1, seedV)), u);
+		_mm256_storeu_ps(dst + i, Noise_Lerp_AVX2(Noise_Lerp_AVX2(nearBottom, nearTop, v), Noise_Lerp_AVX2(farBottom, farTop, v), w));
+	}
+	return i;
+}
+
+//--------------------------
+// Noise_Simplex2D_AVX2
+// same skew, corner order, and sums as eoeNoise::Simplex2D
+// the corner offsets come from all-ones masks, so i + i1 is i - mask
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Noise_Simplex2D_AVX2(float * dst, const float * x, const float * y, const int count, const uint32_t seed) {
+	const __m256i seedV = _mm256_set1_epi32((int)seed);
+	const __m256i oneInt = _mm256_set1_epi32(1);
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 unskew1 = _mm256_set1_ps(eoeNoise::UNSKEW_2D);
+	const __m256 unskew2 = _mm256_set1_ps(eoeNoise::UNSKEW_2D_2);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 vx = _mm256_loadu_ps(x + i);
+		const __m256 vy = _mm256_loadu_ps(y + i);
+		const __m256 skew = _mm256_mul_ps(_mm256_add_ps(vx, vy), _mm256_set1_ps(eoeNoise::SKEW_2D));
+		const __m256i ci = Noise_Floor_AVX2(_mm256_add_ps(vx, skew));
+		const __m256i cj = Noise_Floor_AVX2(_mm256_add_ps(vy, skew));
+		const __m256 unskew = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(ci, cj)), unskew1);
+		const __m256 x0 = _mm256_sub_ps(vx, _mm256_sub_ps(_mm256_cvtepi32_ps(ci), unskew));
+		const __m256 y0 = _mm256_sub_ps(vy, _mm256_sub_ps(_mm256_cvtepi32_ps(cj), unskew));
+
+		const __m256 lower = _mm256_cmp_ps(x0, y0, _CMP_GT_OQ);
+		const __m256i lowerInt = _mm256_castps_si256(lower);
+		const __m256 x1 = _mm256_add_ps(_mm256_sub_ps(x0, _mm256_and_ps(lower, one)), unskew1);
+		const __m256 y1 = _mm256_add_ps(_mm256_sub_ps(y0, _mm256_andnot_ps(lower, one)), unskew1);
+		const __m256 x2 = _mm256_add_ps(_mm256_sub_ps(x0, one), unskew2);
+		const __m256 y2 = _mm256_add_ps(_mm256_sub_ps(y0, one), unskew2);
+
+		const __m256i ci1 = _mm256_add_epi32(ci, oneInt);
+		const __m256i cj1 = _mm256_add_epi32(cj, oneInt);
+		const __m256 n0 = _mm256_mul_ps(Noise_Falloff2_AVX2(x0, y0), Noise_Gradient2_AVX2(Noise_Hash2_AVX2(ci, cj, seedV), x0, y0));
+		const __m256 n1 = _mm256_mul_ps(Noise_Falloff2_AVX2(x1, y1), Noise_Gradient2_AVX2(Noise_Hash2_AVX2(_mm256_sub_epi32(ci, lowerInt), _mm256_add_epi32(cj1, lowerInt), seedV), x1, y1));
+		const __m256 n2 = _mm256_mul_ps(Noise_Falloff2_AVX2(x2, y2), Noise_Gradient2_AVX2(Noise_Hash2_AVX2(ci1, cj1, seedV), x2, y2));
+		_mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(n0, n1), n2), _mm256_set1_ps(eoeNoise::SCALE_2D)));
+	}
+	return i;
+}
+
+//--------------------------
+// Noise_Simplex3D_AVX2
+// same skew, corner order, and sums as eoeNoise::Simplex3D
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Noise_Simplex3D_AVX2(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) {
+	const __m256i seedV = _mm256_set1_epi32((int)seed);
+	const __m256i oneInt = _mm256_set1_epi32(1);
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 allOnes = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+	const __m256 unskew1 = _mm256_set1_ps(eoeNoise::UNSKEW_3D);
+	const __m256 unskew2 = _mm256_set1_ps(eoeNoise::UNSKEW_3D_2);
+	const __m256 unskew3 = _mm256_set1_ps(eoeNoise::UNSKEW_3D_3);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m256 vx = _mm256_loadu_ps(x + i);
+		const __m256 vy = _mm256_loadu_ps(y + i);
+		const __m256 vz = _mm256_loadu_ps(z + i);
+		const __m256 skew = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(vx, vy), vz), _mm256_set1_ps(eoeNoise::SKEW_3D));
+		const __m256i ci = Noise_Floor_AVX2(_mm256_add_ps(vx, skew));
+		const __m256i cj = Noise_Floor_AVX2(_mm256_add_ps(vy, skew));
+		const __m256i ck = Noise_Floor_AVX2(_mm256_add_ps(vz, skew));
+		const __m256 unskew = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_add_epi32(ci, cj), ck)), unskew1);
+		const __m256 x0 = _mm256_sub_ps(vx, _mm256_sub_ps(_mm256_cvtepi32_ps(ci), unskew));
+		const __m256 y0 = _mm256_sub_ps(vy, _mm256_sub_ps(_mm256_cvtepi32_ps(cj), unskew));
+		const __m256 z0 = _mm256_sub_ps(vz, _mm256_sub_ps(_mm256_cvtepi32_ps(ck), unskew));
+
+		const __m256 xy = _mm256_cmp_ps(x0, y0, _CMP_GE_OQ);
+		const __m256 xz = _mm256_cmp_ps(x0, z0, _CMP_GE_OQ);
+		const __m256 yz = _mm256_cmp_ps(y0, z0, _CMP_GE_OQ);
+		const __m256 i1 = _mm256_and_ps(xy, xz);
+		const __m256 j1 = _mm256_andnot_ps(xy, yz);
+		const __m256 k1 = _mm256_andnot_ps(_mm256_or_ps(xz, yz), allOnes);
+		const __m256 i2 = _mm256_or_ps(xy, xz);
+		const __m256 j2 = _mm256_or_ps(_mm256_andnot_ps(xy, allOnes), yz);
+		const __m256 k2 = _mm256_andnot_ps(_mm256_and_ps(xz, yz), allOnes);
+
+		const __m256 x1 = _mm256_add_ps(_mm256_sub_ps(x0, _mm256_and_ps(i1, one)), unskew1);
+		const __m256 y1 = _mm256_add_ps(_mm256_sub_ps(y0, _mm256_and_ps(j1, one)), unskew1);
+		const __m256 z1 = _mm256_add_ps(_mm256_sub_ps(z0, _mm256_and_ps(k1, one)), unskew1);
+		const __m256 x2 = _mm256_add_ps(_mm256_sub_ps(x0, _mm256_and_ps(i2, one)), unskew2);
+		const __m256 y2 = _mm256_add_ps(_mm256_sub_ps(y0, _mm256_and_ps(j2, one)), unskew2);
+		const __m256 z2 = _mm256_add_ps(_mm256_sub_ps(z0, _mm256_and_ps(k2, one)), unskew2);
+		const __m256 x3 = _mm256_add_ps(_mm256_sub_ps(x0, one), unskew3);
+		const __m256 y3 = _mm256_add_ps(_mm256_sub_ps(y0, one), unskew3);
+		const __m256 z3 = _mm256_add_ps(_mm256_sub_ps(z0, one), unskew3);
+
+		const __m256i hash0 = Noise_Hash3_AVX2(ci, cj, ck, seedV);
+		const __m256i hash1 = Noise_Hash3_AVX2(_mm256_sub_epi32(ci, _mm256_castps_si256(i1)), _mm256_sub_epi32(cj, _mm256_castps_si256(j1)), _mm256_sub_epi32(ck, _mm256_castps_si256(k1)), seedV);
+		const __m256i hash2 = Noise_Hash3_AVX2(_mm256_sub_epi32(ci, _mm256_castps_si256(i2)), _mm256_sub_epi32(cj, _mm256_castps_si256(j2)), _mm256_sub_epi32(ck, _mm256_castps_si256(k2)), seedV);
+		const __m256i hash3 = Noise_Hash3_AVX2(_mm256_add_epi32(ci, oneInt), _mm256_add_epi32(cj, oneInt), _mm256_add_epi32(ck, oneInt), seedV);
+		const __m256 n0 = _mm256_mul_ps(Noise_Falloff3_AVX2(x0, y0, z0), Noise_Gradient3_AVX2(hash0, x0, y0, z0));
+		const __m256 n1 = _mm256_mul_ps(Noise_Falloff3_AVX2(x1, y1, z1), Noise_Gradient3_AVX2(hash1, x1, y1, z1));
+		const __m256 n2 = _mm256_mul_ps(Noise_Falloff3_AVX2(x2, y2, z2), Noise_Gradient3_AVX2(hash2, x2, y2, z2));
+		const __m256 n3 = _mm256_mul_ps(Noise_Falloff3_AVX2(x3, y3, z3), Noise_Gradient3_AVX2(hash3, x3, y3, z3));
+		_mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_add_ps(n0, n1), n2), n3), _mm256_set1_ps(eoeNoise::SCALE_3D)));
+	}
+	return i;
+}
+
+//--------------------------
+// SpreadFractions_AVX2
+// repeats each of the eight fractions in t numComponents times, in element order,
+// so spread[r] lines up with the r-th register of eight packed numComponents-vectors
+// lane k of spread[r] takes fraction (r * 8 + k) / numComponents
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline void SpreadFractions_AVX2(const __m256 t, const int numComponents, __m256 * spread) {
+	alignas(32) static const int permutes[4][4][8] = {
+		{ { 0, 1, 2, 3, 4, 5, 6, 7 } },
+		{ { 0, 0, 1, 1, 2, 2, 3, 3 }, { 4, 4, 5, 5, 6, 6, 7, 7 } },
+		{ { 0, 0, 0, 1, 1, 1, 2, 2 }, { 2, 3, 3, 3, 4, 4, 4, 5 }, { 5, 5, 6, 6, 6, 7, 7, 7 } },
+		{ { 0, 0, 0, 0, 1, 1, 1, 1 }, { 2, 2, 2, 2, 3, 3, 3, 3 }, { 4, 4, 4, 4, 5, 5, 5, 5 }, { 6, 6, 6, 6, 7, 7, 7, 7 } }
+	};
+	for (int r = 0; r < numComponents; ++r)
+		spread[r] = _mm256_permutevar8x32_ps(t, _mm256_load_si256(reinterpret_cast<const __m256i *>(permutes[numComponents - 1][r])));
+}
+
+//--------------------------
+// Float_Lerp_AVX2
+// same operation order as eoeMath::Lerp
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_Lerp_AVX2(float * dst, const float * from, const float * to, const float * fractions, const int numComponents, const int count) {
+	__m256 spread[4];
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		SpreadFractions_AVX2(_mm256_loadu_ps(fractions + i), numComponents, spread);
+		const int offset = i * numComponents;
+		for (int r = 0; r < numComponents; ++r) {
+			const __m256 a = _mm256_loadu_ps(from + offset + r * 8);
+			const __m256 b = _mm256_loadu_ps(to + offset + r * 8);
+			_mm256_storeu_ps(dst + offset + r * 8, _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), spread[r])));
+		}
+	}
+	return i;
+}
+
+//--------------------------
+// Ease_AVX2
+// same clamp, curves, and operation order as eoeMath::Ease,
+// the in-out curves evaluate both halves and select
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline __m256 Ease_AVX2(const __m256 fraction, const eoeEase_t type) {
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 t = _mm256_min_ps(_mm256_max_ps(fraction, _mm256_setzero_ps()), one);
+	const __m256 u = _mm256_sub_ps(one, t);
+	const __m256 t2 = _mm256_mul_ps(t, t);
+	const __m256 u2 = _mm256_mul_ps(u, u);
+
+	switch (type) {
+		case EASE_SMOOTHSTEP:
+			return _mm256_mul_ps(t2, _mm256_sub_ps(_mm256_set1_ps(3.0f), _mm256_mul_ps(_mm256_set1_ps(2.0f), t)));
+		case EASE_SMOOTHERSTEP: {
+			const __m256 inner = _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f));
+			return _mm256_mul_ps(_mm256_mul_ps(t2, t), _mm256_add_ps(_mm256_mul_ps(t, inner), _mm256_set1_ps(10.0f)));
+		}
+		case EASE_IN_QUAD:
+			return t2;
+		case EASE_OUT_QUAD:
+			return _mm256_sub_ps(one, u2);
+		case EASE_IN_OUT_QUAD: {
+			const __m256 in = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), t), t);
+			const __m256 out = _mm256_sub_ps(one, _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), u), u));
+			return Select_AVX2(_mm256_cmp_ps(t, _mm256_set1_ps(0.5f), _CMP_LT_OQ), in, out);
+		}
+		case EASE_IN_CUBIC:
+			return _mm256_mul_ps(t2, t);
+		case EASE_OUT_CUBIC:
+			return _mm256_sub_ps(one, _mm256_mul_ps(u2, u));
+		case EASE_IN_OUT_CUBIC: {
+			const __m256 in = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.0f), t), t), t);
+			const __m256 out = _mm256_sub_ps(one, _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(4.0f), u), u), u));
+			return Select_AVX2(_mm256_cmp_ps(t, _mm256_set1_ps(0.5f), _CMP_LT_OQ), in, out);
+		}
+		case EASE_IN_BACK:
+			return _mm256_mul_ps(t2, _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(eoeMath::BACK_C3), t), _mm256_set1_ps(eoeMath::BACK_C1)));
+		case EASE_OUT_BACK:
+			return _mm256_sub_ps(one, _mm256_mul_ps(u2, _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(eoeMath::BACK_C3), u), _mm256_set1_ps(eoeMath::BACK_C1))));
+		default:
+			return t;
+	}
+}
+
+//--------------------------
+// Float_Ease_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Float_Ease_AVX2(float * dst, const float * fractions, const int count, const eoeEase_t type) {
+	int i = 0;
+	for (; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(dst + i, Ease_AVX2(_mm256_loadu_ps(fractions + i), type));
+	return i;
+}
+
+//--------------------------
+// Transpose4x4Lanes_AVX2
+// _MM_TRANSPOSE4_PS within each 128-bit lane
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline void Transpose4x4Lanes_AVX2(__m256 & r0, __m256 & r1, __m256 & r2, __m256 & r3) {
+	const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+	const __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+	const __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+	const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+	r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+	r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+	r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+//--------------------------
+// LoadQuat8_AVX2
+// eight quaternions as x, y, z, w registers, the low lanes hold
+// quaternions 0, 2, 4, 6 and the high lanes 1, 3, 5, 7
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline void LoadQuat8_AVX2(const float * src, __m256 & x, __m256 & y, __m256 & z, __m256 & w) {
+	x = _mm256_loadu_ps(src);
+	y = _mm256_loadu_ps(src + 8);
+	z = _mm256_loadu_ps(src + 16);
+	w = _mm256_loadu_ps(src + 24);
+	Transpose4x4Lanes_AVX2(x, y, z, w);
+}
+
+//--------------------------
+// StoreQuat8_AVX2
+// inverse of LoadQuat8_AVX2
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline void StoreQuat8_AVX2(float * dst, __m256 x, __m256 y, __m256 z, __m256 w) {
+	Transpose4x4Lanes_AVX2(x, y, z, w);
+	_mm256_storeu_ps(dst, x);
+	_mm256_storeu_ps(dst + 8, y);
+	_mm256_storeu_ps(dst + 16, z);
+	_mm256_storeu_ps(dst + 24, w);
+}
+
+//--------------------------
+// QuatNormalize_AVX2
+// same as eoeQuat::Normalize on eight transposed quaternions
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static inline void QuatNormalize_AVX2(__m256 & x, __m256 & y, __m256 & z, __m256 & w) {
+	const __m256 sqrLength = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z)), _mm256_mul_ps(w, w));
+	const __m256 invLength = _mm256_and_ps(_mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(sqrLength)), _mm256_cmp_ps(sqrLength, _mm256_setzero_ps(), _CMP_NEQ_UQ));
+	x = _mm256_mul_ps(x, invLength);
+	y = _mm256_mul_ps(y, invLength);
+	z = _mm256_mul_ps(z, invLength);
+	w = _mm256_mul_ps(w, invLength);
+}
+
+//--------------------------
+// Quat_Nlerp_AVX2
+// same operation order as eoeQuat::Nlerp, eight quaternions transposed at a time
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Quat_Nlerp_AVX2(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) {
+	const __m256 signMask = _mm256_set1_ps(-0.0f);
+	const __m256i quatOrder = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256 ax;
+		__m256 ay;
+		__m256 az;
+		__m256 aw;
+		__m256 bx;
+		__m256 by;
+		__m256 bz;
+		__m256 bw;
+		LoadQuat8_AVX2(&from[i].x, ax, ay, az, aw);
+		LoadQuat8_AVX2(&to[i].x, bx, by, bz, bw);
+
+		const __m256 t = _mm256_permutevar8x32_ps(_mm256_loadu_ps(fractions + i), quatOrder);
+		const __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_mul_ps(az, bz)), _mm256_mul_ps(aw, bw));
+		const __m256 fromScale = _mm256_sub_ps(_mm256_set1_ps(1.0f), t);
+		const __m256 toScale = _mm256_xor_ps(t, _mm256_and_ps(_mm256_cmp_ps(dot, _mm256_setzero_ps(), _CMP_LT_OQ), signMask));
+
+		__m256 x = _mm256_add_ps(_mm256_mul_ps(ax, fromScale), _mm256_mul_ps(bx, toScale));
+		__m256 y = _mm256_add_ps(_mm256_mul_ps(ay, fromScale), _mm256_mul_ps(by, toScale));
+		__m256 z = _mm256_add_ps(_mm256_mul_ps(az, fromScale), _mm256_mul_ps(bz, toScale));
+		__m256 w = _mm256_add_ps(_mm256_mul_ps(aw, fromScale), _mm256_mul_ps(bw, toScale));
+		QuatNormalize_AVX2(x, y, z, w);
+		StoreQuat8_AVX2(&dst[i].x, x, y, z, w);
+	}
+	return i;
+}
+
+//--------------------------
+// Quat_SlerpFast_AVX2
+// same operation order as eoeQuat::SlerpFast, eight quaternions transposed at a time
+//--------------------------
+EOE_SIMD_TARGET("avx2")
+static int Quat_SlerpFast_AVX2(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) {
+	const __m256 signMask = _mm256_set1_ps(-0.0f);
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256i quatOrder = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256 ax;
+		__m256 ay;
+		__m256 az;
+		__m256 aw;
+		__m256 bx;
+		__m256 by;
+		__m256 bz;
+		__m256 bw;
+		LoadQuat8_AVX2(&from[i].x, ax, ay, az, aw);
+		LoadQuat8_AVX2(&to[i].x, bx, by, bz, bw);
+
+		const __m256 t = _mm256_permutevar8x32_ps(_mm256_loadu_ps(fractions + i), quatOrder);
+		const __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_mul_ps(az, bz)), _mm256_mul_ps(aw, bw));
+		const __m256 cosOmega = _mm256_andnot_ps(signMask, dot);
+		const __m256 sinSquared = _mm256_sub_ps(one, _mm256_mul_ps(cosOmega, cosOmega));
+		const __m256 sinOmega = _mm256_sqrt_ps(_mm256_max_ps(sinSquared, _mm256_setzero_ps()));
+		const __m256 omega = ATan2Fast_AVX2(sinOmega, cosOmega);
+		const __m256 invSinOmega = _mm256_div_ps(one, sinOmega);
+
+		__m256 sinFrom;
+		__m256 sinTo;
+		__m256 cos;
+		SinCosFast_AVX2(_mm256_mul_ps(_mm256_sub_ps(one, t), omega), sinFrom, cos);
+		SinCosFast_AVX2(_mm256_mul_ps(t, omega), sinTo, cos);
+
+		const __m256 nearlyEqual = _mm256_cmp_ps(cosOmega, _mm256_set1_ps(0.9995f), _CMP_GT_OQ);
+		const __m256 fromScale = Select_AVX2(nearlyEqual, _mm256_sub_ps(one, t), _mm256_mul_ps(sinFrom, invSinOmega));
+		__m256 toScale = Select_AVX2(nearlyEqual, t, _mm256_mul_ps(sinTo, invSinOmega));
+		toScale = _mm256_xor_ps(toScale, _mm256_and_ps(_mm256_cmp_ps(dot, _mm256_setzero_ps(), _CMP_LT_OQ), signMask));
+
+		__m256 x = _mm256_add_ps(_mm256_mul_ps(ax, fromScale), _mm256_mul_ps(bx, toScale));
+		__m256 y = _mm256_add_ps(_mm256_mul_ps(ay, fromScale), _mm256_mul_ps(by, toScale));
+		__m256 z = _mm256_add_ps(_mm256_mul_ps(az, fromScale), _mm256_mul_ps(bz, toScale));
+		__m256 w = _mm256_add_ps(_mm256_mul_ps(aw, fromScale), _mm256_mul_ps(bw, toScale));
+		QuatNormalize_AVX2(x, y, z, w);
+		StoreQuat8_AVX2(&dst[i].x, x, y, z, w);
+	}
+	return i;
+}
+
+//--------------------------
+// eoeSIMD_AVX2::GetName
+//--------------------------
+const char * eoeSIMD_AVX2::GetName() const {
+	return "AVX2";
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Mat4_MultiplyMat4
+// dst = a * b
+// dst may alias a or b
+//--------------------------
+void eoeSIMD_AVX2::Mat4_MultiplyMat4(eoeMat4 & dst, const eoeMat4 & a, const eoeMat4 & b) const {
+	Mat4_MultiplyMat4_AVX2(reinterpret_cast<float *>(&dst), reinterpret_cast<const float *>(&a), reinterpret_cast<const float *>(&b));
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Mat4_MultiplyMat4sColumnMajor
+//--------------------------
+void eoeSIMD_AVX2::Mat4_MultiplyMat4sColumnMajor(float * dst, const eoeMat4 & a, const eoeMat4 * b, const int count) const {
+	Mat4_MultiplyMat4sColumnMajor_AVX2(dst, reinterpret_cast<const float *>(&a), reinterpret_cast<const float *>(b), count);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Mat4_TransformVec4
+// dst[i] = m * src[i]
+// dst may alias src
+//--------------------------
+void eoeSIMD_AVX2::Mat4_TransformVec4(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const {
+	const int done = Mat4_TransformVec4_AVX2<TRANSFORM_FULL>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_SSE41::Mat4_TransformVec4(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Mat4_TransformVec4Directions
+// dst[i] = m * (src[i].xyz, 0)
+// dst may alias src
+//--------------------------
+void eoeSIMD_AVX2::Mat4_TransformVec4Directions(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const {
+	const int done = Mat4_TransformVec4_AVX2<TRANSFORM_DIRECTION>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_SSE41::Mat4_TransformVec4Directions(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Mat4_TransformVec4Projective
+// dst[i] = m * src[i], then divided through by its w (which becomes 1)
+// dst may alias src
+// DEBUG: allows divide by zero errors to occur
+//--------------------------
+void eoeSIMD_AVX2::Mat4_TransformVec4Projective(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const {
+	const int done = Mat4_TransformVec4_AVX2<TRANSFORM_PROJECTIVE>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_SSE41::Mat4_TransformVec4Projective(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Mat4_TransformVec3Points
+// dst[i] = (m * (src[i], 1)).xyz
+// dst may alias src
+//--------------------------
+void eoeSIMD_AVX2::Mat4_TransformVec3Points(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const {
+	const int done = Mat4_TransformVec3_AVX2<TRANSFORM_FULL>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_SSE41::Mat4_TransformVec3Points(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Mat4_TransformVec3Directions
+// dst[i] = (m * (src[i], 0)).xyz
+// dst may alias src
+//--------------------------
+void eoeSIMD_AVX2::Mat4_TransformVec3Directions(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const {
+	const int done = Mat4_TransformVec3_AVX2<TRANSFORM_DIRECTION>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_SSE41::Mat4_TransformVec3Directions(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Mat4_TransformVec3Projective
+// dst[i] = (m * (src[i], 1)).xyz divided through by the resulting w
+// dst may alias src
+// DEBUG: allows divide by zero errors to occur
+//--------------------------
+void eoeSIMD_AVX2::Mat4_TransformVec3Projective(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const {
+	const int done = Mat4_TransformVec3_AVX2<TRANSFORM_PROJECTIVE>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_SSE41::Mat4_TransformVec3Projective(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Mat3x2_TransformVec2
+// dst[i] = m * src[i]
+// dst may alias src
+//--------------------------
+void eoeSIMD_AVX2::Mat3x2_TransformVec2(eoeVec2 * dst, const eoeMat3x2 & m, const eoeVec2 * src, const int count) const {
+	const int done = Mat3x2_TransformVec2_AVX2(reinterpret_cast<float *>(dst), m.ToFloatPtr(), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_SSE41::Mat3x2_TransformVec2(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_Add
+// dst[i] = a[i] + b[i]
+//--------------------------
+void eoeSIMD_AVX2::Float_Add(float * dst, const float * a, const float * b, const int count) const {
+	const int done = Float_Add_AVX2(dst, a, b, count);
+	eoeSIMD_SSE41::Float_Add(dst + done, a + done, b + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_Scale
+// dst[i] = a[i] * scale
+//--------------------------
+void eoeSIMD_AVX2::Float_Scale(float * dst, const float * a, const float scale, const int count) const {
+	const int done = Float_Scale_AVX2(dst, a, scale, count);
+	eoeSIMD_SSE41::Float_Scale(dst + done, a + done, scale, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_MultiplyAdd
+// dst[i] = a[i] + b[i] * scale
+//--------------------------
+void eoeSIMD_AVX2::Float_MultiplyAdd(float * dst, const float * a, const float * b, const float scale, const int count) const {
+	const int done = Float_MultiplyAdd_AVX2(dst, a, b, scale, count);
+	eoeSIMD_SSE41::Float_MultiplyAdd(dst + done, a + done, b + done, scale, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_SnapInt
+// moves each value to the nearest integer value, same as eoeVec3::SnapInt
+//--------------------------
+void eoeSIMD_AVX2::Float_SnapInt(float * dst, const float * src, const int count) const {
+	const int done = Float_SnapInt_AVX2(dst, src, count);
+	eoeSIMD_SSE41::Float_SnapInt(dst + done, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_SinCosFast
+// sin[i], cos[i] = eoeMath::SinCosFast(radians[i])
+//--------------------------
+void eoeSIMD_AVX2::Float_SinCosFast(float * sin, float * cos, const float * radians, const int count) const {
+	const int done = Float_SinCosFast_AVX2(sin, cos, radians, count);
+	eoeSIMD_SSE41::Float_SinCosFast(sin + done, cos + done, radians + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_RSqrtFast
+// dst[i] = eoeMath::RSqrtFast(src[i])
+//--------------------------
+void eoeSIMD_AVX2::Float_RSqrtFast(float * dst, const float * src, const int count) const {
+	const int done = Float_RSqrtFast_AVX2(dst, src, count);
+	eoeSIMD_SSE41::Float_RSqrtFast(dst + done, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_ATan2Fast
+// dst[i] = eoeMath::ATan2Fast(y[i], x[i])
+//--------------------------
+void eoeSIMD_AVX2::Float_ATan2Fast(float * dst, const float * y, const float * x, const int count) const {
+	const int done = Float_ATan2Fast_AVX2(dst, y, x, count);
+	eoeSIMD_SSE41::Float_ATan2Fast(dst + done, y + done, x + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_IsometricToOrthographic
+// x[i], y[i] = eoeMath::IsometricToOrthographic(x[i], y[i])
+//--------------------------
+void eoeSIMD_AVX2::Float_IsometricToOrthographic(float * x, float * y, const int count) const {
+	const int done = Float_IsometricToOrthographic_AVX2(x, y, count);
+	eoeSIMD_SSE41::Float_IsometricToOrthographic(x + done, y + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_OrthographicToIsometric
+// x[i], y[i] = eoeMath::OrthographicToIsometric(x[i], y[i])
+//--------------------------
+void eoeSIMD_AVX2::Float_OrthographicToIsometric(float * x, float * y, const int count) const {
+	const int done = Float_OrthographicToIsometric_AVX2(x, y, count);
+	eoeSIMD_SSE41::Float_OrthographicToIsometric(x + done, y + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Int_IsometricToOrthographic
+// x[i], y[i] = eoeMath::IsometricToOrthographic(x[i], y[i])
+//--------------------------
+void eoeSIMD_AVX2::Int_IsometricToOrthographic(int * x, int * y, const int count) const {
+	const int done = Int_IsometricToOrthographic_AVX2(x, y, count);
+	eoeSIMD_SSE41::Int_IsometricToOrthographic(x + done, y + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Int_OrthographicToIsometric
+// x[i], y[i] = eoeMath::OrthographicToIsometric(x[i], y[i])
+//--------------------------
+void eoeSIMD_AVX2::Int_OrthographicToIsometric(int * x, int * y, const int count) const {
+	const int done = Int_OrthographicToIsometric_AVX2(x, y, count);
+	eoeSIMD_SSE41::Int_OrthographicToIsometric(x + done, y + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::SoA_Dot
+// dst[i] = dot product of the i-th vectors of a and b
+//--------------------------
+void eoeSIMD_AVX2::SoA_Dot(float * dst, const float * const * a, const float * const * b, const int numComponents, const int count) const {
+	const float * aRest[EOE_SOA_MAX_COMPONENTS];
+	const float * bRest[EOE_SOA_MAX_COMPONENTS];
+	const int done = SoA_Dot_AVX2(dst, a, b, numComponents, count);
+	SoA_Offset(aRest, a, numComponents, done);
+	SoA_Offset(bRest, b, numComponents, done);
+	eoeSIMD_SSE41::SoA_Dot(dst + done, aRest, bRest, numComponents, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::SoA_Length
+// dst[i] = length of the i-th vector of a
+//--------------------------
+void eoeSIMD_AVX2::SoA_Length(float * dst, const float * const * a, const int numComponents, const int count) const {
+	const float * aRest[EOE_SOA_MAX_COMPONENTS];
+	const int done = SoA_Length_AVX2(dst, a, numComponents, count);
+	SoA_Offset(aRest, a, numComponents, done);
+	eoeSIMD_SSE41::SoA_Length(dst + done, aRest, numComponents, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::SoA_Normalize
+// scales each vector of a to unit length, same as eoeVec3::Normalize
+//--------------------------
+void eoeSIMD_AVX2::SoA_Normalize(float * const * a, const int numComponents, const int count) const {
+	float * aRest[EOE_SOA_MAX_COMPONENTS];
+	const int done = SoA_Normalize_AVX2(a, numComponents, count);
+	SoA_Offset(aRest, a, numComponents, done);
+	eoeSIMD_SSE41::SoA_Normalize(aRest, numComponents, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::SoA_Cross
+// dst[i] = a[i] X b[i] for three component arrays
+// dst may alias a or b
+//--------------------------
+void eoeSIMD_AVX2::SoA_Cross(float * const * dst, const float * const * a, const float * const * b, const int count) const {
+	float * dstRest[3];
+	const float * aRest[3];
+	const float * bRest[3];
+	const int done = SoA_Cross_AVX2(dst, a, b, count);
+	SoA_Offset(dstRest, dst, 3, done);
+	SoA_Offset(aRest, a, 3, done);
+	SoA_Offset(bRest, b, 3, done);
+	eoeSIMD_SSE41::SoA_Cross(dstRest, aRest, bRest, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::SoA_FromVec3
+// splits packed eoeVec3s into dst[0] (x), dst[1] (y), and dst[2] (z)
+//--------------------------
+void eoeSIMD_AVX2::SoA_FromVec3(float * const * dst, const eoeVec3 * src, const int count) const {
+	float * dstRest[3];
+	const int done = SoA_FromVec3_AVX2(dst, reinterpret_cast<const float *>(src), count);
+	SoA_Offset(dstRest, dst, 3, done);
+	eoeSIMD_SSE41::SoA_FromVec3(dstRest, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::SoA_FromVec4
+// splits packed eoeVec4s into dst[0] (x), dst[1] (y), dst[2] (z), and dst[3] (w)
+//--------------------------
+void eoeSIMD_AVX2::SoA_FromVec4(float * const * dst, const eoeVec4 * src, const int count) const {
+	float * dstRest[4];
+	const int done = SoA_FromVec4_AVX2(dst, reinterpret_cast<const float *>(src), count);
+	SoA_Offset(dstRest, dst, 4, done);
+	eoeSIMD_SSE41::SoA_FromVec4(dstRest, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::SoA_ToVec3
+// packs src[0] (x), src[1] (y), and src[2] (z) into eoeVec3s
+//--------------------------
+void eoeSIMD_AVX2::SoA_ToVec3(eoeVec3 * dst, const float * const * src, const int count) const {
+	const float * srcRest[3];
+	const int done = SoA_ToVec3_AVX2(reinterpret_cast<float *>(dst), src, count);
+	SoA_Offset(srcRest, src, 3, done);
+	eoeSIMD_SSE41::SoA_ToVec3(dst + done, srcRest, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::SoA_ToVec4
+// packs src[0] (x), src[1] (y), src[2] (z), and src[3] (w) into eoeVec4s
+//--------------------------
+void eoeSIMD_AVX2::SoA_ToVec4(eoeVec4 * dst, const float * const * src, const int count) const {
+	const float * srcRest[4];
+	const int done = SoA_ToVec4_AVX2(reinterpret_cast<float *>(dst), src, count);
+	SoA_Offset(srcRest, src, 4, done);
+	eoeSIMD_SSE41::SoA_ToVec4(dst + done, srcRest, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Cull_AABBs
+// writes i for every bounds[i] that no plane has entirely on its
+// negative side, see eoeAABB::IsOutside, returns the number written
+//--------------------------
+int eoeSIMD_AVX2::Cull_AABBs(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeAABB * bounds, const int count) const {
+	int numVisible;
+	const int done = Cull_AABBs_AVX2(visibleIndexes, numVisible, planes, numPlanes, bounds, count);
+	const int numRest = eoeSIMD_SSE41::Cull_AABBs(visibleIndexes + numVisible, planes, numPlanes, bounds + done, count - done);
+	for (int i = numVisible; i < numVisible + numRest; ++i)
+		visibleIndexes[i] += done;
+	return numVisible + numRest;
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Cull_Spheres
+// writes i for every spheres[i] that no plane has entirely on its
+// negative side, see eoeSphere::IsOutside, returns the number written
+//--------------------------
+int eoeSIMD_AVX2::Cull_Spheres(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeSphere * spheres, const int count) const {
+	int numVisible;
+	const int done = Cull_Spheres_AVX2(visibleIndexes, numVisible, planes, numPlanes, spheres, count);
+	const int numRest = eoeSIMD_SSE41::Cull_Spheres(visibleIndexes + numVisible, planes, numPlanes, spheres + done, count - done);
+	for (int i = numVisible; i < numVisible + numRest; ++i)
+		visibleIndexes[i] += done;
+	return numVisible + numRest;
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Random_FillUInts
+// dst[i] = raw output of lane i % EOE_RANDOM_LANES
+//--------------------------
+void eoeSIMD_AVX2::Random_FillUInts(uint32_t * state, uint32_t * dst, const int count) const {
+	const int done = Random_FillUInts_AVX2(state, dst, count);
+	eoeSIMD_SSE41::Random_FillUInts(state, dst + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Random_FillFloats
+// dst[i] = eoeRandom::ToFloat(output, min, range)
+//--------------------------
+void eoeSIMD_AVX2::Random_FillFloats(uint32_t * state, float * dst, const int count, const float min, const float range) const {
+	const int done = Random_FillFloats_AVX2(state, dst, count, min, range);
+	eoeSIMD_SSE41::Random_FillFloats(state, dst + done, count - done, min, range);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Random_FillInts
+// dst[i] = eoeRandom::ToInt(output, min, span)
+//--------------------------
+void eoeSIMD_AVX2::Random_FillInts(uint32_t * state, int * dst, const int count, const int min, const uint64_t span) const {
+	const int done = Random_FillInts_AVX2(state, dst, count, min, span);
+	eoeSIMD_SSE41::Random_FillInts(state, dst + done, count - done, min, span);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Noise_Value2D
+// dst[i] = eoeNoise::Value2D(x[i], y[i], seed)
+//--------------------------
+void eoeSIMD_AVX2::Noise_Value2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const {
+	const int done = Noise_Value2D_AVX2(dst, x, y, count, seed);
+	eoeSIMD_SSE41::Noise_Value2D(dst + done, x + done, y + done, count - done, seed);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Noise_Value3D
+// dst[i] = eoeNoise::Value3D(x[i], y[i], z[i], seed)
+//--------------------------
+void eoeSIMD_AVX2::Noise_Value3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const {
+	const int done = Noise_Value3D_AVX2(dst, x, y, z, count, seed);
+	eoeSIMD_SSE41::Noise_Value3D(dst + done, x + done, y + done, z + done, count - done, seed);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Noise_Simplex2D
+// dst[i] = eoeNoise::Simplex2D(x[i], y[i], seed)
+//--------------------------
+void eoeSIMD_AVX2::Noise_Simplex2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const {
+	const int done = Noise_Simplex2D_AVX2(dst, x, y, count, seed);
+	eoeSIMD_SSE41::Noise_Simplex2D(dst + done, x + done, y + done, count - done, seed);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Noise_Simplex3D
+// dst[i] = eoeNoise::Simplex3D(x[i], y[i], z[i], seed)
+//--------------------------
+void eoeSIMD_AVX2::Noise_Simplex3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const {
+	const int done = Noise_Simplex3D_AVX2(dst, x, y, z, count, seed);
+	eoeSIMD_SSE41::Noise_Simplex3D(dst + done, x + done, y + done, z + done, count - done, seed);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_Lerp
+// dst[i * numComponents + c] = eoeMath::Lerp(from[...], to[...], fractions[i])
+//--------------------------
+void eoeSIMD_AVX2::Float_Lerp(float * dst, const float * from, const float * to, const float * fractions, const int numComponents, const int count) const {
+	const int done = Float_Lerp_AVX2(dst, from, to, fractions, numComponents, count);
+	eoeSIMD_SSE41::Float_Lerp(dst + done * numComponents, from + done * numComponents, to + done * numComponents, fractions + done, numComponents, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Float_Ease
+// dst[i] = eoeMath::Ease(type, fractions[i])
+//--------------------------
+void eoeSIMD_AVX2::Float_Ease(float * dst, const float * fractions, const int count, const eoeEase_t type) const {
+	const int done = Float_Ease_AVX2(dst, fractions, count, type);
+	eoeSIMD_SSE41::Float_Ease(dst + done, fractions + done, count - done, type);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Quat_Nlerp
+// dst[i] = eoeQuat::Nlerp(from[i], to[i], fractions[i])
+//--------------------------
+void eoeSIMD_AVX2::Quat_Nlerp(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const {
+	const int done = Quat_Nlerp_AVX2(dst, from, to, fractions, count);
+	eoeSIMD_SSE41::Quat_Nlerp(dst + done, from + done, to + done, fractions + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_AVX2::Quat_SlerpFast
+// dst[i] = eoeQuat::SlerpFast(from[i], to[i], fractions[i])
+//--------------------------
+void eoeSIMD_AVX2::Quat_SlerpFast(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const {
+	const int done = Quat_SlerpFast_AVX2(dst, from, to, fractions, count);
+	eoeSIMD_SSE41::Quat_SlerpFast(dst + done, from + done, to + done, fractions + done, count - done);
+}
+
+#endif /* EOE_SIMD_X86 */
@@ -0,0 +1,699 @@
+#include <string.h>
+#include "SIMD_Generic.h"
+
+//--------------------------
+// eoeSIMD_Generic::GetName
+//--------------------------
+const char * eoeSIMD_Generic::GetName() const {
+	return "generic code";
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_MultiplyMat4
+// dst = a * b
+// dst may alias a or b
+//--------------------------
+void eoeSIMD_Generic::Mat4_MultiplyMat4(eoeMat4 & dst, const eoeMat4 & a, const eoeMat4 & b) const {
+	eoeMat4 result;
+	const float * m1Ptr = reinterpret_cast<const float *>(&a);		// faster than a function call to ToFloatPtr
+	const float * m2Ptr = reinterpret_cast<const float *>(&b);
+	float * resultPtr = reinterpret_cast<float *>(&result);
+
+	for (int r = 0; r < 4; ++r) {
+		for (int c = 0; c < 4; ++c) {
+			*resultPtr = m1Ptr[0] * m2Ptr[ 0 * 4 + c ]
+					   + m1Ptr[1] * m2Ptr[ 1 * 4 + c ]
+					   + m1Ptr[2] * m2Ptr[ 2 * 4 + c ]
+					   + m1Ptr[3] * m2Ptr[ 3 * 4 + c ];
+			++resultPtr;
+		}
+		m1Ptr += 4;
+	}
+	dst = result;
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_MultiplyVec4
+// dst = m * v, column-vector matrix multiplication
+// dst may alias v
+//--------------------------
+void eoeSIMD_Generic::Mat4_MultiplyVec4(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const {
+	const float * mPtr = reinterpret_cast<const float *>(&m);
+	const float x = v.x;
+	const float y = v.y;
+	const float z = v.z;
+	const float w = v.w;
+
+	dst.x = mPtr[ 0] * x + mPtr[ 1] * y + mPtr[ 2] * z + mPtr[ 3] * w;
+	dst.y = mPtr[ 4] * x + mPtr[ 5] * y + mPtr[ 6] * z + mPtr[ 7] * w;
+	dst.z = mPtr[ 8] * x + mPtr[ 9] * y + mPtr[10] * z + mPtr[11] * w;
+	dst.w = mPtr[12] * x + mPtr[13] * y + mPtr[14] * z + mPtr[15] * w;
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_MultiplyVec4Transposed
+// dst = transpose(m) * v, which is eoeMat4CM * v on the column-major storage
+// summed in the same order as Mat4_MultiplyVec4 of the transposed matrix
+// dst may alias v
+//--------------------------
+void eoeSIMD_Generic::Mat4_MultiplyVec4Transposed(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const {
+	const float * mPtr = reinterpret_cast<const float *>(&m);
+	const float x = v.x;
+	const float y = v.y;
+	const float z = v.z;
+	const float w = v.w;
+
+	dst.x = mPtr[ 0] * x + mPtr[ 4] * y + mPtr[ 8] * z + mPtr[12] * w;
+	dst.y = mPtr[ 1] * x + mPtr[ 5] * y + mPtr[ 9] * z + mPtr[13] * w;
+	dst.z = mPtr[ 2] * x + mPtr[ 6] * y + mPtr[10] * z + mPtr[14] * w;
+	dst.w = mPtr[ 3] * x + mPtr[ 7] * y + mPtr[11] * z + mPtr[15] * w;
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_MultiplyMat4sColumnMajor
+// dst receives a * b[i] for each of the count matrices, 16 floats apiece,
+// written column-major so it can be uploaded to GL without a transpose
+// dst may be unaligned (eg: a mapped buffer) but must not overlap a or b
+//--------------------------
+void eoeSIMD_Generic::Mat4_MultiplyMat4sColumnMajor(float * dst, const eoeMat4 & a, const eoeMat4 * b, const int count) const {
+	const float * m1Ptr = reinterpret_cast<const float *>(&a);
+
+	for (int i = 0; i < count; ++i) {
+		const float * m2Ptr = reinterpret_cast<const float *>(&b[i]);
+		for (int c = 0; c < 4; ++c) {
+			for (int r = 0; r < 4; ++r) {
+				*dst = m1Ptr[r * 4 + 0] * m2Ptr[ 0 * 4 + c ]
+					 + m1Ptr[r * 4 + 1] * m2Ptr[ 1 * 4 + c ]
+					 + m1Ptr[r * 4 + 2] * m2Ptr[ 2 * 4 + c ]
+					 + m1Ptr[r * 4 + 3] * m2Ptr[ 3 * 4 + c ];
+				++dst;
+			}
+		}
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_Transpose
+// dst = transpose of src
+// dst may alias src
+//--------------------------
+void eoeSIMD_Generic::Mat4_Transpose(eoeMat4 & dst, const eoeMat4 & src) const {
+	const float * s = reinterpret_cast<const float *>(&src);
+	float * d = reinterpret_cast<float *>(&dst);
+
+	for (int row = 0; row < 4; ++row) {
+		d[row * 4 + row] = s[row * 4 + row];
+		for (int column = row + 1; column < 4; ++column) {
+			const float upper = s[row * 4 + column];
+			d[row * 4 + column] = s[column * 4 + row];
+			d[column * 4 + row] = upper;
+		}
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_Inverse
+// dst = inverse of src via the 2x2 sub-determinants of its top and bottom row pairs
+// returns false and leaves dst untouched if src is singular
+// dst may alias src
+//--------------------------
+bool eoeSIMD_Generic::Mat4_Inverse(eoeMat4 & dst, const eoeMat4 & src) const {
+	const float * m = reinterpret_cast<const float *>(&src);
+
+	const float s0 = m[ 0] * m[ 5] - m[ 1] * m[ 4];
+	const float s1 = m[ 0] * m[ 6] - m[ 2] * m[ 4];
+	const float s2 = m[ 0] * m[ 7] - m[ 3] * m[ 4];
+	const float s3 = m[ 1] * m[ 6] - m[ 2] * m[ 5];
+	const float s4 = m[ 1] * m[ 7] - m[ 3] * m[ 5];
+	const float s5 = m[ 2] * m[ 7] - m[ 3] * m[ 6];
+
+	const float c0 = m[ 8] * m[13] - m[ 9] * m[12];
+	const float c1 = m[ 8] * m[14] - m[10] * m[12];
+	const float c2 = m[ 8] * m[15] - m[11] * m[12];
+	const float c3 = m[ 9] * m[14] - m[10] * m[13];
+	const float c4 = m[ 9] * m[15] - m[11] * m[13];
+	const float c5 = m[10] * m[15] - m[11] * m[14];
+
+	const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	if (SDL_fabs(det) < eoeMat4::INVERSE_EPSILON)
+		return false;
+
+	const float invDet = 1.0f / det;
+	float r[16];
+	r[ 0] = ( m[ 5] * c5 - m[ 6] * c4 + m[ 7] * c3) * invDet;
+	r[ 1] = (-m[ 1] * c5 + m[ 2] * c4 - m[ 3] * c3) * invDet;
+	r[ 2] = ( m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+	r[ 3] = (-m[ 9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+	r[ 4] = (-m[ 4] * c5 + m[ 6] * c2 - m[ 7] * c1) * invDet;
+	r[ 5] = ( m[ 0] * c5 - m[ 2] * c2 + m[ 3] * c1) * invDet;
+	r[ 6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+	r[ 7] = ( m[ 8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+	r[ 8] = ( m[ 4] * c4 - m[ 5] * c2 + m[ 7] * c0) * invDet;
+	r[ 9] = (-m[ 0] * c4 + m[ 1] * c2 - m[ 3] * c0) * invDet;
+	r[10] = ( m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+	r[11] = (-m[ 8] * s4 + m[ 9] * s2 - m[11] * s0) * invDet;
+	r[12] = (-m[ 4] * c3 + m[ 5] * c1 - m[ 6] * c0) * invDet;
+	r[13] = ( m[ 0] * c3 - m[ 1] * c1 + m[ 2] * c0) * invDet;
+	r[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+	r[15] = ( m[ 8] * s3 - m[ 9] * s1 + m[10] * s0) * invDet;
+	memcpy(&dst, r, sizeof(r));
+	return true;
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_AffineInverse
+// dst = inverse of a translation * rotation * scale matrix
+// the upper 3x3 has orthogonal columns, so its inverse is its transpose
+// with each row divided by that column's squared length
+// returns false and leaves dst untouched if any scale is zero
+// dst may alias src
+//--------------------------
+bool eoeSIMD_Generic::Mat4_AffineInverse(eoeMat4 & dst, const eoeMat4 & src) const {
+	const float * m = reinterpret_cast<const float *>(&src);
+
+	float invLengthSquared[3];
+	for (int column = 0; column < 3; ++column) {
+		const float lengthSquared = m[column] * m[column] + m[4 + column] * m[4 + column] + m[8 + column] * m[8 + column];
+		if (lengthSquared == 0.0f)
+			return false;
+		invLengthSquared[column] = 1.0f / lengthSquared;
+	}
+
+	float r[16];
+	for (int row = 0; row < 3; ++row) {
+		const float x = m[row] * invLengthSquared[row];
+		const float y = m[4 + row] * invLengthSquared[row];
+		const float z = m[8 + row] * invLengthSquared[row];
+		r[row * 4 + 0] = x;
+		r[row * 4 + 1] = y;
+		r[row * 4 + 2] = z;
+		r[row * 4 + 3] = -(x * m[3] + y * m[7] + z * m[11]);
+	}
+	r[12] = 0.0f;
+	r[13] = 0.0f;
+	r[14] = 0.0f;
+	r[15] = 1.0f;
+	memcpy(&dst, r, sizeof(r));
+	return true;
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_TransformVec4
+// dst[i] = m * src[i]
+// dst may alias src
+//--------------------------
+void eoeSIMD_Generic::Mat4_TransformVec4(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const {
+	const float * mPtr = reinterpret_cast<const float *>(&m);
+
+	for (int i = 0; i < count; ++i) {
+		const float x = src[i].x;
+		const float y = src[i].y;
+		const float z = src[i].z;
+		const float w = src[i].w;
+
+		dst[i].x = mPtr[ 0] * x + mPtr[ 1] * y + mPtr[ 2] * z + mPtr[ 3] * w;
+		dst[i].y = mPtr[ 4] * x + mPtr[ 5] * y + mPtr[ 6] * z + mPtr[ 7] * w;
+		dst[i].z = mPtr[ 8] * x + mPtr[ 9] * y + mPtr[10] * z + mPtr[11] * w;
+		dst[i].w = mPtr[12] * x + mPtr[13] * y + mPtr[14] * z + mPtr[15] * w;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_TransformVec4Directions
+// dst[i] = m * (src[i].xyz, 0)
+// dst may alias src
+//--------------------------
+void eoeSIMD_Generic::Mat4_TransformVec4Directions(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const {
+	const float * mPtr = reinterpret_cast<const float *>(&m);
+
+	for (int i = 0; i < count; ++i) {
+		const float x = src[i].x;
+		const float y = src[i].y;
+		const float z = src[i].z;
+
+		dst[i].x = mPtr[ 0] * x + mPtr[ 1] * y + mPtr[ 2] * z;
+		dst[i].y = mPtr[ 4] * x + mPtr[ 5] * y + mPtr[ 6] * z;
+		dst[i].z = mPtr[ 8] * x + mPtr[ 9] * y + mPtr[10] * z;
+		dst[i].w = mPtr[12] * x + mPtr[13] * y + mPtr[14] * z;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_TransformVec4Projective
+// dst[i] = m * src[i], then divided through by its w (which becomes 1)
+// dst may alias src
+// DEBUG: allows divide by zero errors to occur
+//--------------------------
+void eoeSIMD_Generic::Mat4_TransformVec4Projective(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const {
+	const float * mPtr = reinterpret_cast<const float *>(&m);
+
+	for (int i = 0; i < count; ++i) {
+		const float x = src[i].x;
+		const float y = src[i].y;
+		const float z = src[i].z;
+		const float w = src[i].w;
+		const float invW = 1.0f / (mPtr[12] * x + mPtr[13] * y + mPtr[14] * z + mPtr[15] * w);
+
+		dst[i].x = (mPtr[ 0] * x + mPtr[ 1] * y + mPtr[ 2] * z + mPtr[ 3] * w) * invW;
+		dst[i].y = (mPtr[ 4] * x + mPtr[ 5] * y + mPtr[ 6] * z + mPtr[ 7] * w) * invW;
+		dst[i].z = (mPtr[ 8] * x + mPtr[ 9] * y + mPtr[10] * z + mPtr[11] * w) * invW;
+		dst[i].w = 1.0f;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_TransformVec3Points
+// dst[i] = (m * (src[i], 1)).xyz
+// dst may alias src
+//--------------------------
+void eoeSIMD_Generic::Mat4_TransformVec3Points(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const {
+	const float * mPtr = reinterpret_cast<const float *>(&m);
+
+	for (int i = 0; i < count; ++i) {
+		const float x = src[i].x;
+		const float y = src[i].y;
+		const float z = src[i].z;
+
+		dst[i].x = mPtr[ 0] * x + mPtr[ 1] * y + mPtr[ 2] * z + mPtr[ 3];
+		dst[i].y = mPtr[ 4] * x + mPtr[ 5] * y + mPtr[ 6] * z + mPtr[ 7];
+		dst[i].z = mPtr[ 8] * x + mPtr[ 9] * y + mPtr[10] * z + mPtr[11];
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_TransformVec3Directions
+// dst[i] = (m * (src[i], 0)).xyz
+// dst may alias src
+//--------------------------
+void eoeSIMD_Generic::Mat4_TransformVec3Directions(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const {
+	const float * mPtr = reinterpret_cast<const float *>(&m);
+
+	for (int i = 0; i < count; ++i) {
+		const float x = src[i].x;
+		const float y = src[i].y;
+		const float z = src[i].z;
+
+		dst[i].x = mPtr[ 0] * x + mPtr[ 1] * y + mPtr[ 2] * z;
+		dst[i].y = mPtr[ 4] * x + mPtr[ 5] * y + mPtr[ 6] * z;
+		dst[i].z = mPtr[ 8] * x + mPtr[ 9] * y + mPtr[10] * z;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat4_TransformVec3Projective
+// dst[i] = (m * (src[i], 1)).xyz divided through by the resulting w
+// dst may alias src
+// DEBUG: allows divide by zero errors to occur
+//--------------------------
+void eoeSIMD_Generic::Mat4_TransformVec3Projective(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const {
+	const float * mPtr = reinterpret_cast<const float *>(&m);
+
+	for (int i = 0; i < count; ++i) {
+		const float x = src[i].x;
+		const float y = src[i].y;
+		const float z = src[i].z;
+		const float invW = 1.0f / (mPtr[12] * x + mPtr[13] * y + mPtr[14] * z + mPtr[15]);
+
+		dst[i].x = (mPtr[ 0] * x + mPtr[ 1] * y + mPtr[ 2] * z + mPtr[ 3]) * invW;
+		dst[i].y = (mPtr[ 4] * x + mPtr[ 5] * y + mPtr[ 6] * z + mPtr[ 7]) * invW;
+		dst[i].z = (mPtr[ 8] * x + mPtr[ 9] * y + mPtr[10] * z + mPtr[11]) * invW;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Mat3x2_TransformVec2
+// dst[i] = m * src[i]
+// dst may alias src
+//--------------------------
+void eoeSIMD_Generic::Mat3x2_TransformVec2(eoeVec2 * dst, const eoeMat3x2 & m, const eoeVec2 * src, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = m * src[i];
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_Add
+// dst[i] = a[i] + b[i]
+//--------------------------
+void eoeSIMD_Generic::Float_Add(float * dst, const float * a, const float * b, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = a[i] + b[i];
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_Scale
+// dst[i] = a[i] * scale
+//--------------------------
+void eoeSIMD_Generic::Float_Scale(float * dst, const float * a, const float scale, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = a[i] * scale;
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_MultiplyAdd
+// dst[i] = a[i] + b[i] * scale
+// eg: position += velocity * deltaTime
+//--------------------------
+void eoeSIMD_Generic::Float_MultiplyAdd(float * dst, const float * a, const float * b, const float scale, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = a[i] + b[i] * scale;
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_SnapInt
+// moves each value to the nearest integer value, same as eoeVec3::SnapInt
+//--------------------------
+void eoeSIMD_Generic::Float_SnapInt(float * dst, const float * src, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = floorf(src[i] + 0.5f);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_SinCosFast
+// sin[i], cos[i] = eoeMath::SinCosFast(radians[i])
+//--------------------------
+void eoeSIMD_Generic::Float_SinCosFast(float * sin, float * cos, const float * radians, const int count) const {
+	for (int i = 0; i < count; ++i)
+		eoeMath::SinCosFast(radians[i], sin[i], cos[i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_RSqrtFast
+// dst[i] = eoeMath::RSqrtFast(src[i])
+//--------------------------
+void eoeSIMD_Generic::Float_RSqrtFast(float * dst, const float * src, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeMath::RSqrtFast(src[i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_ATan2Fast
+// dst[i] = eoeMath::ATan2Fast(y[i], x[i])
+//--------------------------
+void eoeSIMD_Generic::Float_ATan2Fast(float * dst, const float * y, const float * x, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeMath::ATan2Fast(y[i], x[i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_IsometricToOrthographic
+// x[i], y[i] = eoeMath::IsometricToOrthographic(x[i], y[i])
+//--------------------------
+void eoeSIMD_Generic::Float_IsometricToOrthographic(float * x, float * y, const int count) const {
+	for (int i = 0; i < count; ++i)
+		eoeMath::IsometricToOrthographic(x[i], y[i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_OrthographicToIsometric
+// x[i], y[i] = eoeMath::OrthographicToIsometric(x[i], y[i])
+//--------------------------
+void eoeSIMD_Generic::Float_OrthographicToIsometric(float * x, float * y, const int count) const {
+	for (int i = 0; i < count; ++i)
+		eoeMath::OrthographicToIsometric(x[i], y[i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Int_IsometricToOrthographic
+// x[i], y[i] = eoeMath::IsometricToOrthographic(x[i], y[i])
+//--------------------------
+void eoeSIMD_Generic::Int_IsometricToOrthographic(int * x, int * y, const int count) const {
+	for (int i = 0; i < count; ++i)
+		eoeMath::IsometricToOrthographic(x[i], y[i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Int_OrthographicToIsometric
+// x[i], y[i] = eoeMath::OrthographicToIsometric(x[i], y[i])
+//--------------------------
+void eoeSIMD_Generic::Int_OrthographicToIsometric(int * x, int * y, const int count) const {
+	for (int i = 0; i < count; ++i)
+		eoeMath::OrthographicToIsometric(x[i], y[i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::SoA_Dot
+// dst[i] = dot product of the i-th vectors of a and b
+// a and b hold numComponents arrays each
+//--------------------------
+void eoeSIMD_Generic::SoA_Dot(float * dst, const float * const * a, const float * const * b, const int numComponents, const int count) const {
+	for (int i = 0; i < count; ++i) {
+		float dot = a[0][i] * b[0][i];
+		for (int c = 1; c < numComponents; ++c)
+			dot += a[c][i] * b[c][i];
+		dst[i] = dot;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::SoA_Length
+// dst[i] = length of the i-th vector of a
+//--------------------------
+void eoeSIMD_Generic::SoA_Length(float * dst, const float * const * a, const int numComponents, const int count) const {
+	for (int i = 0; i < count; ++i) {
+		float lengthSquared = a[0][i] * a[0][i];
+		for (int c = 1; c < numComponents; ++c)
+			lengthSquared += a[c][i] * a[c][i];
+		dst[i] = SDL_sqrtf(lengthSquared);
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::SoA_Normalize
+// scales each vector of a to unit length, same as eoeVec3::Normalize
+// zero length vectors stay zero
+//--------------------------
+void eoeSIMD_Generic::SoA_Normalize(float * const * a, const int numComponents, const int count) const {
+	for (int i = 0; i < count; ++i) {
+		float length = a[0][i] * a[0][i];
+		for (int c = 1; c < numComponents; ++c)
+			length += a[c][i] * a[c][i];
+		length = SDL_sqrtf(length);
+
+		const float invLength = (length == 0.0f) ? 0.0f : 1.0f / length;
+		for (int c = 0; c < numComponents; ++c)
+			a[c][i] *= invLength;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::SoA_Cross
+// dst[i] = a[i] X b[i] for three component arrays
+// dst may alias a or b
+//--------------------------
+void eoeSIMD_Generic::SoA_Cross(float * const * dst, const float * const * a, const float * const * b, const int count) const {
+	for (int i = 0; i < count; ++i) {
+		const float ax = a[0][i], ay = a[1][i], az = a[2][i];
+		const float bx = b[0][i], by = b[1][i], bz = b[2][i];
+		dst[0][i] = ay * bz - az * by;
+		dst[1][i] = az * bx - ax * bz;
+		dst[2][i] = ax * by - ay * bx;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::SoA_FromVec3
+// splits packed eoeVec3s into dst[0] (x), dst[1] (y), and dst[2] (z)
+//--------------------------
+void eoeSIMD_Generic::SoA_FromVec3(float * const * dst, const eoeVec3 * src, const int count) const {
+	for (int i = 0; i < count; ++i) {
+		dst[0][i] = src[i].x;
+		dst[1][i] = src[i].y;
+		dst[2][i] = src[i].z;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::SoA_FromVec4
+// splits packed eoeVec4s into dst[0] (x), dst[1] (y), dst[2] (z), and dst[3] (w)
+//--------------------------
+void eoeSIMD_Generic::SoA_FromVec4(float * const * dst, const eoeVec4 * src, const int count) const {
+	for (int i = 0; i < count; ++i) {
+		dst[0][i] = src[i].x;
+		dst[1][i] = src[i].y;
+		dst[2][i] = src[i].z;
+		dst[3][i] = src[i].w;
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::SoA_ToVec3
+// packs src[0] (x), src[1] (y), and src[2] (z) into eoeVec3s
+//--------------------------
+void eoeSIMD_Generic::SoA_ToVec3(eoeVec3 * dst, const float * const * src, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i].Set(src[0][i], src[1][i], src[2][i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::SoA_ToVec4
+// packs src[0] (x), src[1] (y), src[2] (z), and src[3] (w) into eoeVec4s
+//--------------------------
+void eoeSIMD_Generic::SoA_ToVec4(eoeVec4 * dst, const float * const * src, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i].Set(src[0][i], src[1][i], src[2][i], src[3][i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Cull_AABBs
+// writes i for every bounds[i] that no plane has entirely on its
+// negative side, see eoeAABB::IsOutside, returns the number written
+//--------------------------
+int eoeSIMD_Generic::Cull_AABBs(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeAABB * bounds, const int count) const {
+	int numVisible = 0;
+	for (int i = 0; i < count; ++i) {
+		int p = 0;
+		while (p < numPlanes && !bounds[i].IsOutside(planes[p]))
+			++p;
+		if (p == numPlanes)
+			visibleIndexes[numVisible++] = i;
+	}
+	return numVisible;
+}
+
+//--------------------------
+// eoeSIMD_Generic::Cull_Spheres
+// writes i for every spheres[i] that no plane has entirely on its
+// negative side, see eoeSphere::IsOutside, returns the number written
+//--------------------------
+int eoeSIMD_Generic::Cull_Spheres(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeSphere * spheres, const int count) const {
+	int numVisible = 0;
+	for (int i = 0; i < count; ++i) {
+		int p = 0;
+		while (p < numPlanes && !spheres[i].IsOutside(planes[p]))
+			++p;
+		if (p == numPlanes)
+			visibleIndexes[numVisible++] = i;
+	}
+	return numVisible;
+}
+
+//--------------------------
+// Random_Step
+// advances every lane of the interleaved state once, see eoeRandom::Step
+//--------------------------
+static void Random_Step(uint32_t * state, uint32_t * bits) {
+	for (int lane = 0; lane < EOE_RANDOM_LANES; ++lane) {
+		bits[lane] = eoeRandom::Step(state[lane],
+									 state[EOE_RANDOM_LANES + lane],
+									 state[2 * EOE_RANDOM_LANES + lane],
+									 state[3 * EOE_RANDOM_LANES + lane]);
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Random_FillUInts
+// dst[i] = raw output of lane i % EOE_RANDOM_LANES
+//--------------------------
+void eoeSIMD_Generic::Random_FillUInts(uint32_t * state, uint32_t * dst, const int count) const {
+	uint32_t bits[EOE_RANDOM_LANES];
+	for (int i = 0; i < count; i += EOE_RANDOM_LANES) {
+		Random_Step(state, bits);
+		const int num = count - i < EOE_RANDOM_LANES ? count - i : EOE_RANDOM_LANES;
+		for (int lane = 0; lane < num; ++lane)
+			dst[i + lane] = bits[lane];
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Random_FillFloats
+// dst[i] = eoeRandom::ToFloat(output, min, range)
+//--------------------------
+void eoeSIMD_Generic::Random_FillFloats(uint32_t * state, float * dst, const int count, const float min, const float range) const {
+	uint32_t bits[EOE_RANDOM_LANES];
+	for (int i = 0; i < count; i += EOE_RANDOM_LANES) {
+		Random_Step(state, bits);
+		const int num = count - i < EOE_RANDOM_LANES ? count - i : EOE_RANDOM_LANES;
+		for (int lane = 0; lane < num; ++lane)
+			dst[i + lane] = eoeRandom::ToFloat(bits[lane], min, range);
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Random_FillInts
+// dst[i] = eoeRandom::ToInt(output, min, span)
+//--------------------------
+void eoeSIMD_Generic::Random_FillInts(uint32_t * state, int * dst, const int count, const int min, const uint64_t span) const {
+	uint32_t bits[EOE_RANDOM_LANES];
+	for (int i = 0; i < count; i += EOE_RANDOM_LANES) {
+		Random_Step(state, bits);
+		const int num = count - i < EOE_RANDOM_LANES ? count - i : EOE_RANDOM_LANES;
+		for (int lane = 0; lane < num; ++lane)
+			dst[i + lane] = eoeRandom::ToInt(bits[lane], min, span);
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Noise_Value2D
+// dst[i] = eoeNoise::Value2D(x[i], y[i], seed)
+//--------------------------
+void eoeSIMD_Generic::Noise_Value2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeNoise::Value2D(x[i], y[i], seed);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Noise_Value3D
+// dst[i] = eoeNoise::Value3D(x[i], y[i], z[i], seed)
+//--------------------------
+void eoeSIMD_Generic::Noise_Value3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeNoise::Value3D(x[i], y[i], z[i], seed);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Noise_Simplex2D
+// dst[i] = eoeNoise::Simplex2D(x[i], y[i], seed)
+//--------------------------
+void eoeSIMD_Generic::Noise_Simplex2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeNoise::Simplex2D(x[i], y[i], seed);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Noise_Simplex3D
+// dst[i] = eoeNoise::Simplex3D(x[i], y[i], z[i], seed)
+//--------------------------
+void eoeSIMD_Generic::Noise_Simplex3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeNoise::Simplex3D(x[i], y[i], z[i], seed);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_Lerp
+// dst[i * numComponents + c] = eoeMath::Lerp(from[...], to[...], fractions[i])
+//--------------------------
+void eoeSIMD_Generic::Float_Lerp(float * dst, const float * from, const float * to, const float * fractions, const int numComponents, const int count) const {
+	for (int i = 0; i < count; ++i) {
+		for (int c = 0; c < numComponents; ++c) {
+			const int index = i * numComponents + c;
+			dst[index] = eoeMath::Lerp(from[index], to[index], fractions[i]);
+		}
+	}
+}
+
+//--------------------------
+// eoeSIMD_Generic::Float_Ease
+// dst[i] = eoeMath::Ease(type, fractions[i])
+//--------------------------
+void eoeSIMD_Generic::Float_Ease(float * dst, const float * fractions, const int count, const eoeEase_t type) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeMath::Ease(type, fractions[i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Quat_Nlerp
+// dst[i] = eoeQuat::Nlerp(from[i], to[i], fractions[i])
+//--------------------------
+void eoeSIMD_Generic::Quat_Nlerp(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeQuat::Nlerp(from[i], to[i], fractions[i]);
+}
+
+//--------------------------
+// eoeSIMD_Generic::Quat_SlerpFast
+// dst[i] = eoeQuat::SlerpFast(from[i], to[i], fractions[i])
+//--------------------------
+void eoeSIMD_Generic::Quat_SlerpFast(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const {
+	for (int i = 0; i < count; ++i)
+		dst[i] = eoeQuat::SlerpFast(from[i], to[i], fractions[i]);
+}
@@ -0,0 +1,73 @@
+#ifndef EOECORE_SIMD_GENERIC_H
+#define EOECORE_SIMD_GENERIC_H
+
+#include "SIMD.h"
+
+//--------------------------------------------
+//			eoeSIMD_Generic
+// plain c++ reference implementation of every kernel
+// other processors must match these results bit-for-bit
+// unless their kernel documents an error bound
+//--------------------------------------------
+class eoeSIMD_Generic : public eoeSIMDProcessor {
+public:
+
+	virtual const char *			GetName() const override;
+
+	virtual void					Mat4_MultiplyMat4(eoeMat4 & dst, const eoeMat4 & a, const eoeMat4 & b) const override;
+	virtual void					Mat4_MultiplyVec4(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const override;
+	virtual void					Mat4_MultiplyVec4Transposed(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const override;
+	virtual void					Mat4_MultiplyMat4sColumnMajor(float * dst, const eoeMat4 & a, const eoeMat4 * b, const int count) const override;
+
+	virtual void					Mat4_Transpose(eoeMat4 & dst, const eoeMat4 & src) const override;
+	virtual bool					Mat4_Inverse(eoeMat4 & dst, const eoeMat4 & src) const override;
+	virtual bool					Mat4_AffineInverse(eoeMat4 & dst, const eoeMat4 & src) const override;
+
+	virtual void					Mat4_TransformVec4(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const override;
+	virtual void					Mat4_TransformVec4Directions(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const override;
+	virtual void					Mat4_TransformVec4Projective(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const override;
+	virtual void					Mat4_TransformVec3Points(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const override;
+	virtual void					Mat4_TransformVec3Directions(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const override;
+	virtual void					Mat4_TransformVec3Projective(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const override;
+
+	virtual void					Mat3x2_TransformVec2(eoeVec2 * dst, const eoeMat3x2 & m, const eoeVec2 * src, const int count) const override;
+
+	virtual void					Float_Add(float * dst, const float * a, const float * b, const int count) const override;
+	virtual void					Float_Scale(float * dst, const float * a, const float scale, const int count) const override;
+	virtual void					Float_MultiplyAdd(float * dst, const float * a, const float * b, const float scale, const int count) const override;
+	virtual void					Float_SnapInt(float * dst, const float * src, const int count) const override;
+	virtual void					Float_SinCosFast(float * sin, float * cos, const float * radians, const int count) const override;
+	virtual void					Float_RSqrtFast(float * dst, const float * src, const int count) const override;
+	virtual void					Float_ATan2Fast(float * dst, const float * y, const float * x, const int count) const override;
+	virtual void					Float_IsometricToOrthographic(float * x, float * y, const int count) const override;
+	virtual void					Float_OrthographicToIsometric(float * x, float * y, const int count) const override;
+	virtual void					Int_IsometricToOrthographic(int * x, int * y, const int count) const override;
+	virtual void					Int_OrthographicToIsometric(int * x, int * y, const int count) const override;
+	virtual void					SoA_Dot(float * dst, const float * const * a, const float * const * b, const int numComponents, const int count) const override;
+	virtual void					SoA_Length(float * dst, const float * const * a, const int numComponents, const int count) const override;
+	virtual void					SoA_Normalize(float * const * a, const int numComponents, const int count) const override;
+	virtual void					SoA_Cross(float * const * dst, const float * const * a, const float * const * b, const int count) const override;
+	virtual void					SoA_FromVec3(float * const * dst, const eoeVec3 * src, const int count) const override;
+	virtual void					SoA_FromVec4(float * const * dst, const eoeVec4 * src, const int count) const override;
+	virtual void					SoA_ToVec3(eoeVec3 * dst, const float * const * src, const int count) const override;
+	virtual void					SoA_ToVec4(eoeVec4 * dst, const float * const * src, const int count) const override;
+
+	virtual int						Cull_AABBs(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeAABB * bounds, const int count) const override;
+	virtual int						Cull_Spheres(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeSphere * spheres, const int count) const override;
+
+	virtual void					Random_FillUInts(uint32_t * state, uint32_t * dst, const int count) const override;
+	virtual void					Random_FillFloats(uint32_t * state, float * dst, const int count, const float min, const float range) const override;
+	virtual void					Random_FillInts(uint32_t * state, int * dst, const int count, const int min, const uint64_t span) const override;
+
+	virtual void					Noise_Value2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const override;
+	virtual void					Noise_Value3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const override;
+	virtual void					Noise_Simplex2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const override;
+	virtual void					Noise_Simplex3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const override;
+
+	virtual void					Float_Lerp(float * dst, const float * from, const float * to, const float * fractions, const int numComponents, const int count) const override;
+	virtual void					Float_Ease(float * dst, const float * fractions, const int count, const eoeEase_t type) const override;
+	virtual void					Quat_Nlerp(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const override;
+	virtual void					Quat_SlerpFast(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const override;
+};
+
+#endif /* EOECORE_SIMD_GENERIC_H */
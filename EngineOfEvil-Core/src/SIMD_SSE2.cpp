@@ -0,0 +1,1923 @@
+#include "SIMD_SSE2.h"
+
+#ifdef EOE_SIMD_X86
+
+#include <emmintrin.h>
+
+//--------------------------
+// LoadVec3x4_SSE2
+// splits four packed eoeVec3s into x, y, and z registers
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline void LoadVec3x4_SSE2(const float * src, __m128 & x, __m128 & y, __m128 & z) {
+	const __m128 x0y0z0x1 = _mm_loadu_ps(src + 0);
+	const __m128 y1z1x2y2 = _mm_loadu_ps(src + 4);
+	const __m128 z2x3y3z3 = _mm_loadu_ps(src + 8);
+	const __m128 x2y2x3y3 = _mm_shuffle_ps(y1z1x2y2, z2x3y3z3, _MM_SHUFFLE(2, 1, 3, 2));
+	const __m128 y0z0y1z1 = _mm_shuffle_ps(x0y0z0x1, y1z1x2y2, _MM_SHUFFLE(1, 0, 2, 1));
+	x = _mm_shuffle_ps(x0y0z0x1, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+	y = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+	z = _mm_shuffle_ps(y0z0y1z1, z2x3y3z3, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+//--------------------------
+// StoreVec3x4_SSE2
+// packs x, y, and z registers into four eoeVec3s
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline void StoreVec3x4_SSE2(float * dst, const __m128 x, const __m128 y, const __m128 z) {
+	const __m128 x0x2y0y2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+	const __m128 y1y3z1z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+	const __m128 z0z2x1x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+	_mm_storeu_ps(dst + 0, _mm_shuffle_ps(x0x2y0y2, z0z2x1x3, _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(dst + 4, _mm_shuffle_ps(y1y3z1z3, x0x2y0y2, _MM_SHUFFLE(3, 1, 2, 0)));
+	_mm_storeu_ps(dst + 8, _mm_shuffle_ps(z0z2x1x3, y1y3z1z3, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+//--------------------------
+// Mat4_MultiplyMat4_SSE2
+// each result row is the rows of b scaled by one row of a,
+// summed in the same order as the generic loop so the result is bit-exact
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static void Mat4_MultiplyMat4_SSE2(float * dst, const float * a, const float * b) {
+	const __m128 b0 = _mm_load_ps(b + 0);
+	const __m128 b1 = _mm_load_ps(b + 4);
+	const __m128 b2 = _mm_load_ps(b + 8);
+	const __m128 b3 = _mm_load_ps(b + 12);
+
+	for (int r = 0; r < 4; ++r) {
+		__m128 row = _mm_mul_ps(_mm_set1_ps(a[0]), b0);
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[1]), b1));
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[2]), b2));
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[3]), b3));
+		_mm_store_ps(dst, row);
+		a += 4;
+		dst += 4;
+	}
+}
+
+//--------------------------
+// Mat4_MultiplyVec4_SSE2
+// transposes m so each lane accumulates one row's dot product
+// in the same order as the generic code, so the result is bit-exact
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static void Mat4_MultiplyVec4_SSE2(float * dst, const float * m, const float * v) {
+	__m128 c0 = _mm_load_ps(m + 0);
+	__m128 c1 = _mm_load_ps(m + 4);
+	__m128 c2 = _mm_load_ps(m + 8);
+	__m128 c3 = _mm_load_ps(m + 12);
+	_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+	__m128 result = _mm_mul_ps(c0, _mm_set1_ps(v[0]));
+	result = _mm_add_ps(result, _mm_mul_ps(c1, _mm_set1_ps(v[1])));
+	result = _mm_add_ps(result, _mm_mul_ps(c2, _mm_set1_ps(v[2])));
+	result = _mm_add_ps(result, _mm_mul_ps(c3, _mm_set1_ps(v[3])));
+	_mm_store_ps(dst, result);
+}
+
+//--------------------------
+// Mat4_MultiplyVec4Transposed_SSE2
+// the rows of m are already the columns of its transpose,
+// so this is Mat4_MultiplyVec4_SSE2 without the transpose
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static void Mat4_MultiplyVec4Transposed_SSE2(float * dst, const float * m, const float * v) {
+	__m128 result = _mm_mul_ps(_mm_load_ps(m + 0), _mm_set1_ps(v[0]));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_load_ps(m + 4), _mm_set1_ps(v[1])));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_load_ps(m + 8), _mm_set1_ps(v[2])));
+	result = _mm_add_ps(result, _mm_mul_ps(_mm_load_ps(m + 12), _mm_set1_ps(v[3])));
+	_mm_store_ps(dst, result);
+}
+
+//--------------------------
+// Mat4_MultiplyMat4sColumnMajor_SSE2
+// a's columns stay in registers, each result column is then
+// a's columns weighted by one column of b[i], summed in the generic order
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static void Mat4_MultiplyMat4sColumnMajor_SSE2(float * dst, const float * a, const float * b, const int count) {
+	__m128 a0 = _mm_load_ps(a + 0);
+	__m128 a1 = _mm_load_ps(a + 4);
+	__m128 a2 = _mm_load_ps(a + 8);
+	__m128 a3 = _mm_load_ps(a + 12);
+	_MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+
+	for (int i = 0; i < count; ++i) {
+		for (int c = 0; c < 4; ++c) {
+			__m128 column = _mm_mul_ps(a0, _mm_set1_ps(b[0 * 4 + c]));
+			column = _mm_add_ps(column, _mm_mul_ps(a1, _mm_set1_ps(b[1 * 4 + c])));
+			column = _mm_add_ps(column, _mm_mul_ps(a2, _mm_set1_ps(b[2 * 4 + c])));
+			column = _mm_add_ps(column, _mm_mul_ps(a3, _mm_set1_ps(b[3 * 4 + c])));
+			_mm_storeu_ps(dst + c * 4, column);
+		}
+		b += 16;
+		dst += 16;
+	}
+}
+
+//--------------------------
+// Mat4_Transpose_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static void Mat4_Transpose_SSE2(float * dst, const float * src) {
+	__m128 r0 = _mm_load_ps(src + 0);
+	__m128 r1 = _mm_load_ps(src + 4);
+	__m128 r2 = _mm_load_ps(src + 8);
+	__m128 r3 = _mm_load_ps(src + 12);
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	_mm_store_ps(dst + 0, r0);
+	_mm_store_ps(dst + 4, r1);
+	_mm_store_ps(dst + 8, r2);
+	_mm_store_ps(dst + 12, r3);
+}
+
+// shuffles of 2x2 sub-matrices packed as (m00, m01, m10, m11)
+#define EOE_SHUFFLE(a, b, x, y, z, w)	_mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+#define EOE_SWIZZLE(a, x, y, z, w)		EOE_SHUFFLE(a, a, x, y, z, w)
+
+//--------------------------
+// Mat2Multiply_SSE2
+// a * b
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Mat2Multiply_SSE2(const __m128 a, const __m128 b) {
+	return _mm_add_ps(_mm_mul_ps(a, EOE_SWIZZLE(b, 0, 3, 0, 3)), _mm_mul_ps(EOE_SWIZZLE(a, 1, 0, 3, 2), EOE_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+//--------------------------
+// Mat2AdjugateMultiply_SSE2
+// adjugate(a) * b
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Mat2AdjugateMultiply_SSE2(const __m128 a, const __m128 b) {
+	return _mm_sub_ps(_mm_mul_ps(EOE_SWIZZLE(a, 3, 3, 0, 0), b), _mm_mul_ps(EOE_SWIZZLE(a, 1, 1, 2, 2), EOE_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+//--------------------------
+// Mat2MultiplyAdjugate_SSE2
+// a * adjugate(b)
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Mat2MultiplyAdjugate_SSE2(const __m128 a, const __m128 b) {
+	return _mm_sub_ps(_mm_mul_ps(a, EOE_SWIZZLE(b, 3, 0, 3, 0)), _mm_mul_ps(EOE_SWIZZLE(a, 1, 0, 3, 2), EOE_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+//--------------------------
+// Mat4_Inverse_SSE2
+// block-wise inverse treating src as four 2x2 sub-matrices | A B |
+//                                                          | C D |
+// not bit-exact with the generic cofactor expansion, both carry
+// roughly FLT_EPSILON * condition-number relative error
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static bool Mat4_Inverse_SSE2(float * dst, const float * src) {
+	const __m128 r0 = _mm_load_ps(src + 0);
+	const __m128 r1 = _mm_load_ps(src + 4);
+	const __m128 r2 = _mm_load_ps(src + 8);
+	const __m128 r3 = _mm_load_ps(src + 12);
+
+	const __m128 A = _mm_movelh_ps(r0, r1);
+	const __m128 B = _mm_movehl_ps(r1, r0);
+	const __m128 C = _mm_movelh_ps(r2, r3);
+	const __m128 D = _mm_movehl_ps(r3, r2);
+
+	// (|A|, |B|, |C|, |D|)
+	const __m128 detSub = _mm_sub_ps(_mm_mul_ps(EOE_SHUFFLE(r0, r2, 0, 2, 0, 2), EOE_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+									 _mm_mul_ps(EOE_SHUFFLE(r0, r2, 1, 3, 1, 3), EOE_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+	const __m128 detA = EOE_SWIZZLE(detSub, 0, 0, 0, 0);
+	const __m128 detB = EOE_SWIZZLE(detSub, 1, 1, 1, 1);
+	const __m128 detC = EOE_SWIZZLE(detSub, 2, 2, 2, 2);
+	const __m128 detD = EOE_SWIZZLE(detSub, 3, 3, 3, 3);
+
+	const __m128 D_C = Mat2AdjugateMultiply_SSE2(D, C);
+	const __m128 A_B = Mat2AdjugateMultiply_SSE2(A, B);
+
+	// adjugates of the four result blocks
+	__m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Multiply_SSE2(B, D_C));
+	__m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Multiply_SSE2(C, A_B));
+	__m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MultiplyAdjugate_SSE2(D, A_B));
+	__m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MultiplyAdjugate_SSE2(A, D_C));
+
+	// |M| = |A||D| + |B||C| - trace((A#B)(D#C))
+	__m128 trace = _mm_mul_ps(A_B, EOE_SWIZZLE(D_C, 0, 2, 1, 3));
+	trace = _mm_add_ps(trace, EOE_SWIZZLE(trace, 2, 3, 0, 1));
+	trace = _mm_add_ps(trace, EOE_SWIZZLE(trace, 1, 0, 3, 2));
+	const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+	const float detScalar = _mm_cvtss_f32(det);
+	if (detScalar < eoeMat4::INVERSE_EPSILON && detScalar > -eoeMat4::INVERSE_EPSILON)
+		return false;
+
+	const __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+	X = _mm_mul_ps(X, invDet);
+	Y = _mm_mul_ps(Y, invDet);
+	Z = _mm_mul_ps(Z, invDet);
+	W = _mm_mul_ps(W, invDet);
+
+	// undo the adjugate and the block packing in one shuffle per row
+	_mm_store_ps(dst + 0, EOE_SHUFFLE(X, Y, 3, 1, 3, 1));
+	_mm_store_ps(dst + 4, EOE_SHUFFLE(X, Y, 2, 0, 2, 0));
+	_mm_store_ps(dst + 8, EOE_SHUFFLE(Z, W, 3, 1, 3, 1));
+	_mm_store_ps(dst + 12, EOE_SHUFFLE(Z, W, 2, 0, 2, 0));
+	return true;
+}
+
+#undef EOE_SWIZZLE
+#undef EOE_SHUFFLE
+
+//--------------------------
+// Mat4_AffineInverse_SSE2
+// same math and operation order as the generic code, so the result is bit-exact
+// each row of src scaled by the inverse squared column lengths is a column of the
+// inverse's upper 3x3, the negated translation is built from those same columns
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static bool Mat4_AffineInverse_SSE2(float * dst, const float * src) {
+	const __m128 r0 = _mm_load_ps(src + 0);
+	const __m128 r1 = _mm_load_ps(src + 4);
+	const __m128 r2 = _mm_load_ps(src + 8);
+	const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+
+	const __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r0, r0), _mm_mul_ps(r1, r1)), _mm_mul_ps(r2, r2));
+	if (_mm_movemask_ps(_mm_cmpeq_ps(lengthSquared, _mm_setzero_ps())) & 7)
+		return false;
+	const __m128 invLengthSquared = _mm_div_ps(_mm_set1_ps(1.0f), lengthSquared);
+
+	__m128 c0 = _mm_and_ps(_mm_mul_ps(r0, invLengthSquared), xyzMask);
+	__m128 c1 = _mm_and_ps(_mm_mul_ps(r1, invLengthSquared), xyzMask);
+	__m128 c2 = _mm_and_ps(_mm_mul_ps(r2, invLengthSquared), xyzMask);
+
+	__m128 translation = _mm_mul_ps(c0, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3)));
+	translation = _mm_add_ps(translation, _mm_mul_ps(c1, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3))));
+	translation = _mm_add_ps(translation, _mm_mul_ps(c2, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3))));
+	translation = _mm_xor_ps(translation, _mm_set1_ps(-0.0f));
+	__m128 c3 = _mm_or_ps(_mm_and_ps(translation, xyzMask), _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+
+	_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+	_mm_store_ps(dst + 0, c0);
+	_mm_store_ps(dst + 4, c1);
+	_mm_store_ps(dst + 8, c2);
+	_mm_store_ps(dst + 12, c3);
+	return true;
+}
+
+//--------------------------
+// Mat4_TransformVec4_SSE2
+// one eoeVec4 per pass against the transposed matrix, like Mat4_MultiplyVec4_SSE2
+//--------------------------
+template<eoeTransformMode_t mode>
+EOE_SIMD_TARGET("sse2")
+static void Mat4_TransformVec4_SSE2(float * dst, const float * m, const float * src, const int count) {
+	__m128 c0 = _mm_load_ps(m + 0);
+	__m128 c1 = _mm_load_ps(m + 4);
+	__m128 c2 = _mm_load_ps(m + 8);
+	__m128 c3 = _mm_load_ps(m + 12);
+	_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 maskXYZ = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+	const __m128 oneW = _mm_andnot_ps(maskXYZ, one);
+
+	for (int i = 0; i < count; ++i) {
+		const __m128 v = _mm_load_ps(src);
+		__m128 result = _mm_mul_ps(c0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+		result = _mm_add_ps(result, _mm_mul_ps(c1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+		result = _mm_add_ps(result, _mm_mul_ps(c2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+		if (mode != TRANSFORM_DIRECTION)
+			result = _mm_add_ps(result, _mm_mul_ps(c3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+
+		if (mode == TRANSFORM_PROJECTIVE) {
+			const __m128 invW = _mm_div_ps(one, _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 3, 3, 3)));
+			result = _mm_or_ps(_mm_and_ps(_mm_mul_ps(result, invW), maskXYZ), oneW);
+		}
+		_mm_store_ps(dst, result);
+		src += 4;
+		dst += 4;
+	}
+}
+
+//--------------------------
+// Mat4_TransformVec3_SSE2
+// four eoeVec3s per pass, split into x, y, and z registers
+// with every matrix element held in its own register
+// returns the number of vectors transformed, the caller finishes the remainder
+//--------------------------
+template<eoeTransformMode_t mode>
+EOE_SIMD_TARGET("sse2")
+static int Mat4_TransformVec3_SSE2(float * dst, const float * m, const float * src, const int count) {
+	const __m128 m00 = _mm_set1_ps(m[ 0]), m01 = _mm_set1_ps(m[ 1]), m02 = _mm_set1_ps(m[ 2]), m03 = _mm_set1_ps(m[ 3]);
+	const __m128 m10 = _mm_set1_ps(m[ 4]), m11 = _mm_set1_ps(m[ 5]), m12 = _mm_set1_ps(m[ 6]), m13 = _mm_set1_ps(m[ 7]);
+	const __m128 m20 = _mm_set1_ps(m[ 8]), m21 = _mm_set1_ps(m[ 9]), m22 = _mm_set1_ps(m[10]), m23 = _mm_set1_ps(m[11]);
+	const __m128 m30 = _mm_set1_ps(m[12]), m31 = _mm_set1_ps(m[13]), m32 = _mm_set1_ps(m[14]), m33 = _mm_set1_ps(m[15]);
+	const __m128 one = _mm_set1_ps(1.0f);
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 x, y, z;
+		LoadVec3x4_SSE2(src, x, y, z);
+
+		__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, x), _mm_mul_ps(m01, y)), _mm_mul_ps(m02, z));
+		__m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, x), _mm_mul_ps(m11, y)), _mm_mul_ps(m12, z));
+		__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, x), _mm_mul_ps(m21, y)), _mm_mul_ps(m22, z));
+		if (mode != TRANSFORM_DIRECTION) {
+			rx = _mm_add_ps(rx, m03);
+			ry = _mm_add_ps(ry, m13);
+			rz = _mm_add_ps(rz, m23);
+		}
+
+		if (mode == TRANSFORM_PROJECTIVE) {
+			const __m128 rw = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m30, x), _mm_mul_ps(m31, y)), _mm_mul_ps(m32, z)), m33);
+			const __m128 invW = _mm_div_ps(one, rw);
+			rx = _mm_mul_ps(rx, invW);
+			ry = _mm_mul_ps(ry, invW);
+			rz = _mm_mul_ps(rz, invW);
+		}
+		StoreVec3x4_SSE2(dst, rx, ry, rz);
+		src += 12;
+		dst += 12;
+	}
+	return i;
+}
+
+//--------------------------
+// Mat3x2_TransformVec2_SSE2
+// two eoeVec2s per register, four per pass, with x and y duplicated across
+// each pair so the columns can be applied without transposing
+// returns the number of vectors transformed, the caller finishes the remainder
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Mat3x2_TransformVec2_SSE2(float * dst, const float * m, const float * src, const int count) {
+	const __m128 xAxis = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+	const __m128 yAxis = _mm_setr_ps(m[2], m[3], m[2], m[3]);
+	const __m128 translation = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 p0 = _mm_loadu_ps(src);
+		const __m128 p1 = _mm_loadu_ps(src + 4);
+		const __m128 x0 = _mm_shuffle_ps(p0, p0, _MM_SHUFFLE(2, 2, 0, 0));
+		const __m128 y0 = _mm_shuffle_ps(p0, p0, _MM_SHUFFLE(3, 3, 1, 1));
+		const __m128 x1 = _mm_shuffle_ps(p1, p1, _MM_SHUFFLE(2, 2, 0, 0));
+		const __m128 y1 = _mm_shuffle_ps(p1, p1, _MM_SHUFFLE(3, 3, 1, 1));
+
+		_mm_storeu_ps(dst, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xAxis, x0), _mm_mul_ps(yAxis, y0)), translation));
+		_mm_storeu_ps(dst + 4, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xAxis, x1), _mm_mul_ps(yAxis, y1)), translation));
+		src += 8;
+		dst += 8;
+	}
+	return i;
+}
+
+//--------------------------
+// Float_Add_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_Add_SSE2(float * dst, const float * a, const float * b, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+	return i;
+}
+
+//--------------------------
+// Float_Scale_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_Scale_SSE2(float * dst, const float * a, const float scale, const int count) {
+	const __m128 s = _mm_set1_ps(scale);
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(a + i), s));
+	return i;
+}
+
+//--------------------------
+// Float_MultiplyAdd_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_MultiplyAdd_SSE2(float * dst, const float * a, const float * b, const float scale, const int count) {
+	const __m128 s = _mm_set1_ps(scale);
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_mul_ps(_mm_loadu_ps(b + i), s)));
+	return i;
+}
+
+//--------------------------
+// Float_SnapInt_SSE2
+// SSE2 has no floor, so truncate and step down where truncation rounded up,
+// values of magnitude 2^23 and beyond (and inf/nan) are already integral and pass through
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_SnapInt_SSE2(float * dst, const float * src, const int count) {
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 noFraction = _mm_set1_ps(8388608.0f);
+	const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 v = _mm_add_ps(_mm_loadu_ps(src + i), half);
+		const __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+		const __m128 floored = _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, v), one));
+		const __m128 hasFraction = _mm_cmplt_ps(_mm_and_ps(v, absMask), noFraction);
+		_mm_storeu_ps(dst + i, _mm_or_ps(_mm_and_ps(hasFraction, floored), _mm_andnot_ps(hasFraction, v)));
+	}
+	return i;
+}
+
+//--------------------------
+// SinCosFast_SSE2
+// same reduction, polynomials, and operation order as eoeMath::SinCosFast
+// _mm_cvtps_epi32 rounds like rintf under the default rounding mode
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline void SinCosFast_SSE2(const __m128 x, __m128 & sin, __m128 & cos) {
+	const __m128i oneInt = _mm_set1_epi32(1);
+	const __m128i twoInt = _mm_set1_epi32(2);
+	const __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(eoeMath::TWO_OVER_PI)));
+	const __m128 q = _mm_cvtepi32_ps(quadrant);
+	__m128 r = _mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(eoeMath::PIO2_HIGH)));
+	r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(eoeMath::PIO2_MID)));
+	r = _mm_sub_ps(r, _mm_mul_ps(q, _mm_set1_ps(eoeMath::PIO2_LOW)));
+	const __m128 z = _mm_mul_ps(r, r);
+
+	__m128 sinR = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(eoeMath::SIN_C2), z), _mm_set1_ps(eoeMath::SIN_C1));
+	sinR = _mm_add_ps(_mm_mul_ps(sinR, z), _mm_set1_ps(eoeMath::SIN_C0));
+	sinR = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinR, z), r), r);
+
+	__m128 cosR = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(eoeMath::COS_C2), z), _mm_set1_ps(eoeMath::COS_C1));
+	cosR = _mm_add_ps(_mm_mul_ps(cosR, z), _mm_set1_ps(eoeMath::COS_C0));
+	cosR = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(cosR, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z));
+	cosR = _mm_add_ps(cosR, _mm_set1_ps(1.0f));
+
+	const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, oneInt), oneInt));
+	const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, twoInt), 30));
+	const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, oneInt), twoInt), 30));
+	sin = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, cosR), _mm_andnot_ps(swap, sinR)), sinSign);
+	cos = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, sinR), _mm_andnot_ps(swap, cosR)), cosSign);
+}
+
+//--------------------------
+// Float_SinCosFast_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_SinCosFast_SSE2(float * sin, float * cos, const float * radians, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 s;
+		__m128 c;
+		SinCosFast_SSE2(_mm_loadu_ps(radians + i), s, c);
+		_mm_storeu_ps(sin + i, s);
+		_mm_storeu_ps(cos + i, c);
+	}
+	return i;
+}
+
+//--------------------------
+// Float_RSqrtFast_SSE2
+// same integer estimate and newton-raphson steps as eoeMath::RSqrtFast
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_RSqrtFast_SSE2(float * dst, const float * src, const int count) {
+	const __m128i magic = _mm_set1_epi32(eoeMath::RSQRT_MAGIC);
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 threeHalves = _mm_set1_ps(1.5f);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 x = _mm_loadu_ps(src + i);
+		const __m128 halfX = _mm_mul_ps(half, x);
+		__m128 y = _mm_castsi128_ps(_mm_sub_epi32(magic, _mm_srai_epi32(_mm_castps_si128(x), 1)));
+		y = _mm_mul_ps(y, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(halfX, y), y)));
+		y = _mm_mul_ps(y, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(halfX, y), y)));
+		_mm_storeu_ps(dst + i, y);
+	}
+	return i;
+}
+
+//--------------------------
+// ATan2Fast_SSE2
+// same octant reduction and polynomial as eoeMath::ATan2Fast
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 ATan2Fast_SSE2(const __m128 vy, const __m128 vx) {
+	const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 absX = _mm_and_ps(vx, absMask);
+	const __m128 absY = _mm_and_ps(vy, absMask);
+	const __m128 maxXY = _mm_max_ps(absX, absY);
+	const __m128 minXY = _mm_min_ps(absX, absY);
+	const __m128 a = _mm_and_ps(_mm_div_ps(minXY, maxXY), _mm_cmpneq_ps(maxXY, zero));
+	const __m128 s = _mm_mul_ps(a, a);
+
+	__m128 angle = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(eoeMath::ATAN_C4), s), _mm_set1_ps(eoeMath::ATAN_C3));
+	angle = _mm_add_ps(_mm_mul_ps(angle, s), _mm_set1_ps(eoeMath::ATAN_C2));
+	angle = _mm_add_ps(_mm_mul_ps(angle, s), _mm_set1_ps(eoeMath::ATAN_C1));
+	angle = _mm_add_ps(_mm_mul_ps(angle, s), _mm_set1_ps(eoeMath::ATAN_C0));
+	angle = _mm_mul_ps(angle, a);
+
+	const __m128 steep = _mm_cmpgt_ps(absY, absX);
+	angle = _mm_or_ps(_mm_and_ps(steep, _mm_sub_ps(_mm_set1_ps(eoeMath::HALF_PI), angle)), _mm_andnot_ps(steep, angle));
+	const __m128 negativeX = _mm_cmplt_ps(vx, zero);
+	angle = _mm_or_ps(_mm_and_ps(negativeX, _mm_sub_ps(_mm_set1_ps(eoeMath::PI), angle)), _mm_andnot_ps(negativeX, angle));
+	angle = _mm_xor_ps(angle, _mm_and_ps(vy, signMask));
+	return angle;
+}
+
+//--------------------------
+// Float_ATan2Fast_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_ATan2Fast_SSE2(float * dst, const float * y, const float * x, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(dst + i, ATan2Fast_SSE2(_mm_loadu_ps(y + i), _mm_loadu_ps(x + i)));
+	return i;
+}
+
+//--------------------------
+// Float_IsometricToOrthographic_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_IsometricToOrthographic_SSE2(float * x, float * y, const int count) {
+	const __m128 two = _mm_set1_ps(2.0f);
+	const __m128 half = _mm_set1_ps(0.5f);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 isoX = _mm_loadu_ps(x + i);
+		const __m128 twoIsoY = _mm_mul_ps(two, _mm_loadu_ps(y + i));
+		_mm_storeu_ps(x + i, _mm_mul_ps(_mm_add_ps(twoIsoY, isoX), half));
+		_mm_storeu_ps(y + i, _mm_mul_ps(_mm_sub_ps(twoIsoY, isoX), half));
+	}
+	return i;
+}
+
+//--------------------------
+// Float_OrthographicToIsometric_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_OrthographicToIsometric_SSE2(float * x, float * y, const int count) {
+	const __m128 half = _mm_set1_ps(0.5f);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 cartX = _mm_loadu_ps(x + i);
+		const __m128 cartY = _mm_loadu_ps(y + i);
+		_mm_storeu_ps(x + i, _mm_sub_ps(cartX, cartY));
+		_mm_storeu_ps(y + i, _mm_mul_ps(_mm_add_ps(cartX, cartY), half));
+	}
+	return i;
+}
+
+//--------------------------
+// Int_IsometricToOrthographic_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Int_IsometricToOrthographic_SSE2(int * x, int * y, const int count) {
+	const __m128i one = _mm_set1_epi32(1);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128i isoX = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x + i));
+		const __m128i isoY = _mm_loadu_si128(reinterpret_cast<const __m128i *>(y + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(x + i), _mm_add_epi32(isoY, _mm_srai_epi32(_mm_add_epi32(isoX, one), 1)));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(y + i), _mm_add_epi32(isoY, _mm_srai_epi32(_mm_sub_epi32(one, isoX), 1)));
+	}
+	return i;
+}
+
+//--------------------------
+// Int_OrthographicToIsometric_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Int_OrthographicToIsometric_SSE2(int * x, int * y, const int count) {
+	const __m128i one = _mm_set1_epi32(1);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128i cartX = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x + i));
+		const __m128i cartY = _mm_loadu_si128(reinterpret_cast<const __m128i *>(y + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(x + i), _mm_sub_epi32(cartX, cartY));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(y + i), _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(cartX, cartY), one), 1));
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_Dot_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int SoA_Dot_SSE2(float * dst, const float * const * a, const float * const * b, const int numComponents, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 dot = _mm_mul_ps(_mm_loadu_ps(a[0] + i), _mm_loadu_ps(b[0] + i));
+		for (int c = 1; c < numComponents; ++c)
+			dot = _mm_add_ps(dot, _mm_mul_ps(_mm_loadu_ps(a[c] + i), _mm_loadu_ps(b[c] + i)));
+		_mm_storeu_ps(dst + i, dot);
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_Length_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int SoA_Length_SSE2(float * dst, const float * const * a, const int numComponents, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 v = _mm_loadu_ps(a[0] + i);
+		__m128 lengthSquared = _mm_mul_ps(v, v);
+		for (int c = 1; c < numComponents; ++c) {
+			v = _mm_loadu_ps(a[c] + i);
+			lengthSquared = _mm_add_ps(lengthSquared, _mm_mul_ps(v, v));
+		}
+		_mm_storeu_ps(dst + i, _mm_sqrt_ps(lengthSquared));
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_Normalize_SSE2
+// divides by the correctly rounded sqrt, so it matches eoeVec3::Normalize exactly
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int SoA_Normalize_SSE2(float * const * a, const int numComponents, const int count) {
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 zero = _mm_setzero_ps();
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 v = _mm_loadu_ps(a[0] + i);
+		__m128 length = _mm_mul_ps(v, v);
+		for (int c = 1; c < numComponents; ++c) {
+			v = _mm_loadu_ps(a[c] + i);
+			length = _mm_add_ps(length, _mm_mul_ps(v, v));
+		}
+		length = _mm_sqrt_ps(length);
+
+		const __m128 invLength = _mm_andnot_ps(_mm_cmpeq_ps(length, zero), _mm_div_ps(one, length));
+		for (int c = 0; c < numComponents; ++c)
+			_mm_storeu_ps(a[c] + i, _mm_mul_ps(_mm_loadu_ps(a[c] + i), invLength));
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_Cross_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int SoA_Cross_SSE2(float * const * dst, const float * const * a, const float * const * b, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 ax = _mm_loadu_ps(a[0] + i), ay = _mm_loadu_ps(a[1] + i), az = _mm_loadu_ps(a[2] + i);
+		const __m128 bx = _mm_loadu_ps(b[0] + i), by = _mm_loadu_ps(b[1] + i), bz = _mm_loadu_ps(b[2] + i);
+		_mm_storeu_ps(dst[0] + i, _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+		_mm_storeu_ps(dst[1] + i, _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)));
+		_mm_storeu_ps(dst[2] + i, _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_FromVec3_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int SoA_FromVec3_SSE2(float * const * dst, const float * src, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 x, y, z;
+		LoadVec3x4_SSE2(src + i * 3, x, y, z);
+		_mm_storeu_ps(dst[0] + i, x);
+		_mm_storeu_ps(dst[1] + i, y);
+		_mm_storeu_ps(dst[2] + i, z);
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_FromVec4_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int SoA_FromVec4_SSE2(float * const * dst, const float * src, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 v0 = _mm_load_ps(src + i * 4 + 0);
+		__m128 v1 = _mm_load_ps(src + i * 4 + 4);
+		__m128 v2 = _mm_load_ps(src + i * 4 + 8);
+		__m128 v3 = _mm_load_ps(src + i * 4 + 12);
+		_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+		_mm_storeu_ps(dst[0] + i, v0);
+		_mm_storeu_ps(dst[1] + i, v1);
+		_mm_storeu_ps(dst[2] + i, v2);
+		_mm_storeu_ps(dst[3] + i, v3);
+	}
+	return i;
+}
+
+//--------------------------
+// SoA_ToVec3_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int SoA_ToVec3_SSE2(float * dst, const float * const * src, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+		StoreVec3x4_SSE2(dst + i * 3, _mm_loadu_ps(src[0] + i), _mm_loadu_ps(src[1] + i), _mm_loadu_ps(src[2] + i));
+	return i;
+}
+
+//--------------------------
+// SoA_ToVec4_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int SoA_ToVec4_SSE2(float * dst, const float * const * src, const int count) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 v0 = _mm_loadu_ps(src[0] + i);
+		__m128 v1 = _mm_loadu_ps(src[1] + i);
+		__m128 v2 = _mm_loadu_ps(src[2] + i);
+		__m128 v3 = _mm_loadu_ps(src[3] + i);
+		_MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+		_mm_store_ps(dst + i * 4 + 0, v0);
+		_mm_store_ps(dst + i * 4 + 4, v1);
+		_mm_store_ps(dst + i * 4 + 8, v2);
+		_mm_store_ps(dst + i * 4 + 12, v3);
+	}
+	return i;
+}
+
+//--------------------------
+// Cull_AABBs_SSE2
+// four boxes per iteration, each plane tested in the same order as eoeAABB::IsOutside
+// returns the number of boxes tested, numVisible receives how many indexes were written
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Cull_AABBs_SSE2(int * visibleIndexes, int & numVisible, const eoePlane * planes, const int numPlanes, const eoeAABB * bounds, const int count) {
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	const __m128 zero = _mm_setzero_ps();
+	const float * src = reinterpret_cast<const float *>(bounds);
+	numVisible = 0;
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4, src += 24) {
+		// (mins.x, mins.y, mins.z, maxs.x) and (mins.z, maxs.x, maxs.y, maxs.z) of each box, transposed
+		__m128 minX = _mm_loadu_ps(src + 0);
+		__m128 minY = _mm_loadu_ps(src + 6);
+		__m128 minZ = _mm_loadu_ps(src + 12);
+		__m128 maxX = _mm_loadu_ps(src + 18);
+		__m128 skip0 = _mm_loadu_ps(src + 2);
+		__m128 skip1 = _mm_loadu_ps(src + 8);
+		__m128 maxY = _mm_loadu_ps(src + 14);
+		__m128 maxZ = _mm_loadu_ps(src + 20);
+		_MM_TRANSPOSE4_PS(minX, minY, minZ, maxX);
+		_MM_TRANSPOSE4_PS(skip0, skip1, maxY, maxZ);
+
+		const __m128 centerX = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+		const __m128 centerY = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+		const __m128 centerZ = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+		const __m128 extentX = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+		const __m128 extentY = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+		const __m128 extentZ = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+		__m128 outside = zero;
+		for (int p = 0; p < numPlanes; ++p) {
+			const __m128 normalX = _mm_set1_ps(planes[p].normal.x);
+			const __m128 normalY = _mm_set1_ps(planes[p].normal.y);
+			const __m128 normalZ = _mm_set1_ps(planes[p].normal.z);
+			__m128 distance = _mm_add_ps(_mm_mul_ps(normalX, centerX), _mm_mul_ps(normalY, centerY));
+			distance = _mm_add_ps(distance, _mm_mul_ps(normalZ, centerZ));
+			distance = _mm_add_ps(distance, _mm_set1_ps(planes[p].d));
+			__m128 radius = _mm_add_ps(_mm_mul_ps(_mm_and_ps(normalX, absMask), extentX), _mm_mul_ps(_mm_and_ps(normalY, absMask), extentY));
+			radius = _mm_add_ps(radius, _mm_mul_ps(_mm_and_ps(normalZ, absMask), extentZ));
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+		}
+		CompactIndexes(visibleIndexes, numVisible, i, ~_mm_movemask_ps(outside) & 0xf, 4);
+	}
+	return i;
+}
+
+//--------------------------
+// Cull_Spheres_SSE2
+// four spheres per iteration, each plane tested in the same order as eoeSphere::IsOutside
+// returns the number of spheres tested, numVisible receives how many indexes were written
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Cull_Spheres_SSE2(int * visibleIndexes, int & numVisible, const eoePlane * planes, const int numPlanes, const eoeSphere * spheres, const int count) {
+	const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+	const float * src = reinterpret_cast<const float *>(spheres);
+	numVisible = 0;
+
+	int i = 0;
+	for (; i + 4 <= count; i += 4, src += 16) {
+		__m128 originX = _mm_loadu_ps(src + 0);
+		__m128 originY = _mm_loadu_ps(src + 4);
+		__m128 originZ = _mm_loadu_ps(src + 8);
+		__m128 radius = _mm_loadu_ps(src + 12);
+		_MM_TRANSPOSE4_PS(originX, originY, originZ, radius);
+		const __m128 negRadius = _mm_xor_ps(radius, signMask);
+
+		__m128 outside = _mm_setzero_ps();
+		for (int p = 0; p < numPlanes; ++p) {
+			__m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p].normal.x), originX), _mm_mul_ps(_mm_set1_ps(planes[p].normal.y), originY));
+			distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(planes[p].normal.z), originZ));
+			distance = _mm_add_ps(distance, _mm_set1_ps(planes[p].d));
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negRadius));
+		}
+		CompactIndexes(visibleIndexes, numVisible, i, ~_mm_movemask_ps(outside) & 0xf, 4);
+	}
+	return i;
+}
+
+//--------------------------
+// Random_Step_SSE2
+// one eoeRandom::Step of four lanes, the multiplies by 5 and 9 as shifts and adds
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128i Random_Step_SSE2(__m128i * s) {
+	const __m128i scrambled = _mm_add_epi32(_mm_slli_epi32(s[1], 2), s[1]);
+	const __m128i rotated = _mm_or_si128(_mm_slli_epi32(scrambled, 7), _mm_srli_epi32(scrambled, 25));
+	const __m128i result = _mm_add_epi32(_mm_slli_epi32(rotated, 3), rotated);
+	const __m128i t = _mm_slli_epi32(s[1], 9);
+
+	s[2] = _mm_xor_si128(s[2], s[0]);
+	s[3] = _mm_xor_si128(s[3], s[1]);
+	s[1] = _mm_xor_si128(s[1], s[2]);
+	s[0] = _mm_xor_si128(s[0], s[3]);
+	s[2] = _mm_xor_si128(s[2], t);
+	s[3] = _mm_or_si128(_mm_slli_epi32(s[3], 11), _mm_srli_epi32(s[3], 21));
+	return result;
+}
+
+//--------------------------
+// Random_MulHigh_SSE2
+// high 32 bits of each unsigned 32x32 product of bits and span
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128i Random_MulHigh_SSE2(const __m128i bits, const __m128i span) {
+	const __m128i even = _mm_srli_epi64(_mm_mul_epu32(bits, span), 32);
+	const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(bits, 32), span);
+	return _mm_or_si128(even, _mm_and_si128(odd, _mm_set_epi32(-1, 0, -1, 0)));
+}
+
+//--------------------------
+// Random_FillUInts_SSE2
+// whole steps only, returns the number of outputs written
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Random_FillUInts_SSE2(uint32_t * state, uint32_t * dst, const int count) {
+	__m128i lo[4];
+	__m128i hi[4];
+	for (int word = 0; word < 4; ++word) {
+		lo[word] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + word * EOE_RANDOM_LANES));
+		hi[word] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + word * EOE_RANDOM_LANES + 4));
+	}
+	int i = 0;
+	for (; i + EOE_RANDOM_LANES <= count; i += EOE_RANDOM_LANES) {
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), Random_Step_SSE2(lo));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), Random_Step_SSE2(hi));
+	}
+	for (int word = 0; word < 4; ++word) {
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state + word * EOE_RANDOM_LANES), lo[word]);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state + word * EOE_RANDOM_LANES + 4), hi[word]);
+	}
+	return i;
+}
+
+//--------------------------
+// Random_FillFloats_SSE2
+// same operation order as eoeRandom::ToFloat
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Random_FillFloats_SSE2(uint32_t * state, float * dst, const int count, const float min, const float range) {
+	__m128i lo[4];
+	__m128i hi[4];
+	for (int word = 0; word < 4; ++word) {
+		lo[word] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + word * EOE_RANDOM_LANES));
+		hi[word] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + word * EOE_RANDOM_LANES + 4));
+	}
+	const __m128 toUnit = _mm_set1_ps(1.0f / 16777216.0f);
+	const __m128 minV = _mm_set1_ps(min);
+	const __m128 rangeV = _mm_set1_ps(range);
+	int i = 0;
+	for (; i + EOE_RANDOM_LANES <= count; i += EOE_RANDOM_LANES) {
+		const __m128 unitLo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Random_Step_SSE2(lo), 8)), toUnit);
+		const __m128 unitHi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Random_Step_SSE2(hi), 8)), toUnit);
+		_mm_storeu_ps(dst + i, _mm_add_ps(minV, _mm_mul_ps(unitLo, rangeV)));
+		_mm_storeu_ps(dst + i + 4, _mm_add_ps(minV, _mm_mul_ps(unitHi, rangeV)));
+	}
+	for (int word = 0; word < 4; ++word) {
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state + word * EOE_RANDOM_LANES), lo[word]);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state + word * EOE_RANDOM_LANES + 4), hi[word]);
+	}
+	return i;
+}
+
+//--------------------------
+// Random_FillInts_SSE2
+// same as eoeRandom::ToInt, a span of 2^32 passes the bits straight through
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Random_FillInts_SSE2(uint32_t * state, int * dst, const int count, const int min, const uint64_t span) {
+	__m128i lo[4];
+	__m128i hi[4];
+	for (int word = 0; word < 4; ++word) {
+		lo[word] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + word * EOE_RANDOM_LANES));
+		hi[word] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state + word * EOE_RANDOM_LANES + 4));
+	}
+	const bool fullRange = span > 0xffffffffull;
+	const __m128i spanV = _mm_set1_epi32((int)(uint32_t)span);
+	const __m128i minV = _mm_set1_epi32(min);
+	int i = 0;
+	for (; i + EOE_RANDOM_LANES <= count; i += EOE_RANDOM_LANES) {
+		const __m128i bitsLo = Random_Step_SSE2(lo);
+		const __m128i bitsHi = Random_Step_SSE2(hi);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_add_epi32(minV, fullRange ? bitsLo : Random_MulHigh_SSE2(bitsLo, spanV)));
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i + 4), _mm_add_epi32(minV, fullRange ? bitsHi : Random_MulHigh_SSE2(bitsHi, spanV)));
+	}
+	for (int word = 0; word < 4; ++word) {
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state + word * EOE_RANDOM_LANES), lo[word]);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(state + word * EOE_RANDOM_LANES + 4), hi[word]);
+	}
+	return i;
+}
+
+//--------------------------
+// MulLo_SSE2
+// low 32 bits of each 32x32 product, SSE2 has no _mm_mullo_epi32
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128i MulLo_SSE2(const __m128i a, const __m128i b) {
+	const __m128i even = _mm_mul_epu32(a, b);
+	const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+//--------------------------
+// Select_SSE2
+// mask ? a : b per lane, mask lanes all ones or all zeros
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Select_SSE2(const __m128 mask, const __m128 a, const __m128 b) {
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+//--------------------------
+// Noise_Floor_SSE2
+// same as eoeNoise::Floor, truncates and steps down where that rounded up
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128i Noise_Floor_SSE2(const __m128 x) {
+	const __m128i truncated = _mm_cvttps_epi32(x);
+	return _mm_add_epi32(truncated, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(truncated), x)));
+}
+
+//--------------------------
+// Noise_Mix_SSE2
+// same as eoeNoise::Mix
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128i Noise_Mix_SSE2(__m128i hash) {
+	hash = _mm_xor_si128(hash, _mm_srli_epi32(hash, 16));
+	hash = MulLo_SSE2(hash, _mm_set1_epi32((int)eoeNoise::MIX_0));
+	hash = _mm_xor_si128(hash, _mm_srli_epi32(hash, 15));
+	hash = MulLo_SSE2(hash, _mm_set1_epi32((int)eoeNoise::MIX_1));
+	return _mm_xor_si128(hash, _mm_srli_epi32(hash, 16));
+}
+
+//--------------------------
+// Noise_Hash2_SSE2
+// same as eoeNoise::Hash of x, y
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128i Noise_Hash2_SSE2(const __m128i x, const __m128i y, const __m128i seed) {
+	const __m128i hx = MulLo_SSE2(x, _mm_set1_epi32((int)eoeNoise::HASH_X));
+	const __m128i hy = MulLo_SSE2(y, _mm_set1_epi32((int)eoeNoise::HASH_Y));
+	return Noise_Mix_SSE2(_mm_xor_si128(_mm_xor_si128(seed, hx), hy));
+}
+
+//--------------------------
+// Noise_Hash3_SSE2
+// same as eoeNoise::Hash of x, y, z
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128i Noise_Hash3_SSE2(const __m128i x, const __m128i y, const __m128i z, const __m128i seed) {
+	const __m128i hx = MulLo_SSE2(x, _mm_set1_epi32((int)eoeNoise::HASH_X));
+	const __m128i hy = MulLo_SSE2(y, _mm_set1_epi32((int)eoeNoise::HASH_Y));
+	const __m128i hz = MulLo_SSE2(z, _mm_set1_epi32((int)eoeNoise::HASH_Z));
+	return Noise_Mix_SSE2(_mm_xor_si128(_mm_xor_si128(_mm_xor_si128(seed, hx), hy), hz));
+}
+
+//--------------------------
+// Noise_HashToFloat_SSE2
+// same as eoeNoise::HashToFloat
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Noise_HashToFloat_SSE2(const __m128i hash) {
+	const __m128 high = _mm_cvtepi32_ps(_mm_srli_epi32(hash, 8));
+	return _mm_sub_ps(_mm_mul_ps(high, _mm_set1_ps(2.0f / 16777216.0f)), _mm_set1_ps(1.0f));
+}
+
+//--------------------------
+// Noise_Fade_SSE2
+// same as eoeNoise::Fade
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Noise_Fade_SSE2(const __m128 t) {
+	const __m128 cube = _mm_mul_ps(_mm_mul_ps(t, t), t);
+	const __m128 inner = _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f));
+	return _mm_mul_ps(cube, _mm_add_ps(_mm_mul_ps(t, inner), _mm_set1_ps(10.0f)));
+}
+
+//--------------------------
+// Noise_Lerp_SSE2
+// same as eoeNoise::Lerp
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Noise_Lerp_SSE2(const __m128 a, const __m128 b, const __m128 t) {
+	return _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t));
+}
+
+//--------------------------
+// Noise_Gradient2_SSE2
+// same as the 2D eoeNoise::Gradient, the negations as sign flips
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Noise_Gradient2_SSE2(const __m128i hash, const __m128 x, const __m128 y) {
+	const __m128i four = _mm_set1_epi32(4);
+	const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(hash, four), four));
+	const __m128 u = Select_SSE2(swap, y, x);
+	const __m128 v = _mm_mul_ps(_mm_set1_ps(2.0f), Select_SSE2(swap, x, y));
+	const __m128 uSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(hash, _mm_set1_epi32(1)), 31));
+	const __m128 vSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(hash, _mm_set1_epi32(2)), 30));
+	return _mm_add_ps(_mm_xor_ps(u, uSign), _mm_xor_ps(v, vSign));
+}
+
+//--------------------------
+// Noise_Gradient3_SSE2
+// same as the 3D eoeNoise::Gradient, the negations as sign flips
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Noise_Gradient3_SSE2(const __m128i hash, const __m128 x, const __m128 y, const __m128 z) {
+	const __m128i edge = _mm_and_si128(hash, _mm_set1_epi32(15));
+	const __m128 uIsX = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_set1_epi32(8), edge));
+	const __m128 vIsY = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_set1_epi32(4), edge));
+	const __m128 vIsX = _mm_castsi128_ps(_mm_or_si128(_mm_cmpeq_epi32(edge, _mm_set1_epi32(12)), _mm_cmpeq_epi32(edge, _mm_set1_epi32(14))));
+	const __m128 u = Select_SSE2(uIsX, x, y);
+	const __m128 v = Select_SSE2(vIsY, y, Select_SSE2(vIsX, x, z));
+	const __m128 uSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(edge, _mm_set1_epi32(1)), 31));
+	const __m128 vSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(edge, _mm_set1_epi32(2)), 30));
+	return _mm_add_ps(_mm_xor_ps(u, uSign), _mm_xor_ps(v, vSign));
+}
+
+//--------------------------
+// Noise_Falloff2_SSE2
+// same as the 2D eoeNoise::Falloff
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Noise_Falloff2_SSE2(const __m128 x, const __m128 y) {
+	__m128 t = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(eoeNoise::RADIUS_SQUARED), _mm_mul_ps(x, x)), _mm_mul_ps(y, y));
+	t = _mm_max_ps(t, _mm_setzero_ps());
+	t = _mm_mul_ps(t, t);
+	return _mm_mul_ps(t, t);
+}
+
+//--------------------------
+// Noise_Falloff3_SSE2
+// same as the 3D eoeNoise::Falloff
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Noise_Falloff3_SSE2(const __m128 x, const __m128 y, const __m128 z) {
+	__m128 t = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(eoeNoise::RADIUS_SQUARED), _mm_mul_ps(x, x)), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+	t = _mm_max_ps(t, _mm_setzero_ps());
+	t = _mm_mul_ps(t, t);
+	return _mm_mul_ps(t, t);
+}
+
+//--------------------------
+// Noise_Value2D_SSE2
+// same lattice, fade, and lerp order as eoeNoise::Value2D
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Noise_Value2D_SSE2(float * dst, const float * x, const float * y, const int count, const uint32_t seed) {
+	const __m128i seedV = _mm_set1_epi32((int)seed);
+	const __m128i one = _mm_set1_epi32(1);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 vx = _mm_loadu_ps(x + i);
+		const __m128 vy = _mm_loadu_ps(y + i);
+		const __m128i ix = Noise_Floor_SSE2(vx);
+		const __m128i iy = Noise_Floor_SSE2(vy);
+		const __m128i ix1 = _mm_add_epi32(ix, one);
+		const __m128i iy1 = _mm_add_epi32(iy, one);
+		const __m128 u = Noise_Fade_SSE2(_mm_sub_ps(vx, _mm_cvtepi32_ps(ix)));
+		const __m128 v = Noise_Fade_SSE2(_mm_sub_ps(vy, _mm_cvtepi32_ps(iy)));
+
+		const __m128 bottom = Noise_Lerp_SSE2(Noise_HashToFloat_SSE2(Noise_Hash2_SSE2(ix, iy, seedV)), Noise_HashToFloat_SSE2(Noise_Hash2_SSE2(ix1, iy, seedV)), u);
+		const __m128 top = Noise_Lerp_SSE2(Noise_HashToFloat_SSE2(Noise_Hash2_SSE2(ix, iy1, seedV)), Noise_HashToFloat_SSE2(Noise_Hash2_SSE2(ix1, iy1, seedV)), u);
+		_mm_storeu_ps(dst + i, Noise_Lerp_SSE2(bottom, top, v));
+	}
+	return i;
+}
+
+//--------------------------
+// Noise_Value3D_SSE2
+// same lattice, fade, and lerp order as eoeNoise::Value3D
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Noise_Value3D_SSE2(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) {
+	const __m128i seedV = _mm_set1_epi32((int)seed);
+	const __m128i one = _mm_set1_epi32(1);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 vx = _mm_loadu_ps(x + i);
+		const __m128 vy = _mm_loadu_ps(y + i);
+		const __m128 vz = _mm_loadu_ps(z + i);
+		const __m128i ix = Noise_Floor_SSE2(vx);
+		const __m128i iy = Noise_Floor_SSE2(vy);
+		const __m128i iz = Noise_Floor_SSE2(vz);
+		const __m128i ix1 = _mm_add_epi32(ix, one);
+		const __m128i iy1 = _mm_add_epi32(iy, one);
+		const __m128i iz1 = _mm_add_epi32(iz, one);
+		const __m128 u = Noise_Fade_SSE2(_mm_sub_ps(vx, _mm_cvtepi32_ps(ix)));
+		const __m128 v = Noise_Fade_SSE2(_mm_sub_ps(vy, _mm_cvtepi32_ps(iy)));
+		const __m128 w = Noise_Fade_SSE2(_mm_sub_ps(vz, _mm_cvtepi32_ps(iz)));
+
+		const __m128 nearBottom = Noise_Lerp_SSE2(Noise_HashToFloat_SSE2(Noise_Hash3_SSE2(ix, iy, iz, seedV)), Noise_HashToFloat_SSE2(Noise_Hash3_SSE2(ix1, iy, iz, seedV)), u);
+		const __m128 nearTop = Noise_Lerp_SSE2(Noise_HashToFloat_SSE2(Noise_Hash3_SSE2(ix, iy1, iz, seedV)), Noise_HashToFloat_SSE2(Noise_Hash3_SSE2(ix1, iy1, iz, seedV)), u);
+		const __m128 farBottom = Noise_Lerp_SSE2(Noise_HashToFloat_SSE2(Noise_Hash3_SSE2(ix, iy, iz1, seedV)), Noise_HashToFloat_SSE2(Noise_Hash3_SSE2(ix1, iy, iz1, seedV)), u);
+		const __m128 farTop = Noise_Lerp_SSE2(Noise_HashToFloat_SSE2(Noise_Hash3_SSE2(ix, iy1, iz1, seedV)), Noise_HashToFloat_SSE2(Noise_Hash3_SSE2(ix1, iy1, iz1, seedV)), u);
+		_mm_storeu_ps(dst + i, Noise_Lerp_SSE2(Noise_Lerp_SSE2(nearBottom, nearTop, v), Noise_Lerp_SSE2(farBottom, farTop, v), w));
+	}
+	return i;
+}
+
+//--------------------------
+// Noise_Simplex2D_SSE2
+// same skew, corner order, and sums as eoeNoise::Simplex2D
+// the corner offsets come from all-ones masks, so i + i1 is i - mask
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Noise_Simplex2D_SSE2(float * dst, const float * x, const float * y, const int count, const uint32_t seed) {
+	const __m128i seedV = _mm_set1_epi32((int)seed);
+	const __m128i oneInt = _mm_set1_epi32(1);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 unskew1 = _mm_set1_ps(eoeNoise::UNSKEW_2D);
+	const __m128 unskew2 = _mm_set1_ps(eoeNoise::UNSKEW_2D_2);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 vx = _mm_loadu_ps(x + i);
+		const __m128 vy = _mm_loadu_ps(y + i);
+		const __m128 skew = _mm_mul_ps(_mm_add_ps(vx, vy), _mm_set1_ps(eoeNoise::SKEW_2D));
+		const __m128i ci = Noise_Floor_SSE2(_mm_add_ps(vx, skew));
+		const __m128i cj = Noise_Floor_SSE2(_mm_add_ps(vy, skew));
+		const __m128 unskew = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(ci, cj)), unskew1);
+		const __m128 x0 = _mm_sub_ps(vx, _mm_sub_ps(_mm_cvtepi32_ps(ci), unskew));
+		const __m128 y0 = _mm_sub_ps(vy, _mm_sub_ps(_mm_cvtepi32_ps(cj), unskew));
+
+		const __m128 lower = _mm_cmpgt_ps(x0, y0);
+		const __m128i lowerInt = _mm_castps_si128(lower);
+		const __m128 x1 = _mm_add_ps(_mm_sub_ps(x0, _mm_and_ps(lower, one)), unskew1);
+		const __m128 y1 = _mm_add_ps(_mm_sub_ps(y0, _mm_andnot_ps(lower, one)), unskew1);
+		const __m128 x2 = _mm_add_ps(_mm_sub_ps(x0, one), unskew2);
+		const __m128 y2 = _mm_add_ps(_mm_sub_ps(y0, one), unskew2);
+
+		const __m128i ci1 = _mm_add_epi32(ci, oneInt);
+		const __m128i cj1 = _mm_add_epi32(cj, oneInt);
+		const __m128 n0 = _mm_mul_ps(Noise_Falloff2_SSE2(x0, y0), Noise_Gradient2_SSE2(Noise_Hash2_SSE2(ci, cj, seedV), x0, y0));
+		const __m128 n1 = _mm_mul_ps(Noise_Falloff2_SSE2(x1, y1), Noise_Gradient2_SSE2(Noise_Hash2_SSE2(_mm_sub_epi32(ci, lowerInt), _mm_add_epi32(cj1, lowerInt), seedV), x1, y1));
+		const __m128 n2 = _mm_mul_ps(Noise_Falloff2_SSE2(x2, y2), Noise_Gradient2_SSE2(Noise_Hash2_SSE2(ci1, cj1, seedV), x2, y2));
+		_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_add_ps(_mm_add_ps(n0, n1), n2), _mm_set1_ps(eoeNoise::SCALE_2D)));
+	}
+	return i;
+}
+
+//--------------------------
+// Noise_Simplex3D_SSE2
+// same skew, corner order, and sums as eoeNoise::Simplex3D
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Noise_Simplex3D_SSE2(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) {
+	const __m128i seedV = _mm_set1_epi32((int)seed);
+	const __m128i oneInt = _mm_set1_epi32(1);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 allOnes = _mm_castsi128_ps(_mm_set1_epi32(-1));
+	const __m128 unskew1 = _mm_set1_ps(eoeNoise::UNSKEW_3D);
+	const __m128 unskew2 = _mm_set1_ps(eoeNoise::UNSKEW_3D_2);
+	const __m128 unskew3 = _mm_set1_ps(eoeNoise::UNSKEW_3D_3);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const __m128 vx = _mm_loadu_ps(x + i);
+		const __m128 vy = _mm_loadu_ps(y + i);
+		const __m128 vz = _mm_loadu_ps(z + i);
+		const __m128 skew = _mm_mul_ps(_mm_add_ps(_mm_add_ps(vx, vy), vz), _mm_set1_ps(eoeNoise::SKEW_3D));
+		const __m128i ci = Noise_Floor_SSE2(_mm_add_ps(vx, skew));
+		const __m128i cj = Noise_Floor_SSE2(_mm_add_ps(vy, skew));
+		const __m128i ck = Noise_Floor_SSE2(_mm_add_ps(vz, skew));
+		const __m128 unskew = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(_mm_add_epi32(ci, cj), ck)), unskew1);
+		const __m128 x0 = _mm_sub_ps(vx, _mm_sub_ps(_mm_cvtepi32_ps(ci), unskew));
+		const __m128 y0 = _mm_sub_ps(vy, _mm_sub_ps(_mm_cvtepi32_ps(cj), unskew));
+		const __m128 z0 = _mm_sub_ps(vz, _mm_sub_ps(_mm_cvtepi32_ps(ck), unskew));
+
+		const __m128 xy = _mm_cmpge_ps(x0, y0);
+		const __m128 xz = _mm_cmpge_ps(x0, z0);
+		const __m128 yz = _mm_cmpge_ps(y0, z0);
+		const __m128 i1 = _mm_and_ps(xy, xz);
+		const __m128 j1 = _mm_andnot_ps(xy, yz);
+		const __m128 k1 = _mm_andnot_ps(_mm_or_ps(xz, yz), allOnes);
+		const __m128 i2 = _mm_or_ps(xy, xz);
+		const __m128 j2 = _mm_or_ps(_mm_andnot_ps(xy, allOnes), yz);
+		const __m128 k2 = _mm_andnot_ps(_mm_and_ps(xz, yz), allOnes);
+
+		const __m128 x1 = _mm_add_ps(_mm_sub_ps(x0, _mm_and_ps(i1, one)), unskew1);
+		const __m128 y1 = _mm_add_ps(_mm_sub_ps(y0, _mm_and_ps(j1, one)), unskew1);
+		const __m128 z1 = _mm_add_ps(_mm_sub_ps(z0, _mm_and_ps(k1, one)), unskew1);
+		const __m128 x2 = _mm_add_ps(_mm_sub_ps(x0, _mm_and_ps(i2, one)), unskew2);
+		const __m128 y2 = _mm_add_ps(_mm_sub_ps(y0, _mm_and_ps(j2, one)), unskew2);
+		const __m128 z2 = _mm_add_ps(_mm_sub_ps(z0, _mm_and_ps(k2, one)), unskew2);
+		const __m128 x3 = _mm_add_ps(_mm_sub_ps(x0, one), unskew3);
+		const __m128 y3 = _mm_add_ps(_mm_sub_ps(y0, one), unskew3);
+		const __m128 z3 = _mm_add_ps(_mm_sub_ps(z0, one), unskew3);
+
+		const __m128i hash0 = Noise_Hash3_SSE2(ci, cj, ck, seedV);
+		const __m128i hash1 = Noise_Hash3_SSE2(_mm_sub_epi32(ci, _mm_castps_si128(i1)), _mm_sub_epi32(cj, _mm_castps_si128(j1)), _mm_sub_epi32(ck, _mm_castps_si128(k1)), seedV);
+		const __m128i hash2 = Noise_Hash3_SSE2(_mm_sub_epi32(ci, _mm_castps_si128(i2)), _mm_sub_epi32(cj, _mm_castps_si128(j2)), _mm_sub_epi32(ck, _mm_castps_si128(k2)), seedV);
+		const __m128i hash3 = Noise_Hash3_SSE2(_mm_add_epi32(ci, oneInt), _mm_add_epi32(cj, oneInt), _mm_add_epi32(ck, oneInt), seedV);
+		const __m128 n0 = _mm_mul_ps(Noise_Falloff3_SSE2(x0, y0, z0), Noise_Gradient3_SSE2(hash0, x0, y0, z0));
+		const __m128 n1 = _mm_mul_ps(Noise_Falloff3_SSE2(x1, y1, z1), Noise_Gradient3_SSE2(hash1, x1, y1, z1));
+		const __m128 n2 = _mm_mul_ps(Noise_Falloff3_SSE2(x2, y2, z2), Noise_Gradient3_SSE2(hash2, x2, y2, z2));
+		const __m128 n3 = _mm_mul_ps(Noise_Falloff3_SSE2(x3, y3, z3), Noise_Gradient3_SSE2(hash3, x3, y3, z3));
+		_mm_storeu_ps(dst + i, _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(n0, n1), n2), n3), _mm_set1_ps(eoeNoise::SCALE_3D)));
+	}
+	return i;
+}
+
+//--------------------------
+// SpreadFractions_SSE2
+// repeats each of the four fractions in t numComponents times, in element order,
+// so spread[r] lines up with the r-th register of four packed numComponents-vectors
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline void SpreadFractions_SSE2(const __m128 t, const int numComponents, __m128 * spread) {
+	switch (numComponents) {
+		case 1:
+			spread[0] = t;
+			break;
+		case 2:
+			spread[0] = _mm_unpacklo_ps(t, t);
+			spread[1] = _mm_unpackhi_ps(t, t);
+			break;
+		case 3:
+			spread[0] = _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 0, 0));
+			spread[1] = _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 1, 1));
+			spread[2] = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 3, 2));
+			break;
+		default:
+			spread[0] = _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0));
+			spread[1] = _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1));
+			spread[2] = _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2));
+			spread[3] = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 3, 3));
+			break;
+	}
+}
+
+//--------------------------
+// Float_Lerp_SSE2
+// same operation order as eoeMath::Lerp
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_Lerp_SSE2(float * dst, const float * from, const float * to, const float * fractions, const int numComponents, const int count) {
+	__m128 spread[4];
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		SpreadFractions_SSE2(_mm_loadu_ps(fractions + i), numComponents, spread);
+		const int offset = i * numComponents;
+		for (int r = 0; r < numComponents; ++r) {
+			const __m128 a = _mm_loadu_ps(from + offset + r * 4);
+			const __m128 b = _mm_loadu_ps(to + offset + r * 4);
+			_mm_storeu_ps(dst + offset + r * 4, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), spread[r])));
+		}
+	}
+	return i;
+}
+
+//--------------------------
+// Ease_SSE2
+// same clamp, curves, and operation order as eoeMath::Ease,
+// the in-out curves evaluate both halves and select
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline __m128 Ease_SSE2(const __m128 fraction, const eoeEase_t type) {
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 t = _mm_min_ps(_mm_max_ps(fraction, _mm_setzero_ps()), one);
+	const __m128 u = _mm_sub_ps(one, t);
+	const __m128 t2 = _mm_mul_ps(t, t);
+	const __m128 u2 = _mm_mul_ps(u, u);
+
+	switch (type) {
+		case EASE_SMOOTHSTEP:
+			return _mm_mul_ps(t2, _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_set1_ps(2.0f), t)));
+		case EASE_SMOOTHERSTEP: {
+			const __m128 inner = _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f));
+			return _mm_mul_ps(_mm_mul_ps(t2, t), _mm_add_ps(_mm_mul_ps(t, inner), _mm_set1_ps(10.0f)));
+		}
+		case EASE_IN_QUAD:
+			return t2;
+		case EASE_OUT_QUAD:
+			return _mm_sub_ps(one, u2);
+		case EASE_IN_OUT_QUAD: {
+			const __m128 in = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(2.0f), t), t);
+			const __m128 out = _mm_sub_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(2.0f), u), u));
+			return Select_SSE2(_mm_cmplt_ps(t, _mm_set1_ps(0.5f)), in, out);
+		}
+		case EASE_IN_CUBIC:
+			return _mm_mul_ps(t2, t);
+		case EASE_OUT_CUBIC:
+			return _mm_sub_ps(one, _mm_mul_ps(u2, u));
+		case EASE_IN_OUT_CUBIC: {
+			const __m128 in = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.0f), t), t), t);
+			const __m128 out = _mm_sub_ps(one, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(4.0f), u), u), u));
+			return Select_SSE2(_mm_cmplt_ps(t, _mm_set1_ps(0.5f)), in, out);
+		}
+		case EASE_IN_BACK:
+			return _mm_mul_ps(t2, _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(eoeMath::BACK_C3), t), _mm_set1_ps(eoeMath::BACK_C1)));
+		case EASE_OUT_BACK:
+			return _mm_sub_ps(one, _mm_mul_ps(u2, _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(eoeMath::BACK_C3), u), _mm_set1_ps(eoeMath::BACK_C1))));
+		default:
+			return t;
+	}
+}
+
+//--------------------------
+// Float_Ease_SSE2
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Float_Ease_SSE2(float * dst, const float * fractions, const int count, const eoeEase_t type) {
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(dst + i, Ease_SSE2(_mm_loadu_ps(fractions + i), type));
+	return i;
+}
+
+//--------------------------
+// QuatNormalize_SSE2
+// same as eoeQuat::Normalize on four transposed quaternions
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static inline void QuatNormalize_SSE2(__m128 & x, __m128 & y, __m128 & z, __m128 & w) {
+	const __m128 sqrLength = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(w, w));
+	const __m128 invLength = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(sqrLength)), _mm_cmpneq_ps(sqrLength, _mm_setzero_ps()));
+	x = _mm_mul_ps(x, invLength);
+	y = _mm_mul_ps(y, invLength);
+	z = _mm_mul_ps(z, invLength);
+	w = _mm_mul_ps(w, invLength);
+}
+
+//--------------------------
+// Quat_Nlerp_SSE2
+// same operation order as eoeQuat::Nlerp, four quaternions transposed at a time
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Quat_Nlerp_SSE2(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) {
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 ax = _mm_load_ps(&from[i].x);
+		__m128 ay = _mm_load_ps(&from[i + 1].x);
+		__m128 az = _mm_load_ps(&from[i + 2].x);
+		__m128 aw = _mm_load_ps(&from[i + 3].x);
+		__m128 bx = _mm_load_ps(&to[i].x);
+		__m128 by = _mm_load_ps(&to[i + 1].x);
+		__m128 bz = _mm_load_ps(&to[i + 2].x);
+		__m128 bw = _mm_load_ps(&to[i + 3].x);
+		_MM_TRANSPOSE4_PS(ax, ay, az, aw);
+		_MM_TRANSPOSE4_PS(bx, by, bz, bw);
+
+		const __m128 t = _mm_loadu_ps(fractions + i);
+		const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz)), _mm_mul_ps(aw, bw));
+		const __m128 fromScale = _mm_sub_ps(_mm_set1_ps(1.0f), t);
+		const __m128 toScale = _mm_xor_ps(t, _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), signMask));
+
+		__m128 x = _mm_add_ps(_mm_mul_ps(ax, fromScale), _mm_mul_ps(bx, toScale));
+		__m128 y = _mm_add_ps(_mm_mul_ps(ay, fromScale), _mm_mul_ps(by, toScale));
+		__m128 z = _mm_add_ps(_mm_mul_ps(az, fromScale), _mm_mul_ps(bz, toScale));
+		__m128 w = _mm_add_ps(_mm_mul_ps(aw, fromScale), _mm_mul_ps(bw, toScale));
+		QuatNormalize_SSE2(x, y, z, w);
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_store_ps(&dst[i].x, x);
+		_mm_store_ps(&dst[i + 1].x, y);
+		_mm_store_ps(&dst[i + 2].x, z);
+		_mm_store_ps(&dst[i + 3].x, w);
+	}
+	return i;
+}
+
+//--------------------------
+// Quat_SlerpFast_SSE2
+// same operation order as eoeQuat::SlerpFast, four quaternions transposed at a time
+//--------------------------
+EOE_SIMD_TARGET("sse2")
+static int Quat_SlerpFast_SSE2(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) {
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	const __m128 one = _mm_set1_ps(1.0f);
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128 ax = _mm_load_ps(&from[i].x);
+		__m128 ay = _mm_load_ps(&from[i + 1].x);
+		__m128 az = _mm_load_ps(&from[i + 2].x);
+		__m128 aw = _mm_load_ps(&from[i + 3].x);
+		__m128 bx = _mm_load_ps(&to[i].x);
+		__m128 by = _mm_load_ps(&to[i + 1].x);
+		__m128 bz = _mm_load_ps(&to[i + 2].x);
+		__m128 bw = _mm_load_ps(&to[i + 3].x);
+		_MM_TRANSPOSE4_PS(ax, ay, az, aw);
+		_MM_TRANSPOSE4_PS(bx, by, bz, bw);
+
+		const __m128 t = _mm_loadu_ps(fractions + i);
+		const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz)), _mm_mul_ps(aw, bw));
+		const __m128 cosOmega = _mm_andnot_ps(signMask, dot);
+		const __m128 sinSquared = _mm_sub_ps(one, _mm_mul_ps(cosOmega, cosOmega));
+		const __m128 sinOmega = _mm_sqrt_ps(_mm_max_ps(sinSquared, _mm_setzero_ps()));
+		const __m128 omega = ATan2Fast_SSE2(sinOmega, cosOmega);
+		const __m128 invSinOmega = _mm_div_ps(one, sinOmega);
+
+		__m128 sinFrom;
+		__m128 sinTo;
+		__m128 cos;
+		SinCosFast_SSE2(_mm_mul_ps(_mm_sub_ps(one, t), omega), sinFrom, cos);
+		SinCosFast_SSE2(_mm_mul_ps(t, omega), sinTo, cos);
+
+		const __m128 nearlyEqual = _mm_cmpgt_ps(cosOmega, _mm_set1_ps(0.9995f));
+		const __m128 fromScale = Select_SSE2(nearlyEqual, _mm_sub_ps(one, t), _mm_mul_ps(sinFrom, invSinOmega));
+		__m128 toScale = Select_SSE2(nearlyEqual, t, _mm_mul_ps(sinTo, invSinOmega));
+		toScale = _mm_xor_ps(toScale, _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), signMask));
+
+		__m128 x = _mm_add_ps(_mm_mul_ps(ax, fromScale), _mm_mul_ps(bx, toScale));
+		__m128 y = _mm_add_ps(_mm_mul_ps(ay, fromScale), _mm_mul_ps(by, toScale));
+		__m128 z = _mm_add_ps(_mm_mul_ps(az, fromScale), _mm_mul_ps(bz, toScale));
+		__m128 w = _mm_add_ps(_mm_mul_ps(aw, fromScale), _mm_mul_ps(bw, toScale));
+		QuatNormalize_SSE2(x, y, z, w);
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+		_mm_store_ps(&dst[i].x, x);
+		_mm_store_ps(&dst[i + 1].x, y);
+		_mm_store_ps(&dst[i + 2].x, z);
+		_mm_store_ps(&dst[i + 3].x, w);
+	}
+	return i;
+}
+
+//--------------------------
+// eoeSIMD_SSE2::GetName
+//--------------------------
+const char * eoeSIMD_SSE2::GetName() const {
+	return "SSE2";
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_MultiplyMat4
+// dst = a * b
+// dst may alias a or b
+//--------------------------
+void eoeSIMD_SSE2::Mat4_MultiplyMat4(eoeMat4 & dst, const eoeMat4 & a, const eoeMat4 & b) const {
+	Mat4_MultiplyMat4_SSE2(reinterpret_cast<float *>(&dst), reinterpret_cast<const float *>(&a), reinterpret_cast<const float *>(&b));
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_MultiplyVec4
+// dst = m * v, column-vector matrix multiplication
+// dst may alias v
+//--------------------------
+void eoeSIMD_SSE2::Mat4_MultiplyVec4(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const {
+	Mat4_MultiplyVec4_SSE2(reinterpret_cast<float *>(&dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(&v));
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_MultiplyVec4Transposed
+//--------------------------
+void eoeSIMD_SSE2::Mat4_MultiplyVec4Transposed(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const {
+	Mat4_MultiplyVec4Transposed_SSE2(reinterpret_cast<float *>(&dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(&v));
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_MultiplyMat4sColumnMajor
+//--------------------------
+void eoeSIMD_SSE2::Mat4_MultiplyMat4sColumnMajor(float * dst, const eoeMat4 & a, const eoeMat4 * b, const int count) const {
+	Mat4_MultiplyMat4sColumnMajor_SSE2(dst, reinterpret_cast<const float *>(&a), reinterpret_cast<const float *>(b), count);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_Transpose
+// dst = transpose of src
+// dst may alias src
+//--------------------------
+void eoeSIMD_SSE2::Mat4_Transpose(eoeMat4 & dst, const eoeMat4 & src) const {
+	Mat4_Transpose_SSE2(reinterpret_cast<float *>(&dst), reinterpret_cast<const float *>(&src));
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_Inverse
+// dst = inverse of src
+// returns false and leaves dst untouched if src is singular
+// dst may alias src
+//--------------------------
+bool eoeSIMD_SSE2::Mat4_Inverse(eoeMat4 & dst, const eoeMat4 & src) const {
+	return Mat4_Inverse_SSE2(reinterpret_cast<float *>(&dst), reinterpret_cast<const float *>(&src));
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_AffineInverse
+// dst = inverse of a translation * rotation * scale matrix
+// returns false and leaves dst untouched if any scale is zero
+// dst may alias src
+//--------------------------
+bool eoeSIMD_SSE2::Mat4_AffineInverse(eoeMat4 & dst, const eoeMat4 & src) const {
+	return Mat4_AffineInverse_SSE2(reinterpret_cast<float *>(&dst), reinterpret_cast<const float *>(&src));
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_TransformVec4
+// dst[i] = m * src[i]
+// dst may alias src
+//--------------------------
+void eoeSIMD_SSE2::Mat4_TransformVec4(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const {
+	Mat4_TransformVec4_SSE2<TRANSFORM_FULL>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_TransformVec4Directions
+// dst[i] = m * (src[i].xyz, 0)
+// dst may alias src
+//--------------------------
+void eoeSIMD_SSE2::Mat4_TransformVec4Directions(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const {
+	Mat4_TransformVec4_SSE2<TRANSFORM_DIRECTION>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_TransformVec4Projective
+// dst[i] = m * src[i], then divided through by its w (which becomes 1)
+// dst may alias src
+// DEBUG: allows divide by zero errors to occur
+//--------------------------
+void eoeSIMD_SSE2::Mat4_TransformVec4Projective(eoeVec4 * dst, const eoeMat4 & m, const eoeVec4 * src, const int count) const {
+	Mat4_TransformVec4_SSE2<TRANSFORM_PROJECTIVE>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_TransformVec3Points
+// dst[i] = (m * (src[i], 1)).xyz
+// dst may alias src
+//--------------------------
+void eoeSIMD_SSE2::Mat4_TransformVec3Points(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const {
+	const int done = Mat4_TransformVec3_SSE2<TRANSFORM_FULL>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_Generic::Mat4_TransformVec3Points(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_TransformVec3Directions
+// dst[i] = (m * (src[i], 0)).xyz
+// dst may alias src
+//--------------------------
+void eoeSIMD_SSE2::Mat4_TransformVec3Directions(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const {
+	const int done = Mat4_TransformVec3_SSE2<TRANSFORM_DIRECTION>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_Generic::Mat4_TransformVec3Directions(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat4_TransformVec3Projective
+// dst[i] = (m * (src[i], 1)).xyz divided through by the resulting w
+// dst may alias src
+// DEBUG: allows divide by zero errors to occur
+//--------------------------
+void eoeSIMD_SSE2::Mat4_TransformVec3Projective(eoeVec3 * dst, const eoeMat4 & m, const eoeVec3 * src, const int count) const {
+	const int done = Mat4_TransformVec3_SSE2<TRANSFORM_PROJECTIVE>(reinterpret_cast<float *>(dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_Generic::Mat4_TransformVec3Projective(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Mat3x2_TransformVec2
+// dst[i] = m * src[i]
+// dst may alias src
+//--------------------------
+void eoeSIMD_SSE2::Mat3x2_TransformVec2(eoeVec2 * dst, const eoeMat3x2 & m, const eoeVec2 * src, const int count) const {
+	const int done = Mat3x2_TransformVec2_SSE2(reinterpret_cast<float *>(dst), m.ToFloatPtr(), reinterpret_cast<const float *>(src), count);
+	eoeSIMD_Generic::Mat3x2_TransformVec2(dst + done, m, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_Add
+// dst[i] = a[i] + b[i]
+//--------------------------
+void eoeSIMD_SSE2::Float_Add(float * dst, const float * a, const float * b, const int count) const {
+	const int done = Float_Add_SSE2(dst, a, b, count);
+	eoeSIMD_Generic::Float_Add(dst + done, a + done, b + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_Scale
+// dst[i] = a[i] * scale
+//--------------------------
+void eoeSIMD_SSE2::Float_Scale(float * dst, const float * a, const float scale, const int count) const {
+	const int done = Float_Scale_SSE2(dst, a, scale, count);
+	eoeSIMD_Generic::Float_Scale(dst + done, a + done, scale, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_MultiplyAdd
+// dst[i] = a[i] + b[i] * scale
+//--------------------------
+void eoeSIMD_SSE2::Float_MultiplyAdd(float * dst, const float * a, const float * b, const float scale, const int count) const {
+	const int done = Float_MultiplyAdd_SSE2(dst, a, b, scale, count);
+	eoeSIMD_Generic::Float_MultiplyAdd(dst + done, a + done, b + done, scale, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_SnapInt
+// moves each value to the nearest integer value, same as eoeVec3::SnapInt
+//--------------------------
+void eoeSIMD_SSE2::Float_SnapInt(float * dst, const float * src, const int count) const {
+	const int done = Float_SnapInt_SSE2(dst, src, count);
+	eoeSIMD_Generic::Float_SnapInt(dst + done, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_SinCosFast
+// sin[i], cos[i] = eoeMath::SinCosFast(radians[i])
+//--------------------------
+void eoeSIMD_SSE2::Float_SinCosFast(float * sin, float * cos, const float * radians, const int count) const {
+	const int done = Float_SinCosFast_SSE2(sin, cos, radians, count);
+	eoeSIMD_Generic::Float_SinCosFast(sin + done, cos + done, radians + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_RSqrtFast
+// dst[i] = eoeMath::RSqrtFast(src[i])
+//--------------------------
+void eoeSIMD_SSE2::Float_RSqrtFast(float * dst, const float * src, const int count) const {
+	const int done = Float_RSqrtFast_SSE2(dst, src, count);
+	eoeSIMD_Generic::Float_RSqrtFast(dst + done, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_ATan2Fast
+// dst[i] = eoeMath::ATan2Fast(y[i], x[i])
+//--------------------------
+void eoeSIMD_SSE2::Float_ATan2Fast(float * dst, const float * y, const float * x, const int count) const {
+	const int done = Float_ATan2Fast_SSE2(dst, y, x, count);
+	eoeSIMD_Generic::Float_ATan2Fast(dst + done, y + done, x + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_IsometricToOrthographic
+// x[i], y[i] = eoeMath::IsometricToOrthographic(x[i], y[i])
+//--------------------------
+void eoeSIMD_SSE2::Float_IsometricToOrthographic(float * x, float * y, const int count) const {
+	const int done = Float_IsometricToOrthographic_SSE2(x, y, count);
+	eoeSIMD_Generic::Float_IsometricToOrthographic(x + done, y + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_OrthographicToIsometric
+// x[i], y[i] = eoeMath::OrthographicToIsometric(x[i], y[i])
+//--------------------------
+void eoeSIMD_SSE2::Float_OrthographicToIsometric(float * x, float * y, const int count) const {
+	const int done = Float_OrthographicToIsometric_SSE2(x, y, count);
+	eoeSIMD_Generic::Float_OrthographicToIsometric(x + done, y + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Int_IsometricToOrthographic
+// x[i], y[i] = eoeMath::IsometricToOrthographic(x[i], y[i])
+//--------------------------
+void eoeSIMD_SSE2::Int_IsometricToOrthographic(int * x, int * y, const int count) const {
+	const int done = Int_IsometricToOrthographic_SSE2(x, y, count);
+	eoeSIMD_Generic::Int_IsometricToOrthographic(x + done, y + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Int_OrthographicToIsometric
+// x[i], y[i] = eoeMath::OrthographicToIsometric(x[i], y[i])
+//--------------------------
+void eoeSIMD_SSE2::Int_OrthographicToIsometric(int * x, int * y, const int count) const {
+	const int done = Int_OrthographicToIsometric_SSE2(x, y, count);
+	eoeSIMD_Generic::Int_OrthographicToIsometric(x + done, y + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::SoA_Dot
+// dst[i] = dot product of the i-th vectors of a and b
+//--------------------------
+void eoeSIMD_SSE2::SoA_Dot(float * dst, const float * const * a, const float * const * b, const int numComponents, const int count) const {
+	const float * aRest[EOE_SOA_MAX_COMPONENTS];
+	const float * bRest[EOE_SOA_MAX_COMPONENTS];
+	const int done = SoA_Dot_SSE2(dst, a, b, numComponents, count);
+	SoA_Offset(aRest, a, numComponents, done);
+	SoA_Offset(bRest, b, numComponents, done);
+	eoeSIMD_Generic::SoA_Dot(dst + done, aRest, bRest, numComponents, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::SoA_Length
+// dst[i] = length of the i-th vector of a
+//--------------------------
+void eoeSIMD_SSE2::SoA_Length(float * dst, const float * const * a, const int numComponents, const int count) const {
+	const float * aRest[EOE_SOA_MAX_COMPONENTS];
+	const int done = SoA_Length_SSE2(dst, a, numComponents, count);
+	SoA_Offset(aRest, a, numComponents, done);
+	eoeSIMD_Generic::SoA_Length(dst + done, aRest, numComponents, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::SoA_Normalize
+// scales each vector of a to unit length, same as eoeVec3::Normalize
+//--------------------------
+void eoeSIMD_SSE2::SoA_Normalize(float * const * a, const int numComponents, const int count) const {
+	float * aRest[EOE_SOA_MAX_COMPONENTS];
+	const int done = SoA_Normalize_SSE2(a, numComponents, count);
+	SoA_Offset(aRest, a, numComponents, done);
+	eoeSIMD_Generic::SoA_Normalize(aRest, numComponents, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::SoA_Cross
+// dst[i] = a[i] X b[i] for three component arrays
+// dst may alias a or b
+//--------------------------
+void eoeSIMD_SSE2::SoA_Cross(float * const * dst, const float * const * a, const float * const * b, const int count) const {
+	float * dstRest[3];
+	const float * aRest[3];
+	const float * bRest[3];
+	const int done = SoA_Cross_SSE2(dst, a, b, count);
+	SoA_Offset(dstRest, dst, 3, done);
+	SoA_Offset(aRest, a, 3, done);
+	SoA_Offset(bRest, b, 3, done);
+	eoeSIMD_Generic::SoA_Cross(dstRest, aRest, bRest, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::SoA_FromVec3
+// splits packed eoeVec3s into dst[0] (x), dst[1] (y), and dst[2] (z)
+//--------------------------
+void eoeSIMD_SSE2::SoA_FromVec3(float * const * dst, const eoeVec3 * src, const int count) const {
+	float * dstRest[3];
+	const int done = SoA_FromVec3_SSE2(dst, reinterpret_cast<const float *>(src), count);
+	SoA_Offset(dstRest, dst, 3, done);
+	eoeSIMD_Generic::SoA_FromVec3(dstRest, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::SoA_FromVec4
+// splits packed eoeVec4s into dst[0] (x), dst[1] (y), dst[2] (z), and dst[3] (w)
+//--------------------------
+void eoeSIMD_SSE2::SoA_FromVec4(float * const * dst, const eoeVec4 * src, const int count) const {
+	float * dstRest[4];
+	const int done = SoA_FromVec4_SSE2(dst, reinterpret_cast<const float *>(src), count);
+	SoA_Offset(dstRest, dst, 4, done);
+	eoeSIMD_Generic::SoA_FromVec4(dstRest, src + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::SoA_ToVec3
+// packs src[0] (x), src[1] (y), and src[2] (z) into eoeVec3s
+//--------------------------
+void eoeSIMD_SSE2::SoA_ToVec3(eoeVec3 * dst, const float * const * src, const int count) const {
+	const float * srcRest[3];
+	const int done = SoA_ToVec3_SSE2(reinterpret_cast<float *>(dst), src, count);
+	SoA_Offset(srcRest, src, 3, done);
+	eoeSIMD_Generic::SoA_ToVec3(dst + done, srcRest, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::SoA_ToVec4
+// packs src[0] (x), src[1] (y), src[2] (z), and src[3] (w) into eoeVec4s
+//--------------------------
+void eoeSIMD_SSE2::SoA_ToVec4(eoeVec4 * dst, const float * const * src, const int count) const {
+	const float * srcRest[4];
+	const int done = SoA_ToVec4_SSE2(reinterpret_cast<float *>(dst), src, count);
+	SoA_Offset(srcRest, src, 4, done);
+	eoeSIMD_Generic::SoA_ToVec4(dst + done, srcRest, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Cull_AABBs
+// writes i for every bounds[i] that no plane has entirely on its
+// negative side, see eoeAABB::IsOutside, returns the number written
+//--------------------------
+int eoeSIMD_SSE2::Cull_AABBs(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeAABB * bounds, const int count) const {
+	int numVisible;
+	const int done = Cull_AABBs_SSE2(visibleIndexes, numVisible, planes, numPlanes, bounds, count);
+	const int numRest = eoeSIMD_Generic::Cull_AABBs(visibleIndexes + numVisible, planes, numPlanes, bounds + done, count - done);
+	for (int i = numVisible; i < numVisible + numRest; ++i)
+		visibleIndexes[i] += done;
+	return numVisible + numRest;
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Cull_Spheres
+// writes i for every spheres[i] that no plane has entirely on its
+// negative side, see eoeSphere::IsOutside, returns the number written
+//--------------------------
+int eoeSIMD_SSE2::Cull_Spheres(int * visibleIndexes, const eoePlane * planes, const int numPlanes, const eoeSphere * spheres, const int count) const {
+	int numVisible;
+	const int done = Cull_Spheres_SSE2(visibleIndexes, numVisible, planes, numPlanes, spheres, count);
+	const int numRest = eoeSIMD_Generic::Cull_Spheres(visibleIndexes + numVisible, planes, numPlanes, spheres + done, count - done);
+	for (int i = numVisible; i < numVisible + numRest; ++i)
+		visibleIndexes[i] += done;
+	return numVisible + numRest;
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Random_FillUInts
+// dst[i] = raw output of lane i % EOE_RANDOM_LANES
+//--------------------------
+void eoeSIMD_SSE2::Random_FillUInts(uint32_t * state, uint32_t * dst, const int count) const {
+	const int done = Random_FillUInts_SSE2(state, dst, count);
+	eoeSIMD_Generic::Random_FillUInts(state, dst + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Random_FillFloats
+// dst[i] = eoeRandom::ToFloat(output, min, range)
+//--------------------------
+void eoeSIMD_SSE2::Random_FillFloats(uint32_t * state, float * dst, const int count, const float min, const float range) const {
+	const int done = Random_FillFloats_SSE2(state, dst, count, min, range);
+	eoeSIMD_Generic::Random_FillFloats(state, dst + done, count - done, min, range);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Random_FillInts
+// dst[i] = eoeRandom::ToInt(output, min, span)
+//--------------------------
+void eoeSIMD_SSE2::Random_FillInts(uint32_t * state, int * dst, const int count, const int min, const uint64_t span) const {
+	const int done = Random_FillInts_SSE2(state, dst, count, min, span);
+	eoeSIMD_Generic::Random_FillInts(state, dst + done, count - done, min, span);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Noise_Value2D
+// dst[i] = eoeNoise::Value2D(x[i], y[i], seed)
+//--------------------------
+void eoeSIMD_SSE2::Noise_Value2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const {
+	const int done = Noise_Value2D_SSE2(dst, x, y, count, seed);
+	eoeSIMD_Generic::Noise_Value2D(dst + done, x + done, y + done, count - done, seed);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Noise_Value3D
+// dst[i] = eoeNoise::Value3D(x[i], y[i], z[i], seed)
+//--------------------------
+void eoeSIMD_SSE2::Noise_Value3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const {
+	const int done = Noise_Value3D_SSE2(dst, x, y, z, count, seed);
+	eoeSIMD_Generic::Noise_Value3D(dst + done, x + done, y + done, z + done, count - done, seed);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Noise_Simplex2D
+// dst[i] = eoeNoise::Simplex2D(x[i], y[i], seed)
+//--------------------------
+void eoeSIMD_SSE2::Noise_Simplex2D(float * dst, const float * x, const float * y, const int count, const uint32_t seed) const {
+	const int done = Noise_Simplex2D_SSE2(dst, x, y, count, seed);
+	eoeSIMD_Generic::Noise_Simplex2D(dst + done, x + done, y + done, count - done, seed);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Noise_Simplex3D
+// dst[i] = eoeNoise::Simplex3D(x[i], y[i], z[i], seed)
+//--------------------------
+void eoeSIMD_SSE2::Noise_Simplex3D(float * dst, const float * x, const float * y, const float * z, const int count, const uint32_t seed) const {
+	const int done = Noise_Simplex3D_SSE2(dst, x, y, z, count, seed);
+	eoeSIMD_Generic::Noise_Simplex3D(dst + done, x + done, y + done, z + done, count - done, seed);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_Lerp
+// dst[i * numComponents + c] = eoeMath::Lerp(from[...], to[...], fractions[i])
+//--------------------------
+void eoeSIMD_SSE2::Float_Lerp(float * dst, const float * from, const float * to, const float * fractions, const int numComponents, const int count) const {
+	const int done = Float_Lerp_SSE2(dst, from, to, fractions, numComponents, count);
+	eoeSIMD_Generic::Float_Lerp(dst + done * numComponents, from + done * numComponents, to + done * numComponents, fractions + done, numComponents, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Float_Ease
+// dst[i] = eoeMath::Ease(type, fractions[i])
+//--------------------------
+void eoeSIMD_SSE2::Float_Ease(float * dst, const float * fractions, const int count, const eoeEase_t type) const {
+	const int done = Float_Ease_SSE2(dst, fractions, count, type);
+	eoeSIMD_Generic::Float_Ease(dst + done, fractions + done, count - done, type);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Quat_Nlerp
+// dst[i] = eoeQuat::Nlerp(from[i], to[i], fractions[i])
+//--------------------------
+void eoeSIMD_SSE2::Quat_Nlerp(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const {
+	const int done = Quat_Nlerp_SSE2(dst, from, to, fractions, count);
+	eoeSIMD_Generic::Quat_Nlerp(dst + done, from + done, to + done, fractions + done, count - done);
+}
+
+//--------------------------
+// eoeSIMD_SSE2::Quat_SlerpFast
+// dst[i] = eoeQuat::SlerpFast(from[i], to[i], fractions[i])
+//--------------------------
+void eoeSIMD_SSE2::Quat_SlerpFast(eoeQuat * dst, const eoeQuat * from, const eoeQuat * to, const float * fractions, const int count) const {
+	const int done = Quat_SlerpFast_SSE2(dst, from, to, fractions, count);
+	eoeSIMD_Generic::Quat_SlerpFast(dst + done, from + done, to + done, fractions + done, count - done);
+}
+
+#endif /* EOE_SIMD_X86 */
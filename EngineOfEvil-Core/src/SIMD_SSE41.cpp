@@ -0,0 +1,61 @@
+#include "SIMD_SSE41.h"
+
+#ifdef EOE_SIMD_X86
+
+#include <smmintrin.h>
+
+//--------------------------
+// Mat4_MultiplyVec4_SSE41
+// DPPS sums its products pairwise, (m0*x + m1*y) + (m2*z + m3*w),
+// instead of left-to-right, so each component may differ from the generic result by
+// at most 4 * FLT_EPSILON * ( |m0*x| + |m1*y| + |m2*z| + |m3*w| ), which is within 2 ULP
+// whenever the row's products share a sign (eg: every affine transform of a point)
+//--------------------------
+EOE_SIMD_TARGET("sse4.1")
+static void Mat4_MultiplyVec4_SSE41(float * dst, const float * m, const float * v) {
+	const __m128 vec = _mm_load_ps(v);
+	const __m128 x = _mm_dp_ps(_mm_load_ps(m + 0), vec, 0xF1);
+	const __m128 y = _mm_dp_ps(_mm_load_ps(m + 4), vec, 0xF2);
+	const __m128 z = _mm_dp_ps(_mm_load_ps(m + 8), vec, 0xF4);
+	const __m128 w = _mm_dp_ps(_mm_load_ps(m + 12), vec, 0xF8);
+	_mm_store_ps(dst, _mm_or_ps(_mm_or_ps(x, y), _mm_or_ps(z, w)));
+}
+
+//--------------------------
+// Float_SnapInt_SSE41
+//--------------------------
+EOE_SIMD_TARGET("sse4.1")
+static int Float_SnapInt_SSE41(float * dst, const float * src, const int count) {
+	const __m128 half = _mm_set1_ps(0.5f);
+	int i = 0;
+	for (; i + 4 <= count; i += 4)
+		_mm_storeu_ps(dst + i, _mm_floor_ps(_mm_add_ps(_mm_loadu_ps(src + i), half)));
+	return i;
+}
+
+//--------------------------
+// eoeSIMD_SSE41::GetName
+//--------------------------
+const char * eoeSIMD_SSE41::GetName() const {
+	return "SSE4.1";
+}
+
+//--------------------------
+// eoeSIMD_SSE41::Mat4_MultiplyVec4
+// dst = m * v, column-vector matrix multiplication
+// dst may alias v
+//--------------------------
+void eoeSIMD_SSE41::Mat4_MultiplyVec4(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const {
+	Mat4_MultiplyVec4_SSE41(reinterpret_cast<float *>(&dst), reinterpret_cast<const float *>(&m), reinterpret_cast<const float *>(&v));
+}
+
+//--------------------------
+// eoeSIMD_SSE41::Float_SnapInt
+// moves each value to the nearest integer value, same as eoeVec3::SnapInt
+//--------------------------
+void eoeSIMD_SSE41::Float_SnapInt(float * dst, const float * src, const int count) const {
+	const int done = Float_SnapInt_SSE41(dst, src, count);
+	eoeSIMD_SSE2::Float_SnapInt(dst + done, src + done, count - done);
+}
+
+#endif /* EOE_SIMD_X86 */
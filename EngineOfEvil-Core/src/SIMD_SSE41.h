@@ -0,0 +1,23 @@
+#ifndef EOECORE_SIMD_SSE41_H
+#define EOECORE_SIMD_SSE41_H
+
+#include "SIMD_SSE2.h"
+
+//--------------------------------------------
+//			eoeSIMD_SSE41
+// replaces the SSE2 transpose with DPPS dot products
+// see Mat4_MultiplyVec4 for its error bound
+//--------------------------------------------
+class eoeSIMD_SSE41 : public eoeSIMD_SSE2 {
+#ifdef EOE_SIMD_X86
+public:
+
+	virtual const char *			GetName() const override;
+
+	virtual void					Mat4_MultiplyVec4(eoeVec4 & dst, const eoeMat4 & m, const eoeVec4 & v) const override;
+
+	virtual void					Float_SnapInt(float * dst, const float * src, const int count) const override;
+#endif /* EOE_SIMD_X86 */
+};
+
+#endif /* EOECORE_SIMD_SSE41_H */
@@ -0,0 +1,214 @@
+#include "SpatialHash.h"
+
+//-------------------------
+// eoeSpatialHash::eoeSpatialHash
+// numBuckets is rounded up to a power of two, and doubles whenever
+// entities outnumber buckets two to one
+//-------------------------
+eoeSpatialHash::eoeSpatialHash(const float cellSize, const int numBuckets)
+	: cellSize(cellSize),
+	  invCellSize(1.0f / cellSize) {
+	int size = 1;
+	while (size < numBuckets)
+		size <<= 1;
+	Rehash(size);
+}
+
+//-------------------------
+// eoeSpatialHash::Add
+// returns the new entity's handle
+// extents are the entity's half-size on each axis, zero for a point
+//-------------------------
+int eoeSpatialHash::Add(const eoeVec2 & position, const eoeVec2 & extents) {
+	int entity;
+	if (freeEntities.empty()) {
+		entity = (int)entityBuckets.size();
+		entityBuckets.push_back(-1);
+		entitySlots.push_back(-1);
+	} else {
+		entity = freeEntities.back();
+		freeEntities.pop_back();
+	}
+
+	maxExtents = eoeVec2::Max(maxExtents, extents);
+	Insert(entry_t{ position, extents, GetCell(position), entity });
+	++numEntities;
+
+	if (numEntities > 2 * (int)buckets.size())
+		Rehash(2 * (int)buckets.size());
+	return entity;
+}
+
+//-------------------------
+// eoeSpatialHash::Remove
+// frees the entity's handle for reuse by a later Add
+// DEBUG: entity must be a live handle
+//-------------------------
+void eoeSpatialHash::Remove(const int entity) {
+	Erase(entity);
+	entityBuckets[entity] = -1;
+	freeEntities.push_back(entity);
+	--numEntities;
+}
+
+//-------------------------
+// eoeSpatialHash::Move
+// rehomes the entity only if position lands in a different cell
+//-------------------------
+void eoeSpatialHash::Move(const int entity, const eoeVec2 & position) {
+	entry_t & entry = buckets[entityBuckets[entity]][entitySlots[entity]];
+	const eoeVec2i cell = GetCell(position);
+	entry.position = position;
+	if (cell != entry.cell) {
+		const entry_t moved{ position, entry.extents, cell, entity };
+		Erase(entity);
+		Insert(moved);
+	}
+}
+
+//-------------------------
+// eoeSpatialHash::Move
+// moves entities[i] to positions[i], for count entities
+// DEBUG: each handle may appear only once
+//-------------------------
+void eoeSpatialHash::Move(const int * entities, const eoeVec2 * positions, const int count) {
+	for (int i = 0; i < count; ++i)
+		Move(entities[i], positions[i]);
+}
+
+//-------------------------
+// eoeSpatialHash::SetExtents
+// the entity stays in the cell holding its position,
+// larger extents widen every query until the next Clear
+//-------------------------
+void eoeSpatialHash::SetExtents(const int entity, const eoeVec2 & extents) {
+	buckets[entityBuckets[entity]][entitySlots[entity]].extents = extents;
+	maxExtents = eoeVec2::Max(maxExtents, extents);
+}
+
+//-------------------------
+// eoeSpatialHash::Clear
+// removes every entity, keeps the bucket table and all capacity
+//-------------------------
+void eoeSpatialHash::Clear() {
+	for (std::vector<entry_t> & bucket : buckets)
+		bucket.clear();
+	entityBuckets.clear();
+	entitySlots.clear();
+	freeEntities.clear();
+	maxExtents = vec2_zero;
+	numEntities = 0;
+}
+
+//-------------------------
+// eoeSpatialHash::QueryBounds
+// writes the handles of up to maxResults entities overlapping [mins, maxs] to results
+// returns the number written, without allocating
+//-------------------------
+int eoeSpatialHash::QueryBounds(int * results, const int maxResults, const eoeVec2 & mins, const eoeVec2 & maxs) const {
+	return Query(results, maxResults, mins, maxs, [&](const entry_t & entry) {
+		const eoeVec2 & position = entry.position;
+		const eoeVec2 & halfSize = entry.extents;
+		return position.x - halfSize.x <= maxs.x && position.x + halfSize.x >= mins.x &&
+			   position.y - halfSize.y <= maxs.y && position.y + halfSize.y >= mins.y;
+	});
+}
+
+//-------------------------
+// eoeSpatialHash::QueryRadius
+// writes the handles of up to maxResults entities overlapping the circle to results
+// returns the number written, without allocating
+//-------------------------
+int eoeSpatialHash::QueryRadius(int * results, const int maxResults, const eoeVec2 & center, const float radius) const {
+	const eoeVec2 radii(radius, radius);
+	const float radiusSquared = radius * radius;
+	return Query(results, maxResults, center - radii, center + radii, [&](const entry_t & entry) {
+		const eoeVec2 & position = entry.position;
+		const eoeVec2 & halfSize = entry.extents;
+		float dx = fabsf(center.x - position.x) - halfSize.x;
+		float dy = fabsf(center.y - position.y) - halfSize.y;
+		dx = dx > 0.0f ? dx : 0.0f;
+		dy = dy > 0.0f ? dy : 0.0f;
+		return dx * dx + dy * dy <= radiusSquared;
+	});
+}
+
+//-------------------------
+// eoeSpatialHash::Query
+// visits each cell that could hold an entity overlapping [mins, maxs] once,
+// skipping bucket-mates from other cells, so no entity is reported twice
+// ranges covering more cells than there are buckets scan every bucket once instead
+//-------------------------
+template<typename filter_t>
+int eoeSpatialHash::Query(int * results, const int maxResults, const eoeVec2 & mins, const eoeVec2 & maxs, const filter_t & overlaps) const {
+	const eoeVec2i minCell = GetCell(mins - maxExtents);
+	const eoeVec2i maxCell = GetCell(maxs + maxExtents);
+	const int64_t numCells = (int64_t)(maxCell.x - minCell.x + 1) * (maxCell.y - minCell.y + 1);
+	int numResults = 0;
+
+	if (numCells >= (int64_t)buckets.size()) {
+		for (const std::vector<entry_t> & bucket : buckets) {
+			for (const entry_t & entry : bucket) {
+				if (!overlaps(entry))
+					continue;
+
+				if (numResults == maxResults)
+					return numResults;
+				results[numResults++] = entry.entity;
+			}
+		}
+		return numResults;
+	}
+
+	for (int y = minCell.y; y <= maxCell.y; ++y) {
+		for (int x = minCell.x; x <= maxCell.x; ++x) {
+			const eoeVec2i cell(x, y);
+			for (const entry_t & entry : buckets[HashCell(cell)]) {
+				if (entry.cell != cell || !overlaps(entry))
+					continue;
+
+				if (numResults == maxResults)
+					return numResults;
+				results[numResults++] = entry.entity;
+			}
+		}
+	}
+	return numResults;
+}
+
+//-------------------------
+// eoeSpatialHash::Insert
+// appends the entry to its cell's bucket
+//-------------------------
+void eoeSpatialHash::Insert(const entry_t & entry) {
+	const int bucket = HashCell(entry.cell);
+	entityBuckets[entry.entity] = bucket;
+	entitySlots[entry.entity] = (int)buckets[bucket].size();
+	buckets[bucket].push_back(entry);
+}
+
+//-------------------------
+// eoeSpatialHash::Erase
+// removes the entity from its bucket by moving the bucket's last entry into its slot
+//-------------------------
+void eoeSpatialHash::Erase(const int entity) {
+	std::vector<entry_t> & bucket = buckets[entityBuckets[entity]];
+	const int slot = entitySlots[entity];
+	bucket[slot] = bucket.back();
+	entitySlots[bucket[slot].entity] = slot;
+	bucket.pop_back();
+}
+
+//-------------------------
+// eoeSpatialHash::Rehash
+// redistributes every entry over a table of numBuckets, a power of two
+//-------------------------
+void eoeSpatialHash::Rehash(const int numBuckets) {
+	std::vector<std::vector<entry_t>> old(numBuckets);
+	old.swap(buckets);
+	bucketMask = numBuckets - 1;
+	for (const std::vector<entry_t> & bucket : old) {
+		for (const entry_t & entry : bucket)
+			Insert(entry);
+	}
+}
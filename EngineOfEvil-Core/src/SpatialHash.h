@@ -0,0 +1,127 @@
+#ifndef EOECORE_SPATIAL_HASH_H
+#define EOECORE_SPATIAL_HASH_H
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+#include "Vector.h"
+
+//--------------------------------------------
+//
+//
+//			eoeSpatialHash
+//	  --uniform grid broadphase for 2D entities--
+//
+//
+// entities are boxes (position +/- extents) in world or tile units,
+// each is stored in the one cell holding its position, and cells are
+// hashed into a power-of-two bucket table so the world needs no bounds
+// each bucket keeps its entities packed in one array, so a query reads
+// a few contiguous runs instead of chasing a list per entity
+// Add, Move, and Remove are O(1), and Move only rehomes an entity
+// when its cell changes, so most per-frame moves are a compare and a store
+// queries pad their cell range by the largest extents ever added,
+// so keep entities no wider than a cell or two for tight queries
+// eg: units on a 32px tile map work well with a cellSize of 64
+//--------------------------------------------
+class eoeSpatialHash {
+public:
+
+	explicit					eoeSpatialHash(const float cellSize = 1.0f, const int numBuckets = 4096);
+
+	int							Add(const eoeVec2 & position, const eoeVec2 & extents = vec2_zero);
+	void						Remove(const int entity);
+	void						Move(const int entity, const eoeVec2 & position);
+	void						Move(const int * entities, const eoeVec2 * positions, const int count);
+	void						SetExtents(const int entity, const eoeVec2 & extents);
+	void						Clear();
+
+	int							Num() const;
+	float						GetCellSize() const;
+	const eoeVec2 &				GetPosition(const int entity) const;
+	const eoeVec2 &				GetExtents(const int entity) const;
+	eoeVec2i					GetCell(const eoeVec2 & position) const;
+
+	int							QueryBounds(int * results, const int maxResults, const eoeVec2 & mins, const eoeVec2 & maxs) const;
+	int							QueryRadius(int * results, const int maxResults, const eoeVec2 & center, const float radius) const;
+
+private:
+
+	struct entry_t {
+		eoeVec2					position;
+		eoeVec2					extents;
+		eoeVec2i				cell;
+		int						entity;
+	};
+
+	int							HashCell(const eoeVec2i & cell) const;
+	void						Insert(const entry_t & entry);
+	void						Erase(const int entity);
+	void						Rehash(const int numBuckets);
+	template<typename filter_t>
+	int							Query(int * results, const int maxResults, const eoeVec2 & mins, const eoeVec2 & maxs, const filter_t & overlaps) const;
+
+private:
+
+	float						cellSize;
+	float						invCellSize;
+	eoeVec2						maxExtents			= vec2_zero;	// largest extents since the last Clear
+	int							numEntities			= 0;
+
+	std::vector<std::vector<entry_t>>	buckets;
+	int							bucketMask;
+
+	// indexed by entity handle
+	std::vector<int>			entityBuckets;						// -1 for a free handle
+	std::vector<int>			entitySlots;						// index into its bucket
+	std::vector<int>			freeEntities;
+};
+
+//-------------------------
+// eoeSpatialHash::Num
+// returns the number of live entities
+//-------------------------
+inline int eoeSpatialHash::Num() const {
+	return numEntities;
+}
+
+//-------------------------
+// eoeSpatialHash::GetCellSize
+//-------------------------
+inline float eoeSpatialHash::GetCellSize() const {
+	return cellSize;
+}
+
+//-------------------------
+// eoeSpatialHash::GetPosition
+//-------------------------
+inline const eoeVec2 & eoeSpatialHash::GetPosition(const int entity) const {
+	return buckets[entityBuckets[entity]][entitySlots[entity]].position;
+}
+
+//-------------------------
+// eoeSpatialHash::GetExtents
+// returns the entity's half-size on each axis
+//-------------------------
+inline const eoeVec2 & eoeSpatialHash::GetExtents(const int entity) const {
+	return buckets[entityBuckets[entity]][entitySlots[entity]].extents;
+}
+
+//-------------------------
+// eoeSpatialHash::GetCell
+// returns the cell holding position, rounding toward negative infinity
+//-------------------------
+inline eoeVec2i eoeSpatialHash::GetCell(const eoeVec2 & position) const {
+	return eoeVec2i((int)floorf(position.x * invCellSize), (int)floorf(position.y * invCellSize));
+}
+
+//-------------------------
+// eoeSpatialHash::HashCell
+// returns the bucket for cell
+//-------------------------
+inline int eoeSpatialHash::HashCell(const eoeVec2i & cell) const {
+	const uint32_t hash = ((uint32_t)cell.x * 0x8DA6B343u) ^ ((uint32_t)cell.y * 0xD8163841u);
+	return (int)((hash ^ (hash >> 15)) & (uint32_t)bucketMask);
+}
+
+#endif /* EOECORE_SPATIAL_HASH_H */
@@ -0,0 +1,122 @@
+#include "ThreadPool.h"
+
+eoeThreadPool eoeThreadPool::threadPool;
+
+// set on worker threads and on the caller while it runs a job,
+// so a ParallelFor from inside a job runs inline instead of deadlocking
+static thread_local bool insideJob = false;
+
+//----------------------
+// eoeThreadPool::~eoeThreadPool
+//----------------------
+eoeThreadPool::~eoeThreadPool() {
+	Shutdown();
+}
+
+//----------------------
+// eoeThreadPool::Init
+// starts numWorkers threads, 0 or less keeps everything on the calling thread
+// eg: SDL_GetCPUCount() - 1 leaves one core for the calling thread
+//----------------------
+void eoeThreadPool::Init(const int numWorkers) {
+	Shutdown();
+	for (int i = 0; i < numWorkers; ++i)
+		workers.emplace_back(&eoeThreadPool::WorkerLoop, this, generation);
+}
+
+//----------------------
+// eoeThreadPool::Shutdown
+// joins all workers, safe to call more than once
+// DEBUG: must not be called while a ParallelFor is running
+//----------------------
+void eoeThreadPool::Shutdown() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quit = true;
+	}
+	wake.notify_all();
+	for (auto & worker : workers)
+		worker.join();
+	workers.clear();
+	quit = false;
+}
+
+//----------------------
+// eoeThreadPool::ParallelFor
+// calls job over disjoint slices covering [0, count) and returns once all have finished
+// slices are at least minBatch long, and a few per thread so uneven work balances out
+// job must be safe to run concurrently on different slices
+//----------------------
+void eoeThreadPool::ParallelFor(const int count, const eoeParallelJob_t & job, const int minBatch) {
+	if (count <= 0)
+		return;
+
+	const int numThreads = NumThreads();
+	if (numThreads == 1 || count <= minBatch || insideJob) {
+		job(0, count);
+		return;
+	}
+
+	std::lock_guard<std::mutex> submitLock(submitMutex);
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		const int evenBatch = (count + numThreads * 4 - 1) / (numThreads * 4);
+		this->job = &job;
+		jobCount = count;
+		batchSize = evenBatch > minBatch ? evenBatch : minBatch;
+		numBatches = (count + batchSize - 1) / batchSize;
+		nextBatch = 0;
+		workersDone = 0;
+		++generation;
+	}
+	wake.notify_all();
+
+	insideJob = true;
+	RunBatches();
+	insideJob = false;
+
+	std::unique_lock<std::mutex> lock(mutex);
+	finished.wait(lock, [this] { return workersDone == (int)workers.size(); });
+	this->job = nullptr;
+}
+
+//----------------------
+// eoeThreadPool::WorkerLoop
+// sleeps until the next generation's job or quit
+//----------------------
+void eoeThreadPool::WorkerLoop(unsigned int seenGeneration) {
+	insideJob = true;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			wake.wait(lock, [this, seenGeneration] { return quit || generation != seenGeneration; });
+			if (quit)
+				return;
+			seenGeneration = generation;
+		}
+
+		RunBatches();
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			++workersDone;
+		}
+		finished.notify_one();
+	}
+}
+
+//----------------------
+// eoeThreadPool::RunBatches
+// claims batches of the current job until none are left
+//----------------------
+void eoeThreadPool::RunBatches() {
+	while (true) {
+		const int batch = nextBatch.fetch_add(1);
+		if (batch >= numBatches)
+			return;
+
+		const int begin = batch * batchSize;
+		const int end = begin + batchSize < jobCount ? begin + batchSize : jobCount;
+		(*job)(begin, end);
+	}
+}
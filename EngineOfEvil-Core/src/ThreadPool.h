@@ -0,0 +1,74 @@
+#ifndef EOECORE_THREAD_POOL_H
+#define EOECORE_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define EVIL_THREADS (eoeThreadPool::threadPool)
+
+// a contiguous [begin, end) slice of a ParallelFor range
+typedef std::function<void(int begin, int end)> eoeParallelJob_t;
+
+//------------------------------------------------
+//				eoeThreadPool
+// singleton set of worker threads that split
+// index ranges with the calling thread
+// runs everything on the calling thread until Init
+//------------------------------------------------
+class eoeThreadPool {
+public:
+
+	void						Init(const int numWorkers);
+	void						Shutdown();
+	int							NumThreads() const;
+	void						ParallelFor(const int count, const eoeParallelJob_t & job, const int minBatch = 1);
+
+private:
+
+								eoeThreadPool() = default;
+							   ~eoeThreadPool();
+
+								eoeThreadPool(const eoeThreadPool & other) = delete;
+								eoeThreadPool(eoeThreadPool && other) = delete;
+
+	eoeThreadPool &				operator=(const eoeThreadPool & other) = delete;
+	eoeThreadPool				operator=(eoeThreadPool && other) = delete;
+
+	void						WorkerLoop(unsigned int seenGeneration);
+	void						RunBatches();
+
+public:
+
+	static eoeThreadPool		threadPool;
+
+private:
+
+	std::vector<std::thread>	workers;
+	std::mutex					submitMutex;				// one ParallelFor at a time
+	std::mutex					mutex;						// guards everything below except nextBatch
+	std::condition_variable		wake;
+	std::condition_variable		finished;
+	unsigned int				generation		= 0;		// bumped per ParallelFor so every worker joins each job exactly once
+	int							workersDone		= 0;
+	bool						quit			= false;
+
+	const eoeParallelJob_t *	job				= nullptr;
+	int							jobCount		= 0;
+	int							batchSize		= 0;
+	int							numBatches		= 0;
+	std::atomic<int>			nextBatch		{ 0 };
+};
+
+//----------------------
+// eoeThreadPool::NumThreads
+// returns the workers plus the calling thread
+//----------------------
+inline int eoeThreadPool::NumThreads() const {
+	return (int)workers.size() + 1;
+}
+
+#endif /* EOECORE_THREAD_POOL_H */
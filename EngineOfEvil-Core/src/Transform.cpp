@@ -0,0 +1,50 @@
+#include "Transform.h"
+#include "QuatRotator.h"
+
+//-------------------------
+// eoeTransform::operator*
+// composes *this as the parent of child in TRS space, no matrix multiplies
+// DEBUG: exact only if this scale is uniform, a non-uniform parent scale under
+// a rotated child would shear, which translation * rotation * scale can't hold
+//-------------------------
+eoeTransform eoeTransform::operator*(const eoeTransform & child) const {
+	return eoeTransform(TransformPoint(child.translation),
+						rotation * child.rotation,
+						eoeVec3(scale.x * child.scale.x, scale.y * child.scale.y, scale.z * child.scale.z));
+}
+
+//-------------------------
+// eoeTransform::ToColumnMajorMVPs
+// writes viewProjection * transforms[i].ToMat4() for count transforms as 16 * count
+// column-major floats, see eoeMat4::MultiplyToColumnMajor
+// model matrices are built a block at a time on the stack
+//-------------------------
+void eoeTransform::ToColumnMajorMVPs(float * dst, const eoeMat4 & viewProjection, const eoeTransform * transforms, const int count) {
+	static constexpr int BLOCK_SIZE = 32;
+	eoeMat4 models[BLOCK_SIZE];
+
+	for (int first = 0; first < count; first += BLOCK_SIZE) {
+		const int num = count - first < BLOCK_SIZE ? count - first : BLOCK_SIZE;
+		for (int i = 0; i < num; ++i)
+			models[i] = transforms[first + i].ToMat4();
+		viewProjection.MultiplyToColumnMajor(dst + first * 16, models, num);
+	}
+}
+
+//-------------------------
+// eoeTransform::ToMat4
+// returns translation * rotation * scale as an eoeMat4
+// writes the rotation terms with each column scaled and the translation
+// in the last column directly, what eoeMat4::GetTranslation * GetRotation * GetScale
+// would produce without the two full multiplies
+//-------------------------
+eoeMat4 eoeTransform::ToMat4() const {
+	const eoeQuatRotator rotator(rotation);
+	const eoeMat4 & r = rotator.ToMat4();
+
+	eoeMat4 matrix;
+	for (int row = 0; row < 3; ++row)
+		matrix[row] = eoeVec4(r[row].x * scale.x, r[row].y * scale.y, r[row].z * scale.z, translation[row]);
+	matrix[3] = eoeVec4(0.0f, 0.0f, 0.0f, 1.0f);
+	return matrix;
+}
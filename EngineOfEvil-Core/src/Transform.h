@@ -0,0 +1,143 @@
+#ifndef EOECORE_TRANSFORM_H
+#define EOECORE_TRANSFORM_H
+
+#include "Matrix.h"
+
+//--------------------------------------------
+//
+//
+//				eoeTransform
+//	--translation * rotation * scale, kept apart--
+//	and only multiplied out into an eoeMat4 on request
+//
+//
+// holds no cached matrix, so it stays 48 bytes (smaller than an eoeMat4),
+// and ToMat4 rebuilds the matrix on every call
+// keep the result if it is needed more than once, as eoeTransformHierarchy
+// does with its world matrices
+//--------------------------------------------
+class eoeTransform {
+public:
+
+							eoeTransform();
+	explicit				eoeTransform(const eoeVec3 & translation, const eoeQuat & rotation = quat_identity, const eoeVec3 & scale = vec3_one);
+
+	const eoeVec3 &			GetTranslation() const;
+	const eoeQuat &			GetRotation() const;
+	const eoeVec3 &			GetScale() const;
+	void					SetTranslation(const eoeVec3 & translation);
+	void					SetRotation(const eoeQuat & rotation);
+	void					SetScale(const eoeVec3 & scale);
+	void					Translate(const eoeVec3 & offset);
+	void					Rotate(const eoeQuat & delta);
+
+	eoeTransform			operator*(const eoeTransform & child) const;
+	eoeVec3					TransformPoint(const eoeVec3 & point) const;
+	eoeVec3					TransformDirection(const eoeVec3 & direction) const;
+
+	eoeMat4					ToMat4() const;
+
+	static void				ToColumnMajorMVPs(float * dst, const eoeMat4 & viewProjection, const eoeTransform * transforms, const int count);
+
+private:
+
+	eoeVec3					translation;
+	eoeQuat					rotation;
+	eoeVec3					scale;
+};
+
+//-------------------------
+// eoeTransform::eoeTransform
+// starts as the identity transform
+//-------------------------
+inline eoeTransform::eoeTransform()
+	: translation(vec3_zero),
+	  rotation(quat_identity),
+	  scale(vec3_one) {
+}
+
+//-------------------------
+// eoeTransform::eoeTransform
+//-------------------------
+inline eoeTransform::eoeTransform(const eoeVec3 & translation, const eoeQuat & rotation, const eoeVec3 & scale)
+	: translation(translation),
+	  rotation(rotation),
+	  scale(scale) {
+}
+
+//-------------------------
+// eoeTransform::GetTranslation
+//-------------------------
+inline const eoeVec3 & eoeTransform::GetTranslation() const {
+	return translation;
+}
+
+//-------------------------
+// eoeTransform::GetRotation
+//-------------------------
+inline const eoeQuat & eoeTransform::GetRotation() const {
+	return rotation;
+}
+
+//-------------------------
+// eoeTransform::GetScale
+//-------------------------
+inline const eoeVec3 & eoeTransform::GetScale() const {
+	return scale;
+}
+
+//-------------------------
+// eoeTransform::SetTranslation
+//-------------------------
+inline void eoeTransform::SetTranslation(const eoeVec3 & translation) {
+	this->translation = translation;
+}
+
+//-------------------------
+// eoeTransform::SetRotation
+// --only deals with unit length quaternions--
+//-------------------------
+inline void eoeTransform::SetRotation(const eoeQuat & rotation) {
+	this->rotation = rotation;
+}
+
+//-------------------------
+// eoeTransform::SetScale
+//-------------------------
+inline void eoeTransform::SetScale(const eoeVec3 & scale) {
+	this->scale = scale;
+}
+
+//-------------------------
+// eoeTransform::Translate
+// moves the transform by offset in its parent's space
+//-------------------------
+inline void eoeTransform::Translate(const eoeVec3 & offset) {
+	translation += offset;
+}
+
+//-------------------------
+// eoeTransform::Rotate
+// applies delta after the current rotation
+//-------------------------
+inline void eoeTransform::Rotate(const eoeQuat & delta) {
+	rotation = delta * rotation;
+}
+
+//-------------------------
+// eoeTransform::TransformPoint
+// translation + rotation * (scale * point), without building the matrix
+//-------------------------
+inline eoeVec3 eoeTransform::TransformPoint(const eoeVec3 & point) const {
+	return translation + rotation * eoeVec3(point.x * scale.x, point.y * scale.y, point.z * scale.z);
+}
+
+//-------------------------
+// eoeTransform::TransformDirection
+// rotation * (scale * direction), without building the matrix
+//-------------------------
+inline eoeVec3 eoeTransform::TransformDirection(const eoeVec3 & direction) const {
+	return rotation * eoeVec3(direction.x * scale.x, direction.y * scale.y, direction.z * scale.z);
+}
+
+#endif /* EOECORE_TRANSFORM_H */
@@ -0,0 +1,255 @@
+#include <algorithm>
+#include "TransformHierarchy.h"
+#include "ThreadPool.h"
+
+// dirty subtrees larger than this are split at their children so threads share them
+static const int MIN_SUBTREE_WORK = 256;
+
+//-------------------------
+// eoeTransformHierarchy::AddNode
+// returns the new node's handle
+// DEBUG: parent must be -1 or a live handle
+//-------------------------
+int eoeTransformHierarchy::AddNode(const eoeTransform & local, const int parent) {
+	int node;
+	if (freeHandles.empty()) {
+		node = (int)handleParents.size();
+		handleParents.push_back(parent);
+		handleSlots.push_back(-1);
+		handleDirty.push_back(false);
+	} else {
+		node = freeHandles.back();
+		freeHandles.pop_back();
+		handleParents[node] = parent;
+	}
+
+	// appended slots still follow their parent, but break subtree contiguity until Rebuild
+	handleSlots[node] = (int)slotHandles.size();
+	slotHandles.push_back(node);
+	slotParents.push_back(parent < 0 ? -1 : handleSlots[parent]);
+	slotEnds.push_back((int)slotHandles.size());
+	locals.push_back(local);
+	worlds.push_back(mat4_identity);
+
+	++numNodes;
+	structureChanged = true;
+	MarkDirty(node);
+	return node;
+}
+
+//-------------------------
+// eoeTransformHierarchy::RemoveNode
+// removes the node and all its descendants, freeing their handles
+//-------------------------
+void eoeTransformHierarchy::RemoveNode(const int node) {
+	if (structureChanged)
+		Rebuild();
+
+	const int begin = handleSlots[node];
+	const int end = slotEnds[begin];
+	for (int slot = begin; slot < end; ++slot) {
+		const int handle = slotHandles[slot];
+		handleSlots[handle] = -1;
+		handleParents[handle] = -1;
+		freeHandles.push_back(handle);
+		slotHandles[slot] = -1;
+	}
+
+	numNodes -= end - begin;
+	structureChanged = true;
+}
+
+//-------------------------
+// eoeTransformHierarchy::SetParent
+// moves node and its descendants under parent, or to the roots for -1
+// DEBUG: parent must not be node or one of its descendants
+//-------------------------
+void eoeTransformHierarchy::SetParent(const int node, const int parent) {
+	handleParents[node] = parent;
+	structureChanged = true;
+	MarkDirty(node);
+}
+
+//-------------------------
+// eoeTransformHierarchy::Clear
+// removes every node, handles start over from 0
+//-------------------------
+void eoeTransformHierarchy::Clear() {
+	handleParents.clear();
+	handleSlots.clear();
+	handleDirty.clear();
+	freeHandles.clear();
+	dirtyHandles.clear();
+	slotHandles.clear();
+	slotParents.clear();
+	slotEnds.clear();
+	locals.clear();
+	worlds.clear();
+	numNodes = 0;
+	structureChanged = false;
+}
+
+//-------------------------
+// eoeTransformHierarchy::SetLocal
+// replaces the node's transform relative to its parent
+// its subtree's world matrices update on the next Update
+//-------------------------
+void eoeTransformHierarchy::SetLocal(const int node, const eoeTransform & local) {
+	locals[handleSlots[node]] = local;
+	MarkDirty(node);
+}
+
+//-------------------------
+// eoeTransformHierarchy::MarkDirty
+//-------------------------
+void eoeTransformHierarchy::MarkDirty(const int node) {
+	if (!handleDirty[node]) {
+		handleDirty[node] = true;
+		dirtyHandles.push_back(node);
+	}
+}
+
+//-------------------------
+// eoeTransformHierarchy::Rebuild
+// re-sorts live nodes depth-first, roots and siblings in handle order
+// world matrices stay valid, they only depend on each node's ancestors
+//-------------------------
+void eoeTransformHierarchy::Rebuild() {
+	const int numHandles = (int)handleParents.size();
+
+	// children of each handle, packed
+	std::vector<int> childStarts(numHandles + 1, 0);
+	std::vector<int> children(numNodes);
+	std::vector<int> roots;
+	for (int handle = 0; handle < numHandles; ++handle) {
+		if (handleSlots[handle] < 0)
+			continue;
+		if (handleParents[handle] < 0)
+			roots.push_back(handle);
+		else
+			++childStarts[handleParents[handle] + 1];
+	}
+	for (int handle = 0; handle < numHandles; ++handle)
+		childStarts[handle + 1] += childStarts[handle];
+	std::vector<int> childFill(childStarts.begin(), childStarts.end() - 1);
+	for (int handle = 0; handle < numHandles; ++handle) {
+		if (handleSlots[handle] >= 0 && handleParents[handle] >= 0)
+			children[childFill[handleParents[handle]]++] = handle;
+	}
+
+	std::vector<int> newSlotHandles;
+	std::vector<int> newSlotParents;
+	std::vector<eoeTransform> newLocals;
+	std::vector<eoeMat4> newWorlds;
+	newSlotHandles.reserve(numNodes);
+	newSlotParents.reserve(numNodes);
+	newLocals.reserve(numNodes);
+	newWorlds.reserve(numNodes);
+
+	// pre-order walk, pushing children in reverse so they pop in handle order
+	std::vector<int> stack(roots.rbegin(), roots.rend());
+	std::vector<int> newHandleSlots(numHandles, -1);
+	while (!stack.empty()) {
+		const int handle = stack.back();
+		stack.pop_back();
+
+		const int oldSlot = handleSlots[handle];
+		const int parent = handleParents[handle];
+		newHandleSlots[handle] = (int)newSlotHandles.size();
+		newSlotHandles.push_back(handle);
+		newSlotParents.push_back(parent < 0 ? -1 : newHandleSlots[parent]);
+		newLocals.push_back(locals[oldSlot]);
+		newWorlds.push_back(worlds[oldSlot]);
+
+		for (int child = childStarts[handle + 1] - 1; child >= childStarts[handle]; --child)
+			stack.push_back(children[child]);
+	}
+
+	// subtree sizes accumulate child to parent, which pre-order visits in reverse
+	std::vector<int> newSlotEnds(newSlotHandles.size(), 0);
+	for (int slot = (int)newSlotHandles.size() - 1; slot >= 0; --slot) {
+		newSlotEnds[slot] += 1;
+		if (newSlotParents[slot] >= 0)
+			newSlotEnds[newSlotParents[slot]] += newSlotEnds[slot];
+	}
+	for (int slot = 0; slot < (int)newSlotEnds.size(); ++slot)
+		newSlotEnds[slot] += slot;
+
+	handleSlots.swap(newHandleSlots);
+	slotHandles.swap(newSlotHandles);
+	slotParents.swap(newSlotParents);
+	slotEnds.swap(newSlotEnds);
+	locals.swap(newLocals);
+	worlds.swap(newWorlds);
+	structureChanged = false;
+}
+
+//-------------------------
+// eoeTransformHierarchy::Update
+// recomputes the world matrix of every dirty node and its descendants
+// costs nothing when no node changed since the last Update
+//-------------------------
+void eoeTransformHierarchy::Update() {
+	if (structureChanged)
+		Rebuild();
+	if (dirtyHandles.empty())
+		return;
+
+	std::vector<int> dirtySlots;
+	dirtySlots.reserve(dirtyHandles.size());
+	for (const int handle : dirtyHandles) {
+		handleDirty[handle] = false;
+		if (handleSlots[handle] >= 0)
+			dirtySlots.push_back(handleSlots[handle]);
+	}
+	dirtyHandles.clear();
+	std::sort(dirtySlots.begin(), dirtySlots.end());
+
+	// outermost dirty subtrees, each one contiguous and independent of the others
+	std::vector<int> pending;
+	int covered = 0;
+	int totalWork = 0;
+	for (const int slot : dirtySlots) {
+		if (slot < covered)
+			continue;
+		covered = slotEnds[slot];
+		totalWork += covered - slot;
+		pending.push_back(slot);
+	}
+
+	// split subtrees too big for one thread's share, updating their roots here first
+	const int threadShare = totalWork / (EVIL_THREADS.NumThreads() * 4);
+	const int maxWork = threadShare > MIN_SUBTREE_WORK ? threadShare : MIN_SUBTREE_WORK;
+	std::vector<int> subtrees;
+	while (!pending.empty()) {
+		const int slot = pending.back();
+		pending.pop_back();
+		if (slotEnds[slot] - slot <= maxWork || EVIL_THREADS.NumThreads() == 1) {
+			subtrees.push_back(slot);
+			continue;
+		}
+
+		UpdateSlots(slot, slot + 1);
+		for (int child = slot + 1; child < slotEnds[slot]; child = slotEnds[child])
+			pending.push_back(child);
+	}
+
+	EVIL_THREADS.ParallelFor((int)subtrees.size(), [this, &subtrees](int begin, int end) {
+		for (int i = begin; i < end; ++i)
+			UpdateSlots(subtrees[i], slotEnds[subtrees[i]]);
+	});
+}
+
+//-------------------------
+// eoeTransformHierarchy::UpdateSlots
+// world = parent world * local, in slot order so parents are always current
+//-------------------------
+void eoeTransformHierarchy::UpdateSlots(const int begin, const int end) {
+	for (int slot = begin; slot < end; ++slot) {
+		const int parent = slotParents[slot];
+		if (parent < 0)
+			worlds[slot] = locals[slot].ToMat4();
+		else
+			worlds[slot] = worlds[parent] * locals[slot].ToMat4();
+	}
+}
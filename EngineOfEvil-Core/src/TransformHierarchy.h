@@ -0,0 +1,92 @@
+#ifndef EOECORE_TRANSFORM_HIERARCHY_H
+#define EOECORE_TRANSFORM_HIERARCHY_H
+
+#include <vector>
+#include "Transform.h"
+
+//--------------------------------------------
+//
+//
+//			eoeTransformHierarchy
+//	  --parent/child eoeTransforms in flat arrays--
+//
+//
+// nodes are addressed by stable handles, but stored depth-first
+// so every parent precedes its children and every subtree is one
+// contiguous slot range, world matrices are then a single linear
+// pass, and unrelated dirty subtrees update in parallel
+//--------------------------------------------
+class eoeTransformHierarchy {
+public:
+
+	int							AddNode(const eoeTransform & local, const int parent = -1);
+	void						RemoveNode(const int node);
+	void						SetParent(const int node, const int parent);
+	void						Clear();
+
+	int							Num() const;
+	int							GetParent(const int node) const;
+	const eoeTransform &		GetLocal(const int node) const;
+	void						SetLocal(const int node, const eoeTransform & local);
+	const eoeMat4 &				GetWorld(const int node) const;
+
+	void						Update();
+
+private:
+
+	void						MarkDirty(const int node);
+	void						Rebuild();
+	void						UpdateSlots(const int begin, const int end);
+
+private:
+
+	// indexed by handle
+	std::vector<int>			handleParents;			// parent handle, -1 for a root
+	std::vector<int>			handleSlots;			// -1 for a free handle
+	std::vector<bool>			handleDirty;
+	std::vector<int>			freeHandles;
+	std::vector<int>			dirtyHandles;			// local changed since the last Update
+	int							numNodes			= 0;
+	bool						structureChanged	= false;
+
+	// indexed by slot, depth-first once Rebuild has run
+	std::vector<int>			slotHandles;			// -1 for a removed node awaiting Rebuild
+	std::vector<int>			slotParents;
+	std::vector<int>			slotEnds;				// one past the slot's last descendant
+	std::vector<eoeTransform>	locals;
+	std::vector<eoeMat4>		worlds;
+};
+
+//-------------------------
+// eoeTransformHierarchy::Num
+// returns the number of live nodes
+//-------------------------
+inline int eoeTransformHierarchy::Num() const {
+	return numNodes;
+}
+
+//-------------------------
+// eoeTransformHierarchy::GetParent
+// returns the parent's handle, or -1 for a root
+//-------------------------
+inline int eoeTransformHierarchy::GetParent(const int node) const {
+	return handleParents[node];
+}
+
+//-------------------------
+// eoeTransformHierarchy::GetLocal
+// returns the node's transform relative to its parent
+//-------------------------
+inline const eoeTransform & eoeTransformHierarchy::GetLocal(const int node) const {
+	return locals[handleSlots[node]];
+}
+
+//-------------------------
+// eoeTransformHierarchy::GetWorld
+// returns the node's model-to-world matrix as of the last Update
+//-------------------------
+inline const eoeMat4 & eoeTransformHierarchy::GetWorld(const int node) const {
+	return worlds[handleSlots[node]];
+}
+
+#endif /* EOECORE_TRANSFORM_HIERARCHY_H */
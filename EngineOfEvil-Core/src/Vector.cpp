@@ -1,41 +1,66 @@
-#include "Vector.h"
-
-eoeVec2 vec2_zero		( 0.0f, 0.0f );
-eoeVec2 vec2_oneZero	( 1.0f, 0.0f );
-eoeVec2 vec2_zeroOne	( 0.0f, 1.0f );
-eoeVec2 vec2_one		( 1.0f, 1.0f );
-eoeVec2 vec2_epsilon	(FLT_EPSILON, FLT_EPSILON);
-
-eoeVec3 vec3_right		( 1.0f,  0.0f,  0.0f );
-eoeVec3 vec3_left		(-1.0f,  0.0f,  0.0f );
-eoeVec3 vec3_up			( 0.0f, -1.0f,  0.0f );
-eoeVec3 vec3_down		( 0.0f,  1.0f,  0.0f );
-eoeVec3 vec3_forward	( 0.0f,  0.0f,  1.0f );
-eoeVec3 vec3_back		( 0.0f,  0.0f, -1.0f );
-eoeVec3 vec3_zero		( 0.0f,  0.0f,  0.0f );
-eoeVec3 vec3_one		( 1.0f,  1.0f,  1.0f );
+#include "QuatRotator.h"
 
 eoeVec3	eoeQuat::Rotate(const eoeVec3 & rotationAxis, float degrees, const eoeVec3 & toRotate) {
-	const eoeVec3 quatXYZ = rotationAxis * SDL_sinf(eoeMath::ToRadians(degrees) * 0.5f);
-	const eoeQuat rotation( quatXYZ.x, quatXYZ.y, quatXYZ.z, SDL_cosf(eoeMath::ToRadians(degrees) * 0.5f));
+	const eoeQuat rotation = FromAxisAngle(rotationAxis, degrees);
 	return rotation * toRotate;
 }
 
 
 eoeVec2	eoeQuat::Rotate(const eoeVec3 & rotationAxis, float degrees, const eoeVec2 & toRotate) {
-	const eoeVec3 quatXYZ = rotationAxis * SDL_sinf(eoeMath::ToRadians(degrees) * 0.5f);
-	const eoeQuat rotation( quatXYZ.x, quatXYZ.y, quatXYZ.z, SDL_cosf(eoeMath::ToRadians(degrees) * 0.5f));
+	const eoeQuat rotation = FromAxisAngle(rotationAxis, degrees);
 	return rotation * toRotate;
 }
 
 void eoeQuat::Rotate(const eoeVec3 & rotationAxis, float degrees, eoeVec3 & toRotate) {
-	const eoeVec3 quatXYZ = rotationAxis * SDL_sinf(eoeMath::ToRadians(degrees) * 0.5f);
-	const eoeQuat rotation( quatXYZ.x, quatXYZ.y, quatXYZ.z, SDL_cosf(eoeMath::ToRadians(degrees) * 0.5f));
+	const eoeQuat rotation = FromAxisAngle(rotationAxis, degrees);
 	toRotate = rotation * toRotate;
 }
 
 void eoeQuat::Rotate(const eoeVec3 & rotationAxis, float degrees, eoeVec2 & toRotate) {
-	const eoeVec3 quatXYZ = rotationAxis * SDL_sinf(eoeMath::ToRadians(degrees) * 0.5f);
-	const eoeQuat rotation( quatXYZ.x, quatXYZ.y, quatXYZ.z, SDL_cosf(eoeMath::ToRadians(degrees) * 0.5f));
+	const eoeQuat rotation = FromAxisAngle(rotationAxis, degrees);
 	toRotate = rotation * toRotate;
-}
\ No newline at end of file
+}
+
+//-------------------------
+// eoeQuat::ToMat4
+// returns the column-vector rotation matrix of *this
+// --only deals with unit length quaternions--
+//-------------------------
+eoeMat4 eoeQuat::ToMat4() const {
+	return eoeQuatRotator(*this).ToMat4();
+}
+
+//-------------------------
+// eoeQuat::Slerp
+// spherical linear interpolation along the shortest path from from to to
+// constant angular speed, falls back to Nlerp for nearly identical rotations
+//-------------------------
+eoeQuat eoeQuat::Slerp(const eoeQuat & from, const eoeQuat & to, const float fraction) {
+	float cosOmega = from.Dot(to);
+	float sign = 1.0f;
+	if (cosOmega < 0.0f) {
+		cosOmega = -cosOmega;
+		sign = -1.0f;
+	}
+
+	if (cosOmega > 0.9995f)
+		return Nlerp(from, to, fraction);
+
+	const float sinOmega = sqrtf(1.0f - cosOmega * cosOmega);
+	const float omega = eoeMath::ATan2(sinOmega, cosOmega);
+	const float invSinOmega = 1.0f / sinOmega;
+
+	float sinFrom;
+	float sinTo;
+	float cos;		// unused
+	eoeMath::SinCos((1.0f - fraction) * omega, sinFrom, cos);
+	eoeMath::SinCos(fraction * omega, sinTo, cos);
+
+	const float fromScale = sinFrom * invSinOmega;
+	const float toScale = sinTo * invSinOmega * sign;
+
+	return eoeQuat(from.x * fromScale + to.x * toScale,
+				   from.y * fromScale + to.y * toScale,
+				   from.z * fromScale + to.z * toScale,
+				   from.w * fromScale + to.w * toScale);
+}
@@ -2,938 +2,763 @@
 #define EOECORE_VECTOR_H
 
 #include <float.h>
+#include <type_traits>
 #include "SDL.h"			// for SDL_sqrtf
 #include "Math.h"
 
 // handles direction vectors, quaternions, and their operations
 // as well as a 4-float position vector
+// every vector is one eoeVec<type, size> template, eoeVec2, eoeVec3, and eoeVec4
+// are its float instantiations, eoeVec2i... are int32 and eoeVec2d... are double
+
+template<typename type, int size>
+class eoeVec;
 
 //--------------------------------------------
 //
 //
-//					eoeVec2
-//		--direction vector behavior--
+//			eoeVecComponents
+//	  --the named x, y, z, w of an eoeVec--
 //
 //
+// eoeVec inherits these constructors, so each size keeps the arity
+// (and explicitness) the hand-written float classes had
 //--------------------------------------------
-class eoeVec2 {
-public:
-
-	float			x = 0.0f;
-	float			y = 0.0f;
-
-					eoeVec2() = default;
-	explicit		eoeVec2(const float x, const float y);
-
-	void			Set(const float x, const float y);
-	void			Zero();
-	float			Normalize();
-	eoeVec2			Normalized();
-	float			Length() const;
-	float			LengthSquared() const;
-
-	float			operator[](const int index) const;
-	float &			operator[](const int index);
-	eoeVec2			operator-() const;
-	float			operator*(const eoeVec2 &a) const;
-	eoeVec2			operator*(const float a) const;
-	eoeVec2			operator/(const float a) const;
-	eoeVec2			operator+(const eoeVec2 &a) const;
-	eoeVec2			operator-(const eoeVec2 &a) const;
-	eoeVec2 &		operator+=(const eoeVec2 &a);
-	eoeVec2 &		operator-=(const eoeVec2 &a);
-	eoeVec2 &		operator/=(const float a);
-	eoeVec2 &		operator*=(const float a);
-
-	bool			Compare(const eoeVec2 &a) const;
-	bool			Compare(const eoeVec2 &a, const float epsilon) const;
-	bool			operator==(const eoeVec2 &a) const;
-	bool			operator!=(const eoeVec2 &a) const;
-
-	void			SnapInt();
-};
+template<typename type, int size>
+struct eoeVecComponents;
 
-extern eoeVec2 vec2_zero;
-extern eoeVec2 vec2_oneZero;
-extern eoeVec2 vec2_zeroOne;
-extern eoeVec2 vec2_one;
-extern eoeVec2 vec2_epsilon;
+template<typename type>
+struct eoeVecComponents<type, 2> {
+	type				x = type(0);
+	type				y = type(0);
 
-//-------------------------
-// eoeVec2::eoeVec2
-//-------------------------
-inline eoeVec2::eoeVec2(const float x, const float y) 
-	: x(x),
-	  y(y) {
-}
-
-//-------------------------
-// eoeVec2::Set
-// modifies the current x and y values
-//-------------------------
-inline void eoeVec2::Set(const float x, const float y) {
-	this->x = x;
-	this->y = y;
-}
-
-//-------------------------
-// eoeVec2::Zero
-// sets x and y to zero
-//-------------------------
-inline void eoeVec2::Zero() {
-	x = 0.0f;
-	y = 0.0f;
-}
-
-//-------------------------
-// eoeVec2::Compare
-// returns true for exact x,y match
-//-------------------------
-inline bool eoeVec2::Compare(const eoeVec2 &a) const {
-	return ((x == a.x) && (y == a.y));
-}
+						eoeVecComponents() = default;
+	explicit constexpr	eoeVecComponents(const type x, const type y) : x(x), y(y) {}
+};
 
-//-------------------------
-// eoeVec2::Compare
-// returns true for x,y match within range of epsilon
-//-------------------------
-inline bool eoeVec2::Compare(const eoeVec2 &a, const float epsilon) const {
-	if ( SDL_fabs(x - a.x) > epsilon)
-		return false;
+template<typename type>
+struct eoeVecComponents<type, 3> {
+	type				x = type(0);
+	type				y = type(0);
+	type				z = type(0);
 
-	if (SDL_fabs(y - a.y) > epsilon)
-		return false;
+						eoeVecComponents() = default;
+	explicit constexpr	eoeVecComponents(const type x, const type y, const type z) : x(x), y(y), z(z) {}
+	constexpr			eoeVecComponents(const eoeVec<type, 2> & point) : x(point.x), y(point.y), z(type(0)) {}
+};
 
-	return true;
-}
+// four components fill exactly one SSE (or for double, one AVX) register,
+// so they are aligned to their size and arrays of them never straddle a register
+template<typename type>
+struct alignas(4 * sizeof(type)) eoeVecComponents<type, 4> {
+	type				x = type(0);
+	type				y = type(0);
+	type				z = type(0);
+	type				w = type(0);
+
+						eoeVecComponents() = default;
+	constexpr			eoeVecComponents(const type x, const type y, const type z, const type w) : x(x), y(y), z(z), w(w) {}
+};
 
-//-------------------------
-// eoeVec2::operator[]
-// returns x for [0] and y for [1]
-// undefined behavior for index out of bounds
-//-------------------------
-inline float eoeVec2::operator[](const int index) const {
-	return (&x)[index];
-}
+//--------------------------------------------
+//
+//
+//				eoeVecOps
+//	 --the per-component loops every eoeVec operation uses--
+//
+//
+// unrolled at compile time and applied in x, y, z, w order, so float results
+// match the original hand-written classes bit-for-bit
+// this is the one place an eoeVec touches its components in bulk, specialize it
+// for a given type and size (eg: eoeVecOps<float, 4> with SSE) to swap in intrinsics
+//--------------------------------------------
+template<typename type, int size>
+struct eoeVecOps {
+	typedef eoeVec<type, size> vec_t;
+
+	template<typename op_t>
+	static constexpr vec_t	Map(const vec_t & a, op_t op);
+	template<typename op_t>
+	static constexpr vec_t	Zip(const vec_t & a, const vec_t & b, op_t op);
+	template<typename op_t>
+	static constexpr bool	All(const vec_t & a, const vec_t & b, op_t op);
+	static constexpr type	Dot(const vec_t & a, const vec_t & b);
+};
 
-//-------------------------
-// eoeVec2::operator[]
-// returns x for [0] and y for [1]
-// undefined behavior for index out of bounds
-//-------------------------
-inline float & eoeVec2::operator[](const int index) {
-	return (&x)[index];
-}
+//--------------------------------------------
+//
+//
+//				eoeVec
+//		--direction or position vector--
+//
+//
+// operator* between two vectors is the dot product for sizes 2 and 3
+// and component-wise for size 4, as the original eoeVec4 defined it,
+// Dot and Scale spell out either one for any size
+// integer instantiations are exact (/ truncates like int division,
+// FloorDiv and FloorMod round toward negative infinity for tile math),
+// float-only operations (eg: Normalize) fail to compile for int32
+//--------------------------------------------
+template<typename type, int size>
+class eoeVec : public eoeVecComponents<type, size> {
+public:
 
-//-------------------------
-// eoeVec2::operator==
-// returns the result of Compare without epsilon
-//-------------------------
-inline bool eoeVec2::operator==(const eoeVec2 &a) const {
-	return Compare(a);
-}
+	static_assert(size >= 2 && size <= 4, "eoeVec holds 2, 3, or 4 components");
+
+	typedef type							component_t;
+	typedef eoeVecOps<type, size>			ops_t;
+	typedef typename std::conditional<size == 4, eoeVec, type>::type	product_t;
+
+	static constexpr int	SIZE = size;
+
+	using					eoeVecComponents<type, size>::eoeVecComponents;
+							eoeVec() = default;
+
+	template<typename otherType>
+	explicit constexpr		eoeVec(const eoeVec<otherType, size> & other);
+
+	void					Set(const type x, const type y);
+	void					Set(const type x, const type y, const type z);
+	void					Set(const type x, const type y, const type z, const type w);
+	void					Zero();
+	type					Normalize();
+	eoeVec					Normalized() const;
+	type					Length() const;
+	constexpr type			LengthSquared() const;
+	constexpr type			ManhattanLength() const;
+	constexpr type			ChebyshevLength() const;
+	constexpr type			Dot(const eoeVec &a) const;
+	constexpr eoeVec		Scale(const eoeVec &a) const;
+	void					Clamp01();
+
+	type					operator[](const int index) const;
+	type &					operator[](const int index);
+	constexpr eoeVec		operator-() const;
+	constexpr product_t		operator*(const eoeVec &a) const;
+	constexpr eoeVec		operator*(const type a) const;
+	constexpr eoeVec		operator/(const eoeVec &a) const;
+	constexpr eoeVec		operator/(const type a) const;
+	constexpr eoeVec		operator+(const eoeVec &a) const;
+	constexpr eoeVec		operator-(const eoeVec &a) const;
+	eoeVec &				operator+=(const eoeVec &a);
+	eoeVec &				operator-=(const eoeVec &a);
+	eoeVec &				operator/=(const eoeVec &a);
+	eoeVec &				operator/=(const type a);
+	eoeVec &				operator*=(const eoeVec &a);
+	eoeVec &				operator*=(const type a);
+
+	const type *			ToPtr() const;
+	type *					ToPtr();
+	const float *			ToFloatPtr() const;
+	float *					ToFloatPtr();
+
+	constexpr bool			Compare(const eoeVec &a) const;
+	bool					Compare(const eoeVec &a, const float epsilon) const;
+	constexpr bool			operator==(const eoeVec &a) const;
+	constexpr bool			operator!=(const eoeVec &a) const;
+
+	constexpr eoeVec		Cross(const eoeVec &a) const;
+	eoeVec &				Cross(const eoeVec &a, const eoeVec &b);
+
+	constexpr eoeVec		FloorDiv(const type divisor) const;
+	constexpr eoeVec		FloorMod(const type divisor) const;
+	void					SnapInt();
+
+	static constexpr eoeVec	Min(const eoeVec &a, const eoeVec &b);
+	static constexpr eoeVec	Max(const eoeVec &a, const eoeVec &b);
+};
 
-//-------------------------
-// eoeVec2::operator!=
-// returns the negated result of Compare without epsilon
-//-------------------------
-inline bool eoeVec2::operator!=(const eoeVec2 &a) const {
-	return !Compare(a);
-}
+typedef eoeVec<float, 2>	eoeVec2;
+typedef eoeVec<float, 3>	eoeVec3;
+typedef eoeVec<float, 4>	eoeVec4;
+typedef eoeVec<int, 2>		eoeVec2i;
+typedef eoeVec<int, 3>		eoeVec3i;
+typedef eoeVec<int, 4>		eoeVec4i;
+typedef eoeVec<double, 2>	eoeVec2d;
+typedef eoeVec<double, 3>	eoeVec3d;
+typedef eoeVec<double, 4>	eoeVec4d;
 
-//-------------------------
-// eoeVec2::Length
-// returns vector length
-//-------------------------
-inline float eoeVec2::Length() const {
-	return SDL_sqrtf(x * x + y * y);
-}
+//--------------------------------------------
+//
+//
+//				eoeVec3A
+//	   --eoeVec3 padded to one aligned register--
+//
+//
+// opt-in for arrays that are streamed through SIMD code, at the cost of 4 extra bytes each
+// behaves as an eoeVec3 everywhere, pad is never read and stays zero
+//--------------------------------------------
+class alignas(16) eoeVec3A : public eoeVec3 {
+public:
 
-//-------------------------
-// eoeVec2::LengthSquared
-// returns vector length squared
-//-------------------------
-inline float eoeVec2::LengthSquared() const {
-	return (x * x + y * y);
-}
+	float					pad = 0.0f;
 
-//-------------------------
-// eoeVec2::Normalize
-// scales internal x,y to unit length vector
-// returns normalized length of 0 or 1
-//-------------------------
-inline float eoeVec2::Normalize() {
-	float sqrLength, invLength;
+							eoeVec3A() = default;
+	explicit constexpr		eoeVec3A(const float x, const float y, const float z) : eoeVec3(x, y, z) {}
+	constexpr				eoeVec3A(const eoeVec3 & vector) : eoeVec3(vector) {}
 
-	sqrLength = x * x + y * y;
-	sqrLength = SDL_sqrtf(sqrLength);
+	eoeVec3A &				operator=(const eoeVec3 & vector) { eoeVec3::operator=(vector); return *this; }
+};
 
-	if (sqrLength == 0)
-		invLength = 0;
+inline constexpr eoeVec2 vec2_zero		( 0.0f, 0.0f );
+inline constexpr eoeVec2 vec2_oneZero	( 1.0f, 0.0f );
+inline constexpr eoeVec2 vec2_zeroOne	( 0.0f, 1.0f );
+inline constexpr eoeVec2 vec2_one		( 1.0f, 1.0f );
+inline constexpr eoeVec2 vec2_epsilon	( FLT_EPSILON, FLT_EPSILON );
+
+inline constexpr eoeVec3 vec3_right		( 1.0f,  0.0f,  0.0f );
+inline constexpr eoeVec3 vec3_left		(-1.0f,  0.0f,  0.0f );
+inline constexpr eoeVec3 vec3_up		( 0.0f, -1.0f,  0.0f );
+inline constexpr eoeVec3 vec3_down		( 0.0f,  1.0f,  0.0f );
+inline constexpr eoeVec3 vec3_forward	( 0.0f,  0.0f,  1.0f );
+inline constexpr eoeVec3 vec3_back		( 0.0f,  0.0f, -1.0f );
+inline constexpr eoeVec3 vec3_zero		( 0.0f,  0.0f,  0.0f );
+inline constexpr eoeVec3 vec3_one		( 1.0f,  1.0f,  1.0f );
+
+inline constexpr eoeVec2i vec2i_zero	( 0, 0 );
+inline constexpr eoeVec2i vec2i_one		( 1, 1 );
+
+//-------------------------
+// eoeVecOps::Map
+// returns op applied to each component of a
+//-------------------------
+template<typename type, int size>
+template<typename op_t>
+inline constexpr eoeVec<type, size> eoeVecOps<type, size>::Map(const vec_t & a, op_t op) {
+	if constexpr (size == 2)
+		return vec_t(op(a.x), op(a.y));
+	else if constexpr (size == 3)
+		return vec_t(op(a.x), op(a.y), op(a.z));
 	else
-		invLength = 1.0f / sqrLength;
-
-	x *= invLength;
-	y *= invLength;
-	return invLength * sqrLength;
+		return vec_t(op(a.x), op(a.y), op(a.z), op(a.w));
 }
 
 //-------------------------
-// eoeVec2::Normalized
-// scales a copy of x,y to unit length vector
+// eoeVecOps::Zip
+// returns op applied to each pair of components of a and b
 //-------------------------
-inline eoeVec2 eoeVec2::Normalized() {
-	float sqrLength;
-	float invLength;
-
-	sqrLength = x * x + y * y;
-	sqrLength = SDL_sqrtf(sqrLength);
-
-	if (sqrLength == 0)
-		invLength = 0;
+template<typename type, int size>
+template<typename op_t>
+inline constexpr eoeVec<type, size> eoeVecOps<type, size>::Zip(const vec_t & a, const vec_t & b, op_t op) {
+	if constexpr (size == 2)
+		return vec_t(op(a.x, b.x), op(a.y, b.y));
+	else if constexpr (size == 3)
+		return vec_t(op(a.x, b.x), op(a.y, b.y), op(a.z, b.z));
 	else
-		invLength = 1.0f / sqrLength;
-
-	return eoeVec2(x * invLength, y * invLength);
-}
-
-//-------------------------
-// eoeVec2::operator-
-// returns eoeVec2 with negated x and y
-//-------------------------
-inline eoeVec2 eoeVec2::operator-() const {
-	return eoeVec2(-x, -y);
-}
-
-//-------------------------
-// eoeVec2::operator-
-// returns an eoeVec2 using the difference between two vectors' x and y
-//-------------------------
-inline eoeVec2 eoeVec2::operator-(const eoeVec2 &a) const {
-	return eoeVec2(x - a.x, y - a.y);
-}
-
-//-------------------------
-// eoeVec2::operator*
-// returns the dot product of two eoeVec2s
-//-------------------------
-inline float eoeVec2::operator*(const eoeVec2 &a) const {
-	return x * a.x + y * a.y;
-}
-
-//-------------------------
-// eoeVec2::operator*
-// returns an eoeVec2 with x and y scaled by a
-//-------------------------
-inline eoeVec2 eoeVec2::operator*(const float a) const {
-	return eoeVec2(x * a, y * a);
-}
-
-//-------------------------
-// eoeVec2::operator/
-// returns an eoeVec2 with de-scaled x and y by a
-// DEBUG: allows divide by zero errors to occur
-//-------------------------
-inline eoeVec2 eoeVec2::operator/(const float a) const {
-	float inva = 1.0f / a;
-	return eoeVec2(x * inva, y * inva);
-}
-
-//-------------------------
-// eoeVec2::operator+
-// returns an eoeVec2 using the sum of two eoeVec2's x and y
-//-------------------------
-inline eoeVec2 eoeVec2::operator+(const eoeVec2 &a) const {
-	return eoeVec2(x + a.x, y + a.y);
-}
-
-//-------------------------
-// eoeVec2::operator+=
-// returns this with x and y added to an eoeVec2's x and y
-//-------------------------
-inline eoeVec2 & eoeVec2::operator+=(const eoeVec2 &a) {
-	x += a.x;
-	y += a.y;
-	return *this;
-}
-
-//-------------------------
-// eoeVec2::operator/=
-// returns this with x and y de-scaled by a
-// DEBUG: allows divide by zero errors to occur
-//-------------------------
-inline eoeVec2 & eoeVec2::operator/=(const float a) {
-	float inva = 1.0f / a;
-	x *= inva;
-	y *= inva;
-	return *this;
+		return vec_t(op(a.x, b.x), op(a.y, b.y), op(a.z, b.z), op(a.w, b.w));
 }
 
 //-------------------------
-// eoeVec2::operator-=
-// returns this with x and y subtracted by another eoeVec2's x and y
+// eoeVecOps::All
+// returns true if op holds for every pair of components of a and b
 //-------------------------
-inline eoeVec2 & eoeVec2::operator-=(const eoeVec2 &a) {
-	x -= a.x;
-	y -= a.y;
-	return *this;
+template<typename type, int size>
+template<typename op_t>
+inline constexpr bool eoeVecOps<type, size>::All(const vec_t & a, const vec_t & b, op_t op) {
+	if constexpr (size == 2)
+		return op(a.x, b.x) && op(a.y, b.y);
+	else if constexpr (size == 3)
+		return op(a.x, b.x) && op(a.y, b.y) && op(a.z, b.z);
+	else
+		return op(a.x, b.x) && op(a.y, b.y) && op(a.z, b.z) && op(a.w, b.w);
 }
 
 //-------------------------
-// eoeVec2::operator*=
-// returns this with x and y scaled by a
+// eoeVecOps::Dot
+// sums left to right, x * x first
 //-------------------------
-inline eoeVec2 & eoeVec2::operator*=(const float a) {
-	x *= a;
-	y *= a;
-	return *this;
+template<typename type, int size>
+inline constexpr type eoeVecOps<type, size>::Dot(const vec_t & a, const vec_t & b) {
+	if constexpr (size == 2)
+		return a.x * b.x + a.y * b.y;
+	else if constexpr (size == 3)
+		return a.x * b.x + a.y * b.y + a.z * b.z;
+	else
+		return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
 }
 
 //-------------------------
-// eoeVec2::SnapInt
-// moves x and y to the nearest integer value
+// eoeVec::eoeVec
+// converts each component of other with a static_cast
+// eg: eoeVec2i(eoeVec2(1.7f, -1.7f)) == eoeVec2i(1, -1), see SnapInt to round first
 //-------------------------
-inline void eoeVec2::SnapInt() {
-	x = floorf(x + 0.5f);
-	y = floorf(y + 0.5f);
+template<typename type, int size>
+template<typename otherType>
+inline constexpr eoeVec<type, size>::eoeVec(const eoeVec<otherType, size> & other) {
+	this->x = static_cast<type>(other.x);
+	this->y = static_cast<type>(other.y);
+	if constexpr (size >= 3)
+		this->z = static_cast<type>(other.z);
+	if constexpr (size == 4)
+		this->w = static_cast<type>(other.w);
 }
 
-//--------------------------------------------
-//
-//
-//				eoeVec3
-//	  --direction vector behavior--
-//
-//
-//--------------------------------------------
-class eoeVec3 {
-public:
-
-	float			x = 0.0f;
-	float			y = 0.0f;
-	float			z = 0.0f;
-
-					eoeVec3() = default;
-	explicit		eoeVec3(const float x, const float y, const float z);
-					eoeVec3(const eoeVec2 & point);
-
-	void			Set(const float x, const float y, const float z);
-	void			Zero();
-	float			Normalize();
-	float			Length() const;
-	float			LengthSquared() const;
-
-	float			operator[](const int index) const;
-	float &			operator[](const int index);
-	eoeVec3			operator-() const;
-	float			operator*(const eoeVec3 &a) const;
-	eoeVec3			operator*(const float a) const;
-	eoeVec3			operator/(const float a) const;
-	eoeVec3			operator+(const eoeVec3 &a) const;
-	eoeVec3			operator-(const eoeVec3 &a) const;
-	eoeVec3 &		operator+=(const eoeVec3 &a);
-	eoeVec3 &		operator-=(const eoeVec3 &a);
-	eoeVec3 &		operator/=(const float a);
-	eoeVec3 &		operator*=(const float a);	
-
-	bool			Compare(const eoeVec3 &a) const;
-	bool			Compare(const eoeVec3 &a, const float epsilon) const;
-	bool			operator==(const eoeVec3 &a) const;
-	bool			operator!=(const eoeVec3 &a) const;
-
-	eoeVec3			Cross(const eoeVec3 &a) const;
-	eoeVec3 &		Cross(const eoeVec3 &a, const eoeVec3 &b);
-
-	void			SnapInt();
-};
-
-extern eoeVec3 vec3_right;
-extern eoeVec3 vec3_left;
-extern eoeVec3 vec3_up;
-extern eoeVec3 vec3_down;
-extern eoeVec3 vec3_forward;
-extern eoeVec3 vec3_back;
-extern eoeVec3 vec3_zero;
-extern eoeVec3 vec3_one;
-
 //-------------------------
-// eoeVec3::eoeVec3
+// eoeVec::Set
+// modifies the current x and y values
 //-------------------------
-inline eoeVec3::eoeVec3(const float x, const float y, const float z)
-	: x(x),
-	  y(y),
-	  z(z) {
+template<typename type, int size>
+inline void eoeVec<type, size>::Set(const type x, const type y) {
+	static_assert(size == 2, "Set takes one value per component");
+	*this = eoeVec(x, y);
 }
 
 //-------------------------
-// eoeVec3::eoeVec3
+// eoeVec::Set
+// modifies the current x, y, and z values
 //-------------------------
-inline eoeVec3::eoeVec3(const eoeVec2 & point)
-	: x(point.x),
-	  y(point.y),
-	  z(0.0f) {
+template<typename type, int size>
+inline void eoeVec<type, size>::Set(const type x, const type y, const type z) {
+	static_assert(size == 3, "Set takes one value per component");
+	*this = eoeVec(x, y, z);
 }
 
 //-------------------------
-// eoeVec3::Set
-// modifies the current x, y, and z values
+// eoeVec::Set
+// modifies the current x, y, z, and w values
 //-------------------------
-inline void eoeVec3::Set(const float x, const float y, const float z) {
-	this->x = x;
-	this->y = y;
-	this->z = z;
+template<typename type, int size>
+inline void eoeVec<type, size>::Set(const type x, const type y, const type z, const type w) {
+	static_assert(size == 4, "Set takes one value per component");
+	*this = eoeVec(x, y, z, w);
 }
 
 //-------------------------
-// eoeVec3::Zero
-// sets x, y, and z to zero
+// eoeVec::Zero
+// sets every component to zero
 //-------------------------
-inline void eoeVec3::Zero() {
-	x = 0.0f;
-	y = 0.0f;
-	z = 0.0f;
+template<typename type, int size>
+inline void eoeVec<type, size>::Zero() {
+	*this = eoeVec();
 }
 
 //-------------------------
-// eoeVec3::Compare
-// returns true for exact x,y,z match
+// eoeVec::Compare
+// returns true for exact component match
 //-------------------------
-inline bool eoeVec3::Compare(const eoeVec3 &a) const {
-	return ((x == a.x) && (y == a.y) && (z == a.z));
+template<typename type, int size>
+inline constexpr bool eoeVec<type, size>::Compare(const eoeVec &a) const {
+	return ops_t::All(*this, a, [](const type l, const type r) { return l == r; });
 }
 
 //-------------------------
-// eoeVec3::Compare
-// returns true for x,y,z match within range of epsilon
+// eoeVec::Compare
+// returns true for component match within range of epsilon
 //-------------------------
-inline bool eoeVec3::Compare(const eoeVec3 &a, const float epsilon) const {
-
-	if (SDL_fabs(x - a.x) > epsilon)
-		return false;
-
-	if (SDL_fabs(y - a.y) > epsilon)
-		return false;
-
-	if (SDL_fabs(z - a.z) > epsilon)
-		return false;
-
-	return true;
+template<typename type, int size>
+inline bool eoeVec<type, size>::Compare(const eoeVec &a, const float epsilon) const {
+	return ops_t::All(*this, a, [epsilon](const type l, const type r) { return !(SDL_fabs(l - r) > epsilon); });
 }
 
 //-------------------------
-// eoeVec3::operator[]
-// returns x for [0], y for [1], and z for [2]
+// eoeVec::operator[]
+// returns x for [0], y for [1], z for [2], and w for [3]
 // undefined behavior for index out of bounds
 //-------------------------
-inline float eoeVec3::operator[](const int index) const {
-	return (&x)[index];
+template<typename type, int size>
+inline type eoeVec<type, size>::operator[](const int index) const {
+	return (&this->x)[index];
 }
 
 //-------------------------
-// eoeVec3::operator[]
-// returns x for [0], y for [1], and z for [2]
+// eoeVec::operator[]
+// returns x for [0], y for [1], z for [2], and w for [3]
 // undefined behavior for index out of bounds
 //-------------------------
-inline float & eoeVec3::operator[](const int index) {
-	return (&x)[index];
+template<typename type, int size>
+inline type & eoeVec<type, size>::operator[](const int index) {
+	return (&this->x)[index];
 }
 
 //-------------------------
-// eoeVec3::operator==
+// eoeVec::operator==
 // returns the result of Compare without epsilon
 //-------------------------
-inline bool eoeVec3::operator==(const eoeVec3 &a) const {
+template<typename type, int size>
+inline constexpr bool eoeVec<type, size>::operator==(const eoeVec &a) const {
 	return Compare(a);
 }
 
 //-------------------------
-// eoeVec3::operator!=
+// eoeVec::operator!=
 // returns the negated result of Compare without epsilon
 //-------------------------
-inline bool eoeVec3::operator!=(const eoeVec3 &a) const {
+template<typename type, int size>
+inline constexpr bool eoeVec<type, size>::operator!=(const eoeVec &a) const {
 	return !Compare(a);
 }
 
 //-------------------------
-// eoeVec3::Length
-// returns vector length
+// eoeVec::Dot
+// returns the dot product of *this and a
 //-------------------------
-inline float eoeVec3::Length() const {
-	return SDL_sqrtf(x * x + y * y + z * z);
+template<typename type, int size>
+inline constexpr type eoeVec<type, size>::Dot(const eoeVec &a) const {
+	return ops_t::Dot(*this, a);
 }
 
 //-------------------------
-// eoeVec3::LengthSquared
-// returns vector length squared
+// eoeVec::Scale
+// returns the component-wise product of *this and a
 //-------------------------
-inline float eoeVec3::LengthSquared() const {
-	return (x * x + y * y + z * z);
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::Scale(const eoeVec &a) const {
+	return ops_t::Zip(*this, a, [](const type l, const type r) { return l * r; });
 }
 
 //-------------------------
-// eoeVec3::Normalize
-// scales internal x,y, and z to unit length vector
-// returns normalized length of 0 or 1
+// eoeVec::Length
+// returns vector length
 //-------------------------
-inline float eoeVec3::Normalize() {
-	float sqrLength, invLength;
-
-	sqrLength = x * x + y * y + z * z;
-	sqrLength = SDL_sqrtf(sqrLength);
-
-	if (sqrLength == 0)
-		invLength = 0;
+template<typename type, int size>
+inline type eoeVec<type, size>::Length() const {
+	static_assert(std::is_floating_point<type>::value, "Length of an integer vector, see ManhattanLength or ChebyshevLength");
+	if constexpr (std::is_same<type, float>::value)
+		return SDL_sqrtf(LengthSquared());
 	else
-		invLength = 1.0f / sqrLength;
-
-	x *= invLength;
-	y *= invLength;
-	z *= invLength;
-	return invLength * sqrLength;
-}
-
-//-------------------------
-// eoeVec3::operator-
-// returns eoeVec3 with negated x, y, and z
-//-------------------------
-inline eoeVec3 eoeVec3::operator-() const {
-	return eoeVec3(-x, -y, -z);
-}
-
-//-------------------------
-// eoeVec3::operator-
-// returns an eoeVec3 using the difference between two vectors' x, y, and z
-//-------------------------
-inline eoeVec3 eoeVec3::operator-(const eoeVec3 &a) const {
-	return eoeVec3(x - a.x, y - a.y, z - a.z);
+		return SDL_sqrt(LengthSquared());
 }
 
 //-------------------------
-// eoeVec3::operator*
-// returns the dot product of two eoeVec3s
-//-------------------------
-inline float eoeVec3::operator*(const eoeVec3 &a) const {
-	return x * a.x + y * a.y + z * a.z;
-}
-
-//-------------------------
-// eoeVec3::operator*
-// returns an eoeVec3 with x, y, and z scaled by a
-//-------------------------
-inline eoeVec3 eoeVec3::operator*(const float a) const {
-	return eoeVec3(x * a, y * a, z * a);
-}
-
-//-------------------------
-// eoeVec3::operator/
-// returns an eoeVec3 with de-scaled x, y, and z by a
-// DEBUG: allows divide by zero errors to occur
-//-------------------------
-inline eoeVec3 eoeVec3::operator/(const float a) const {
-	float inva = 1.0f / a;
-	return eoeVec3(x * inva, y * inva, z * inva);
-}
-
-//-------------------------
-// eoeVec3::operator+
-// returns an eoeVec3 using the sum of two eoeVec3's x, y, and z
+// eoeVec::LengthSquared
+// returns vector length squared
 //-------------------------
-inline eoeVec3 eoeVec3::operator+(const eoeVec3 &a) const {
-	return eoeVec3(x + a.x, y + a.y, z + a.z);
+template<typename type, int size>
+inline constexpr type eoeVec<type, size>::LengthSquared() const {
+	return ops_t::Dot(*this, *this);
 }
 
 //-------------------------
-// eoeVec3::operator+=
-// returns this with x, y, and z added to an eoeVec3's x, y, and z
+// eoeVec::ManhattanLength
+// returns the sum of the absolute components, the steps between 4-connected tiles
 //-------------------------
-inline eoeVec3 & eoeVec3::operator+=(const eoeVec3 &a) {
-	x += a.x;
-	y += a.y;
-	z += a.z;
-	return *this;
+template<typename type, int size>
+inline constexpr type eoeVec<type, size>::ManhattanLength() const {
+	const eoeVec absolute = ops_t::Map(*this, [](const type a) { return a < type(0) ? -a : a; });
+	if constexpr (size == 2)
+		return absolute.x + absolute.y;
+	else if constexpr (size == 3)
+		return absolute.x + absolute.y + absolute.z;
+	else
+		return absolute.x + absolute.y + absolute.z + absolute.w;
 }
 
 //-------------------------
-// eoeVec3::operator/=
-// returns this with x, y, and z de-scaled by a
-// DEBUG: allows divide by zero errors to occur
+// eoeVec::ChebyshevLength
+// returns the largest absolute component, the steps between 8-connected tiles
 //-------------------------
-inline eoeVec3 & eoeVec3::operator/=(const float a) {
-	float inva = 1.0f / a;
-	x *= inva;
-	y *= inva;
-	z *= inva;
-	return *this;
+template<typename type, int size>
+inline constexpr type eoeVec<type, size>::ChebyshevLength() const {
+	const eoeVec absolute = ops_t::Map(*this, [](const type a) { return a < type(0) ? -a : a; });
+	type length = absolute.x > absolute.y ? absolute.x : absolute.y;
+	if constexpr (size >= 3)
+		length = absolute.z > length ? absolute.z : length;
+	if constexpr (size == 4)
+		length = absolute.w > length ? absolute.w : length;
+	return length;
 }
 
 //-------------------------
-// eoeVec3::operator-=
-// returns this with x, y, and z subtracted by another eoeVec3's x, y, and z
+// eoeVec::Normalize
+// scales internal components to unit length vector
+// returns normalized length of 0 or 1
 //-------------------------
-inline eoeVec3 & eoeVec3::operator-=(const eoeVec3 &a) {
-	x -= a.x;
-	y -= a.y;
-	z -= a.z;
-	return *this;
-}
+template<typename type, int size>
+inline type eoeVec<type, size>::Normalize() {
+	static_assert(std::is_floating_point<type>::value, "Normalize of an integer vector");
+	const type sqrLength = LengthSquared();
+	type invLength;
+	if constexpr (std::is_same<type, float>::value)
+		invLength = (sqrLength == 0.0f) ? 0.0f : eoeMath::RSqrt(sqrLength);
+	else
+		invLength = (sqrLength == 0.0) ? 0.0 : 1.0 / SDL_sqrt(sqrLength);
 
-//-------------------------
-// eoeVec3::operator*=
-// returns this with x, y, and z scaled by a
-//-------------------------
-inline eoeVec3 & eoeVec3::operator*=(const float a) {
-	x *= a;
-	y *= a;
-	z *= a;
-	return *this;
+	*this *= invLength;
+	return invLength * invLength * sqrLength;
 }
 
 //-------------------------
-// eoeVec3::Cross
-// returns the an eoeVec3 that is the cross product of *this with another eoeVec3
+// eoeVec::Normalized
+// scales a copy of the components to unit length vector
 //-------------------------
-inline eoeVec3 eoeVec3::Cross(const eoeVec3 &a) const {
-	return eoeVec3( y * a.z - z * a.y, z * a.x - x * a.z, x * a.y - y * a.x);
+template<typename type, int size>
+inline eoeVec<type, size> eoeVec<type, size>::Normalized() const {
+	eoeVec result = *this;
+	result.Normalize();
+	return result;
 }
 
 //-------------------------
-// eoeVec3::Cross
-// sets *this to the cross product of two eoeVec3s
+// eoeVec::Clamp01
+// clamps each component into range [0,1]
 //-------------------------
-inline eoeVec3 & eoeVec3::Cross(const eoeVec3 &a, const eoeVec3 &b) {
-	x = a.y * b.z - a.z * b.y;
-	y = a.z * b.x - a.x * b.z;
-	z = a.x * b.y - a.y * b.x;
-	return *this;
+template<typename type, int size>
+inline void eoeVec<type, size>::Clamp01() {
+	*this = ops_t::Map(*this, [](const type a) { return a < type(0) ? type(0) : (a > type(1) ? type(1) : a); });
 }
 
 //-------------------------
-// eoeVec3::SnapInt
-// moves x, y, and z to the nearest integer value
+// eoeVec::operator-
+// returns an eoeVec with negated components
 //-------------------------
-inline void eoeVec3::SnapInt() {
-	x = floorf(x + 0.5f);
-	y = floorf(y + 0.5f);
-	z = floorf(z + 0.5f);
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::operator-() const {
+	return ops_t::Map(*this, [](const type a) { return -a; });
 }
 
-
-//--------------------------------------------
-//
-//
-//					eoeVec4
-//		--position vector behavior--
-//
-//
-//--------------------------------------------
-class eoeVec4 {
-public:
-
-	float				x = 0.0f;
-	float				y = 0.0f;
-	float				z = 0.0f;
-	float				w = 0.0f;
-
-						eoeVec4() = default;
-						eoeVec4(const float x, const float y, const float z, const float w);
-
-	void				Set(const float x, const float y, const float z, const float w);
-	void				Zero();
-	void				Clamp01();
-
-	float				operator[](const int index) const;
-	float &				operator[](const int index);
-	eoeVec4				operator-() const;
-	eoeVec4				operator*(const eoeVec4 &a) const;
-	eoeVec4				operator*(const float a) const;
-	eoeVec4				operator/(const eoeVec4 &a) const;
-	eoeVec4				operator/(const float a) const;
-	eoeVec4				operator+(const eoeVec4 &a) const;
-	eoeVec4				operator-(const eoeVec4 &a) const;
-	eoeVec4 &			operator+=(const eoeVec4 &a);
-	eoeVec4 &			operator-=(const eoeVec4 &a);
-	eoeVec4 &			operator/=(const eoeVec4 &a);
-	eoeVec4 &			operator/=(const float a);
-	eoeVec4 &			operator*=(const eoeVec4 &a);
-	eoeVec4 &			operator*=(const float a);	
-
-	const float *		ToFloatPtr() const;
-	float *				ToFloatPtr();
-
-	bool				Compare(const eoeVec4 &a) const;
-	bool				Compare(const eoeVec4 &a, const float epsilon) const;
-	bool				operator==(const eoeVec4 &a) const;
-	bool				operator!=(const eoeVec4 &a) const;
-
-	void				SnapInt();
-};
-
 //-------------------------
-// eoeVec4::eoeVec4
+// eoeVec::operator-
+// returns an eoeVec using the difference between two vectors' components
 //-------------------------
-inline eoeVec4::eoeVec4(const float x, const float y, const float z, const float w)
-	: x(x),
-	  y(y),
-	  z(z),
-	  w(w) {
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::operator-(const eoeVec &a) const {
+	return ops_t::Zip(*this, a, [](const type l, const type r) { return l - r; });
 }
 
 //-------------------------
-// eoeVec4::Set
-// modifies the current x, y, z, and w values
+// eoeVec::operator*
+// returns the dot product of two eoeVec2s or eoeVec3s
+// or the component-wise product of two eoeVec4s
 //-------------------------
-inline void eoeVec4::Set(const float x, const float y, const float z, const float w) {
-	this->x = x;
-	this->y = y;
-	this->z = z;
-	this->w = w;
+template<typename type, int size>
+inline constexpr typename eoeVec<type, size>::product_t eoeVec<type, size>::operator*(const eoeVec &a) const {
+	if constexpr (size == 4)
+		return Scale(a);
+	else
+		return Dot(a);
 }
 
 //-------------------------
-// eoeVec4::Zero
-// sets x, y, z, and w to zero
+// eoeVec::operator*
+// returns an eoeVec with each component scaled by a
 //-------------------------
-inline void eoeVec4::Zero() {
-	x = 0.0f;
-	y = 0.0f;
-	z = 0.0f;
-	w = 0.0f;
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::operator*(const type a) const {
+	return ops_t::Map(*this, [a](const type l) { return l * a; });
 }
 
 //-------------------------
-// eoeVec4::Compare
-// returns true for exact x,y,z,w match
+// eoeVec::operator/
+// returns an eoeVec with each component divided by those of a
+// DEBUG: allows divide by zero errors to occur
 //-------------------------
-inline bool eoeVec4::Compare(const eoeVec4 &a) const {
-	return ((x == a.x) && (y == a.y) && (z == a.z) && (w == a.w));
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::operator/(const eoeVec &a) const {
+	return ops_t::Zip(*this, a, [](const type l, const type r) { return l / r; });
 }
 
 //-------------------------
-// eoeVec4::Compare
-// returns true for x,y,z,w match within range of epsilon
+// eoeVec::operator/
+// returns an eoeVec with de-scaled components by a
+// floating point scales by 1 / a, integers divide exactly
+// DEBUG: allows divide by zero errors to occur
 //-------------------------
-inline bool eoeVec4::Compare(const eoeVec4 &a, const float epsilon) const {
-
-	if (SDL_fabs(x - a.x) > epsilon)
-		return false;
-
-	if (SDL_fabs(y - a.y) > epsilon)
-		return false;
-
-	if (SDL_fabs(z - a.z) > epsilon)
-		return false;
-
-	if (SDL_fabs(w - a.w) > epsilon)
-		return false;
-
-	return true;
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::operator/(const type a) const {
+	if constexpr (std::is_floating_point<type>::value) {
+		const type inva = type(1) / a;
+		return *this * inva;
+	} else {
+		return ops_t::Map(*this, [a](const type l) { return l / a; });
+	}
 }
 
 //-------------------------
-// eoeVec4::operator[]
-// returns x for [0], y for [1], z for [2], and w for [3]
-// undefined behavior for index out of bounds
+// eoeVec::operator+
+// returns an eoeVec using the sum of two eoeVecs' components
 //-------------------------
-inline float eoeVec4::operator[](const int index) const {
-	return (&x)[index];
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::operator+(const eoeVec &a) const {
+	return ops_t::Zip(*this, a, [](const type l, const type r) { return l + r; });
 }
 
 //-------------------------
-// eoeVec4::operator[]
-// returns x for [0], y for [1], z for [2], and w for [3]
-// undefined behavior for index out of bounds
+// eoeVec::operator+=
+// returns this with each component added to those of a
 //-------------------------
-inline float & eoeVec4::operator[](const int index) {
-	return (&x)[index];
+template<typename type, int size>
+inline eoeVec<type, size> & eoeVec<type, size>::operator+=(const eoeVec &a) {
+	*this = *this + a;
+	return *this;
 }
 
 //-------------------------
-// eoeVec4::operator==
-// returns the result of Compare without epsilon
+// eoeVec::operator-=
+// returns this with each component subtracted by those of a
 //-------------------------
-inline bool eoeVec4::operator==(const eoeVec4 &a) const {
-	return Compare(a);
+template<typename type, int size>
+inline eoeVec<type, size> & eoeVec<type, size>::operator-=(const eoeVec &a) {
+	*this = *this - a;
+	return *this;
 }
 
 //-------------------------
-// eoeVec4::operator!=
-// returns the negated result of Compare without epsilon
+// eoeVec::operator/=
+// returns this with each component divided by those of a
+// DEBUG: allows divide by zero errors to occur
 //-------------------------
-inline bool eoeVec4::operator!=(const eoeVec4 &a) const {
-	return !Compare(a);
+template<typename type, int size>
+inline eoeVec<type, size> & eoeVec<type, size>::operator/=(const eoeVec &a) {
+	*this = *this / a;
+	return *this;
 }
 
 //-------------------------
-// eoeVec4::Clamp01
-// clamps x,y,z,w into range [0,1]
+// eoeVec::operator/=
+// returns this with each component de-scaled by a
+// DEBUG: allows divide by zero errors to occur
 //-------------------------
-inline void eoeVec4::Clamp01() {
-	x = x < 0.0f ? 0.0f : (x > 1.0f ? 1.0f : x);
-	y = y < 0.0f ? 0.0f : (y > 1.0f ? 1.0f : y);
-	z = z < 0.0f ? 0.0f : (z > 1.0f ? 1.0f : z);
-	w = w < 0.0f ? 0.0f : (w > 1.0f ? 1.0f : w);
+template<typename type, int size>
+inline eoeVec<type, size> & eoeVec<type, size>::operator/=(const type a) {
+	*this = *this / a;
+	return *this;
 }
 
 //-------------------------
-// eoeVec4::operator-
-// returns eoeVec4 with negated x, y, and z
+// eoeVec::operator*=
+// returns this with each component scaled by those of a
 //-------------------------
-inline eoeVec4 eoeVec4::operator-() const {
-	return eoeVec4(-x, -y, -z, -w);
+template<typename type, int size>
+inline eoeVec<type, size> & eoeVec<type, size>::operator*=(const eoeVec &a) {
+	*this = Scale(a);
+	return *this;
 }
 
 //-------------------------
-// eoeVec4::operator-
-// returns an eoeVec4 using the difference between two vectors' x, y, z, w
+// eoeVec::operator*=
+// returns this with each component scaled by a
 //-------------------------
-inline eoeVec4 eoeVec4::operator-(const eoeVec4 &a) const {
-	return eoeVec4(x - a.x, y - a.y, z - a.z, w - a.w);
+template<typename type, int size>
+inline eoeVec<type, size> & eoeVec<type, size>::operator*=(const type a) {
+	*this = *this * a;
+	return *this;
 }
 
-//-------------------------
-// eoeVec4::operator*
-// scaled each component of *this using param a
-//-------------------------
-inline eoeVec4 eoeVec4::operator*(const eoeVec4 &a) const {
-	return eoeVec4(x * a.x, y * a.y, z * a.z, w * a.w);
+//-----------------------------------
+// eoeVec::ToPtr
+// returns a pointer to the first component
+//-----------------------------------
+template<typename type, int size>
+inline const type * eoeVec<type, size>::ToPtr() const {
+	return &this->x;
 }
 
-//-------------------------
-// eoeVec4::operator*
-// returns an eoeVec4 with x, y, z, and w scaled by a
-//-------------------------
-inline eoeVec4 eoeVec4::operator*(const float a) const {
-	return eoeVec4(x * a, y * a, z * a, w * a);
+//-----------------------------------
+// eoeVec::ToPtr
+// returns a pointer to the first component
+//-----------------------------------
+template<typename type, int size>
+inline type * eoeVec<type, size>::ToPtr() {
+	return &this->x;
 }
 
-//-------------------------
-// eoeVec4::operator/
-// returns an eoeVec4 with de-scaled x, y, z, and w by param a
-// DEBUG: allows divide by zero errors to occur
-//-------------------------
-inline eoeVec4 eoeVec4::operator/(const eoeVec4 &a) const {
-	return eoeVec4(x / a.x, y / a.y, z / a.z, w / a.w);
+//-----------------------------------
+// eoeVec::ToFloatPtr
+// returns a pointer to the first component of a float vector
+//-----------------------------------
+template<typename type, int size>
+inline const float * eoeVec<type, size>::ToFloatPtr() const {
+	static_assert(std::is_same<type, float>::value, "ToFloatPtr of a non-float vector, see ToPtr");
+	return &this->x;
 }
 
-//-------------------------
-// eoeVec4::operator/
-// returns an eoeVec4 with de-scaled x, y, z, and w by param a
-// DEBUG: allows divide by zero errors to occur
-//-------------------------
-inline eoeVec4 eoeVec4::operator/(const float a) const {
-	float inva = 1.0f / a;
-	return eoeVec4(x * inva, y * inva, z * inva, w * inva);
+//-----------------------------------
+// eoeVec::ToFloatPtr
+// returns a pointer to the first component of a float vector
+//-----------------------------------
+template<typename type, int size>
+inline float * eoeVec<type, size>::ToFloatPtr() {
+	static_assert(std::is_same<type, float>::value, "ToFloatPtr of a non-float vector, see ToPtr");
+	return &this->x;
 }
 
 //-------------------------
-// eoeVec4::operator+
-// returns an eoeVec4 using the sum of two eoeVec4's x, y, z, and w
+// eoeVec::Cross
+// returns the an eoeVec3 that is the cross product of *this with another eoeVec3
 //-------------------------
-inline eoeVec4 eoeVec4::operator+(const eoeVec4 &a) const {
-	return eoeVec4(x + a.x, y + a.y, z + a.z, w + a.w);
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::Cross(const eoeVec &a) const {
+	static_assert(size == 3, "Cross is only defined for 3 components");
+	return eoeVec(this->y * a.z - this->z * a.y, this->z * a.x - this->x * a.z, this->x * a.y - this->y * a.x);
 }
 
 //-------------------------
-// eoeVec4::operator+=
-// returns this with x, y, z, and w added with those of param a
+// eoeVec::Cross
+// sets *this to the cross product of two eoeVec3s
 //-------------------------
-inline eoeVec4 & eoeVec4::operator+=(const eoeVec4 &a) {
-	x += a.x;
-	y += a.y;
-	z += a.z;
-	w += a.w;
+template<typename type, int size>
+inline eoeVec<type, size> & eoeVec<type, size>::Cross(const eoeVec &a, const eoeVec &b) {
+	*this = a.Cross(b);
 	return *this;
 }
 
 //-------------------------
-// eoeVec4::operator/=
-// returns this with x, y, z, and w de-scaled by a
-// DEBUG: allows divide by zero errors to occur
+// eoeVec::FloorDiv
+// integer division rounding toward negative infinity, unlike operator/
+// eg: the tile (or chunk) holding a coordinate, eoeVec2i(-1, 5).FloorDiv(4) == eoeVec2i(-1, 1)
+// DEBUG: divisor must be positive
 //-------------------------
-inline eoeVec4 & eoeVec4::operator/=(const eoeVec4 &a) {
-	x /= a.x;
-	y /= a.y;
-	z /= a.z;
-	w /= a.w;
-	return *this;
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::FloorDiv(const type divisor) const {
+	static_assert(std::is_integral<type>::value, "FloorDiv of a floating point vector, see SnapInt");
+	return ops_t::Map(*this, [divisor](const type a) { return (a >= 0 ? a : a - divisor + 1) / divisor; });
 }
 
 //-------------------------
-// eoeVec4::operator/=
-// returns this with x, y, z, and w de-scaled by a
-// DEBUG: allows divide by zero errors to occur
+// eoeVec::FloorMod
+// remainder matching FloorDiv, always in [0, divisor)
+// eg: the position within a tile, eoeVec2i(-1, 5).FloorMod(4) == eoeVec2i(3, 1)
+// DEBUG: divisor must be positive
 //-------------------------
-inline eoeVec4 & eoeVec4::operator/=(const float a) {
-	float inva = 1.0f / a;
-	x *= inva;
-	y *= inva;
-	z *= inva;
-	w *= inva;
-	return *this;
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::FloorMod(const type divisor) const {
+	static_assert(std::is_integral<type>::value, "FloorMod of a floating point vector");
+	return ops_t::Map(*this, [divisor](const type a) {
+		const type remainder = a % divisor;
+		return remainder < 0 ? remainder + divisor : remainder;
+	});
 }
 
 //-------------------------
-// eoeVec4::operator-=
-// returns this with x, y, z, and w subtracted by those of param a
+// eoeVec::SnapInt
+// moves each component to the nearest integer value, integer vectors are unchanged
 //-------------------------
-inline eoeVec4 & eoeVec4::operator-=(const eoeVec4 &a) {
-	x -= a.x;
-	y -= a.y;
-	z -= a.z;
-	w -= a.w;
-	return *this;
+template<typename type, int size>
+inline void eoeVec<type, size>::SnapInt() {
+	if constexpr (std::is_same<type, float>::value)
+		*this = ops_t::Map(*this, [](const float a) { return floorf(a + 0.5f); });
+	else if constexpr (std::is_floating_point<type>::value)
+		*this = ops_t::Map(*this, [](const type a) { return (type)SDL_floor(a + 0.5); });
 }
 
 //-------------------------
-// eoeVec4::operator*=
-// returns this with x, y, z, and w scaled by those of param a
+// eoeVec::Min
+// returns the smaller of each pair of components
 //-------------------------
-inline eoeVec4 & eoeVec4::operator*=(const eoeVec4 &a) {
-	x *= a.x;
-	y *= a.y;
-	z *= a.z;
-	w *= a.w;
-	return *this;
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::Min(const eoeVec &a, const eoeVec &b) {
+	return ops_t::Zip(a, b, [](const type l, const type r) { return r < l ? r : l; });
 }
 
 //-------------------------
-// eoeVec4::operator*=
-// returns this with x, y, z, and w scaled by a
+// eoeVec::Max
+// returns the larger of each pair of components
 //-------------------------
-inline eoeVec4 & eoeVec4::operator*=(const float a) {
-	x *= a;
-	y *= a;
-	z *= a;
-	w *= a;
-	return *this;
+template<typename type, int size>
+inline constexpr eoeVec<type, size> eoeVec<type, size>::Max(const eoeVec &a, const eoeVec &b) {
+	return ops_t::Zip(a, b, [](const type l, const type r) { return r > l ? r : l; });
 }
 
-//-----------------------------------
-// eoeVec4::ToFloatPtr
-// returns a pointer to the first element of the matrix
-//-----------------------------------
-inline const float * eoeVec4::ToFloatPtr() const {
-	return &x;
-}
+// storage order of an eoeMatrix4, see Matrix.h
+enum eoeMat4Layout_t {
+	MAT4_ROW_MAJOR,
+	MAT4_COLUMN_MAJOR
+};
 
-//-----------------------------------
-// eoeVec4::ToFloatPtr
-// returns a pointer to the first element of the matrix
-//-----------------------------------
-inline float * eoeVec4::ToFloatPtr() {
-	return &x;
-}
+template<eoeMat4Layout_t layout>
+class eoeMatrix4;
 
-//-------------------------
-// eoeVec4::SnapInt
-// moves x, y, z, and w to the nearest integer value
-//-------------------------
-inline void eoeVec4::SnapInt() {
-	x = floorf(x + 0.5f);
-	y = floorf(y + 0.5f);
-	z = floorf(z + 0.5f);
-	w = floorf(w + 0.5f);
-}
+typedef eoeMatrix4<MAT4_ROW_MAJOR>		eoeMat4;
 
 //--------------------------------------------
 //
@@ -942,8 +767,9 @@ inline void eoeVec4::SnapInt() {
 // --only deals with unit length quaternions--
 //			used for quick rotations
 //
+// 16-byte aligned like eoeVec4
 //--------------------------------------------
-class eoeQuat {
+class alignas(16) eoeQuat {
 public:
 
 	float				x = 0.0f;
@@ -952,29 +778,37 @@ public:
 	float				w = 0.0f;
 
 						eoeQuat() = default;
-	explicit			eoeQuat(const float x, const float y, const float z, const float w);
-	explicit			eoeQuat(const eoeVec3 vector, const float scalar);
+	explicit constexpr	eoeQuat(const float x, const float y, const float z, const float w);
+	explicit constexpr	eoeQuat(const eoeVec3 vector, const float scalar);
 
-	eoeQuat				Inverse() const;
+	constexpr eoeQuat	Inverse() const;
 	void				Set(const float x, const float y, const float z, const float w);
+	constexpr float		Dot(const eoeQuat & a) const;
+	float				Normalize();
+	eoeMat4				ToMat4() const;
 
 	float				operator[](const int index) const;
 	float &				operator[](const int index);
-	eoeQuat				operator*(const eoeQuat &a) const;
-	eoeVec3				operator*(const eoeVec3 &a) const;
-	eoeVec2				operator*(const eoeVec2 &a) const;
+	constexpr eoeQuat	operator*(const eoeQuat &a) const;
+	constexpr eoeVec3	operator*(const eoeVec3 &a) const;
+	constexpr eoeVec2	operator*(const eoeVec2 &a) const;
 	eoeQuat &			operator*=(const eoeQuat &a);
 
 	static eoeVec3		Rotate(const eoeVec3 & rotationAxis, float degrees, const eoeVec3 & toRotate);
 	static eoeVec2		Rotate(const eoeVec3 & rotationAxis, float degrees, const eoeVec2 & toRotate);
 	static void			Rotate(const eoeVec3 & rotationAxis, float degrees, eoeVec3 & toRotate);
 	static void			Rotate(const eoeVec3 & rotationAxis, float degrees, eoeVec2 & toRotate);
+
+	static eoeQuat		FromAxisAngle(const eoeVec3 & rotationAxis, float degrees);
+	static eoeQuat		Nlerp(const eoeQuat & from, const eoeQuat & to, const float fraction);
+	static eoeQuat		Slerp(const eoeQuat & from, const eoeQuat & to, const float fraction);
+	static eoeQuat		SlerpFast(const eoeQuat & from, const eoeQuat & to, const float fraction);
 };
 
 //-------------------------
 // eoeQuat::eoeQuat
 //-------------------------
-inline eoeQuat::eoeQuat(const float x, const float y, const float z, const float w)
+inline constexpr eoeQuat::eoeQuat(const float x, const float y, const float z, const float w)
 	: x(x),
 	  y(y),
 	  z(z),
@@ -984,13 +818,15 @@ inline eoeQuat::eoeQuat(const float x, const float y, const float z, const float
 //-------------------------
 // eoeQuat::eoeQuat
 //-------------------------
-inline eoeQuat::eoeQuat(const eoeVec3 vector, const float scalar)
+inline constexpr eoeQuat::eoeQuat(const eoeVec3 vector, const float scalar)
 	: x(vector.x),
 	  y(vector.y),
 	  z(vector.z),
 	  w(scalar) {
 }
 
+inline constexpr eoeQuat quat_identity	( 0.0f, 0.0f, 0.0f, 1.0f );
+
 //-------------------------
 // eoeQuat::operator[]
 // returns x for [0], y for [1], z for [2], and w for [3]
@@ -1014,7 +850,7 @@ inline float & eoeQuat::operator[](const int index) {
 // returns an eoeQuat set to the Grassman product of *this with another eoeQuat
 // this*a = q*p = [ (qs*pv + ps*qv + qv X pv) (qs*ps - qv.pv) ]
 //-------------------------
-inline eoeQuat eoeQuat::operator*(const eoeQuat &a) const {
+inline constexpr eoeQuat eoeQuat::operator*(const eoeQuat &a) const {
 	return eoeQuat(w*a.x + x*a.w + y*a.z - z*a.y,
 				 w*a.y + y*a.w + z*a.x - x*a.z,
 				 w*a.z + z*a.w + x*a.y - y*a.x,
@@ -1040,7 +876,7 @@ inline eoeQuat & eoeQuat::operator*=(const eoeQuat &a) {
 // assumes a right-handed coordinate system
 // --only deals with unit length quaternions--
 //-------------------------
-inline eoeVec3 eoeQuat::operator*(const eoeVec3 &a) const {
+inline constexpr eoeVec3 eoeQuat::operator*(const eoeVec3 &a) const {
 	float xxzz = x*x - z*z;
 	float wwyy = w*w - y*y;
 
@@ -1067,7 +903,7 @@ inline eoeVec3 eoeQuat::operator*(const eoeVec3 &a) const {
 // assumes a right-handed coordinate system
 // --only deals with unit length quaternions--
 //-------------------------
-inline eoeVec2 eoeQuat::operator*(const eoeVec2 &a) const {
+inline constexpr eoeVec2 eoeQuat::operator*(const eoeVec2 &a) const {
 	float xxzz = x*x - z*z;
 	float wwyy = w*w - y*y;
 
@@ -1085,7 +921,7 @@ inline eoeVec2 eoeQuat::operator*(const eoeVec2 &a) const {
 // returns an eoeQuat that is the inverse of *this
 // unit length quaternion have inverse == conjugate
 //-------------------------
-inline eoeQuat eoeQuat::Inverse() const {
+inline constexpr eoeQuat eoeQuat::Inverse() const {
 	return eoeQuat(-x, -y, -z, w);
 }
 
@@ -1100,5 +936,94 @@ inline void eoeQuat::Set(const float x, const float y, const float z, const floa
 	this->w = w;
 }
 
+//-------------------------
+// eoeQuat::Dot
+// returns the 4D dot product of *this and a
+// the cosine of half the angle between two unit length rotations
+//-------------------------
+inline constexpr float eoeQuat::Dot(const eoeQuat & a) const {
+	return x * a.x + y * a.y + z * a.z + w * a.w;
+}
+
+//-------------------------
+// eoeQuat::Normalize
+// scales internal x, y, z, and w to unit length
+// undoes drift from repeated multiplication and Nlerp
+// returns normalized length of 0 or 1
+//-------------------------
+inline float eoeQuat::Normalize() {
+	const float sqrLength = x * x + y * y + z * z + w * w;
+	const float invLength = (sqrLength == 0.0f) ? 0.0f : eoeMath::RSqrt(sqrLength);
+
+	x *= invLength;
+	y *= invLength;
+	z *= invLength;
+	w *= invLength;
+	return invLength * invLength * sqrLength;
+}
+
+//-------------------------
+// eoeQuat::FromAxisAngle
+// returns the rotation of degrees counter-clockwise about rotationAxis
+// DEBUG: assumes rotationAxis is unit length
+//-------------------------
+inline eoeQuat eoeQuat::FromAxisAngle(const eoeVec3 & rotationAxis, float degrees) {
+	float sin, cos;
+	eoeMath::SinCosFast(eoeMath::ToRadians(degrees) * 0.5f, sin, cos);
+	return eoeQuat(rotationAxis * sin, cos);
+}
+
+//-------------------------
+// eoeQuat::Nlerp
+// normalized linear interpolation along the shortest path from from to to
+// constant-speed only approximately, but cheaper than Slerp and
+// commutative when blending more than two rotations
+//-------------------------
+inline eoeQuat eoeQuat::Nlerp(const eoeQuat & from, const eoeQuat & to, const float fraction) {
+	const float fromScale = 1.0f - fraction;
+	const float toScale = (from.Dot(to) < 0.0f) ? -fraction : fraction;
+
+	eoeQuat result(from.x * fromScale + to.x * toScale,
+				   from.y * fromScale + to.y * toScale,
+				   from.z * fromScale + to.z * toScale,
+				   from.w * fromScale + to.w * toScale);
+	result.Normalize();
+	return result;
+}
+
+//-------------------------
+// eoeQuat::SlerpFast
+// Slerp on the eoeMath fast tier, what the batch eoeMath::SlerpFast computes bit-for-bit
+// picks between the slerp and nlerp weights instead of branching, and always
+// normalizes, which also removes the drift of the polynomial weights
+// max angular error about 1e-5 radians against Slerp
+//-------------------------
+inline eoeQuat eoeQuat::SlerpFast(const eoeQuat & from, const eoeQuat & to, const float fraction) {
+	const float dot = from.Dot(to);
+	const float cosOmega = fabsf(dot);
+	const float sinSquared = 1.0f - cosOmega * cosOmega;
+	const float sinOmega = sqrtf(sinSquared > 0.0f ? sinSquared : 0.0f);
+	const float omega = eoeMath::ATan2Fast(sinOmega, cosOmega);
+	const float invSinOmega = 1.0f / sinOmega;
+
+	float sinFrom;
+	float sinTo;
+	float cos;		// unused, deliberately mirrors the branch-free SIMD kernels, which get sin and cos together per lane
+	eoeMath::SinCosFast((1.0f - fraction) * omega, sinFrom, cos);
+	eoeMath::SinCosFast(fraction * omega, sinTo, cos);
+
+	const bool nearlyEqual = cosOmega > 0.9995f;
+	const float fromScale = nearlyEqual ? 1.0f - fraction : sinFrom * invSinOmega;
+	float toScale = nearlyEqual ? fraction : sinTo * invSinOmega;
+	toScale = (dot < 0.0f) ? -toScale : toScale;
+
+	eoeQuat result(from.x * fromScale + to.x * toScale,
+				   from.y * fromScale + to.y * toScale,
+				   from.z * fromScale + to.z * toScale,
+				   from.w * fromScale + to.w * toScale);
+	result.Normalize();
+	return result;
+}
+
 #endif /* EOECORE_VECTOR_H */
 
@@ -0,0 +1,348 @@
+#ifndef EOECORE_VECTOR_EXPRESSION_H
+#define EOECORE_VECTOR_EXPRESSION_H
+
+#include "Vector.h"
+
+// lazily evaluated arithmetic over whole arrays of eoeVecs
+// eg: positions = positions + velocities * dt - drag;
+// builds a small tree of expression objects at compile time, then the assignment
+// walks every element once, each element running the same eoeVec operators
+// a single-vector expression would, so nothing is stored between operators
+// and the results match the single-vector code exactly
+// DEBUG: every span in one expression must have the same Num()
+
+//--------------------------------------------
+//			eoeVecExpr
+// base of every node that can appear in a span
+// expression, expr_t supplies Get(index) and Num()
+//--------------------------------------------
+template<typename expr_t>
+struct eoeVecExpr {
+	constexpr const expr_t &	Self() const { return static_cast<const expr_t &>(*this); }
+};
+
+//--------------------------------------------
+//
+//
+//				eoeVecSpan
+//	   --pointer and count over packed eoeVecs--
+//
+//
+// the leaf of span expressions, vec_t may be const to read only
+// assigning an expression evaluates it into the span in one pass
+//--------------------------------------------
+template<typename vec_t>
+class eoeVecSpan : public eoeVecExpr<eoeVecSpan<vec_t>> {
+public:
+
+	typedef typename std::remove_const<vec_t>::type	value_t;
+
+						eoeVecSpan(vec_t * data, const int num) : data(data), num(num) {}
+						eoeVecSpan(const eoeVecSpan & other) = default;
+
+	int					Num() const { return num; }
+	vec_t *				Data() const { return data; }
+	vec_t &				operator[](const int index) const { return data[index]; }
+	value_t				Get(const int index) const { return data[index]; }
+
+	template<typename expr_t>
+	eoeVecSpan &		operator=(const eoeVecExpr<expr_t> & expr);
+	eoeVecSpan &		operator=(const eoeVecSpan & other);
+	template<typename expr_t>
+	eoeVecSpan &		operator+=(const eoeVecExpr<expr_t> & expr);
+	template<typename expr_t>
+	eoeVecSpan &		operator-=(const eoeVecExpr<expr_t> & expr);
+	eoeVecSpan &		operator*=(const typename value_t::component_t scale);
+
+private:
+
+	vec_t *				data;
+	int					num;
+};
+
+//--------------------------------------------
+//			eoeScalarSpan
+// per-element scale factors for span expressions
+// eg: velocities * eoeScalarSpan<float>(dts, num)
+//--------------------------------------------
+template<typename type>
+class eoeScalarSpan {
+public:
+
+						eoeScalarSpan(const type * data, const int num) : data(data), num(num) {}
+
+	int					Num() const { return num; }
+	type				Get(const int index) const { return data[index]; }
+
+private:
+
+	const type *		data;
+	int					num;
+};
+
+//--------------------------------------------
+//			eoeVecBroadcast
+// one eoeVec repeated for every element
+//--------------------------------------------
+template<typename vec_t>
+class eoeVecBroadcast : public eoeVecExpr<eoeVecBroadcast<vec_t>> {
+public:
+
+	typedef vec_t		value_t;
+
+	explicit constexpr	eoeVecBroadcast(const vec_t & value) : value(value) {}
+
+	constexpr int		Num() const { return -1; }
+	constexpr vec_t		Get(const int) const { return value; }
+
+private:
+
+	vec_t				value;
+};
+
+//--------------------------------------------
+//			eoeVecBinaryExpr
+// op_t::Apply of the lhs and rhs elements, the
+// operands are held by value (spans are two words)
+// so an expression can safely outlive the statement
+//--------------------------------------------
+template<typename lhs_t, typename rhs_t, typename op_t>
+class eoeVecBinaryExpr : public eoeVecExpr<eoeVecBinaryExpr<lhs_t, rhs_t, op_t>> {
+public:
+
+	typedef typename lhs_t::value_t	value_t;
+
+	constexpr			eoeVecBinaryExpr(const lhs_t & lhs, const rhs_t & rhs) : lhs(lhs), rhs(rhs) {}
+
+	constexpr int		Num() const { return lhs.Num() >= 0 ? lhs.Num() : rhs.Num(); }
+	constexpr value_t	Get(const int index) const { return op_t::Apply(lhs.Get(index), rhs.Get(index)); }
+
+private:
+
+	lhs_t				lhs;
+	rhs_t				rhs;
+};
+
+//--------------------------------------------
+//			eoeVecScaleExpr
+// an expression's elements multiplied (or divided)
+// by a constant or an eoeScalarSpan
+//--------------------------------------------
+template<typename expr_t, typename scale_t, typename op_t>
+class eoeVecScaleExpr : public eoeVecExpr<eoeVecScaleExpr<expr_t, scale_t, op_t>> {
+public:
+
+	typedef typename expr_t::value_t	value_t;
+
+	constexpr			eoeVecScaleExpr(const expr_t & expr, const scale_t & scale) : expr(expr), scale(scale) {}
+
+	constexpr int		Num() const { return expr.Num(); }
+	constexpr value_t	Get(const int index) const { return op_t::Apply(expr.Get(index), GetScale(index)); }
+
+private:
+
+	constexpr auto		GetScale(const int index) const;
+
+private:
+
+	expr_t				expr;
+	scale_t				scale;
+};
+
+//--------------------------------------------
+//			eoeVecNegateExpr
+//--------------------------------------------
+template<typename expr_t>
+class eoeVecNegateExpr : public eoeVecExpr<eoeVecNegateExpr<expr_t>> {
+public:
+
+	typedef typename expr_t::value_t	value_t;
+
+	explicit constexpr	eoeVecNegateExpr(const expr_t & expr) : expr(expr) {}
+
+	constexpr int		Num() const { return expr.Num(); }
+	constexpr value_t	Get(const int index) const { return -expr.Get(index); }
+
+private:
+
+	expr_t				expr;
+};
+
+// element operations, each defers to the matching eoeVec operator
+struct eoeVecAddOp		{ template<typename vec_t> static constexpr vec_t Apply(const vec_t & a, const vec_t & b) { return a + b; } };
+struct eoeVecSubtractOp	{ template<typename vec_t> static constexpr vec_t Apply(const vec_t & a, const vec_t & b) { return a - b; } };
+struct eoeVecScaleOp	{ template<typename vec_t> static constexpr vec_t Apply(const vec_t & a, const vec_t & b) { return a.Scale(b); } };
+struct eoeVecMinOp		{ template<typename vec_t> static constexpr vec_t Apply(const vec_t & a, const vec_t & b) { return vec_t::Min(a, b); } };
+struct eoeVecMaxOp		{ template<typename vec_t> static constexpr vec_t Apply(const vec_t & a, const vec_t & b) { return vec_t::Max(a, b); } };
+struct eoeVecMultiplyOp	{ template<typename vec_t, typename type> static constexpr vec_t Apply(const vec_t & a, const type b) { return a * b; } };
+struct eoeVecDivideOp	{ template<typename vec_t, typename type> static constexpr vec_t Apply(const vec_t & a, const type b) { return a / b; } };
+
+//-------------------------
+// eoeVecScaleExpr::GetScale
+// returns the constant scale, or the index-th element of an eoeScalarSpan
+//-------------------------
+template<typename expr_t, typename scale_t, typename op_t>
+inline constexpr auto eoeVecScaleExpr<expr_t, scale_t, op_t>::GetScale(const int index) const {
+	if constexpr (std::is_arithmetic<scale_t>::value)
+		return scale;
+	else
+		return scale.Get(index);
+}
+
+//-------------------------
+// eoeVecSpan::operator=
+// evaluates expr for every element in a single pass
+// expr may read this span, each element is read before it is written
+//-------------------------
+template<typename vec_t>
+template<typename expr_t>
+inline eoeVecSpan<vec_t> & eoeVecSpan<vec_t>::operator=(const eoeVecExpr<expr_t> & expr) {
+	const expr_t & e = expr.Self();
+	for (int i = 0; i < num; ++i)
+		data[i] = e.Get(i);
+	return *this;
+}
+
+//-------------------------
+// eoeVecSpan::operator=
+// copies the elements of other, not the pointer, spans are views
+//-------------------------
+template<typename vec_t>
+inline eoeVecSpan<vec_t> & eoeVecSpan<vec_t>::operator=(const eoeVecSpan & other) {
+	for (int i = 0; i < num; ++i)
+		data[i] = other.data[i];
+	return *this;
+}
+
+//-------------------------
+// eoeVecSpan::operator+=
+//-------------------------
+template<typename vec_t>
+template<typename expr_t>
+inline eoeVecSpan<vec_t> & eoeVecSpan<vec_t>::operator+=(const eoeVecExpr<expr_t> & expr) {
+	const expr_t & e = expr.Self();
+	for (int i = 0; i < num; ++i)
+		data[i] += e.Get(i);
+	return *this;
+}
+
+//-------------------------
+// eoeVecSpan::operator-=
+//-------------------------
+template<typename vec_t>
+template<typename expr_t>
+inline eoeVecSpan<vec_t> & eoeVecSpan<vec_t>::operator-=(const eoeVecExpr<expr_t> & expr) {
+	const expr_t & e = expr.Self();
+	for (int i = 0; i < num; ++i)
+		data[i] -= e.Get(i);
+	return *this;
+}
+
+//-------------------------
+// eoeVecSpan::operator*=
+//-------------------------
+template<typename vec_t>
+inline eoeVecSpan<vec_t> & eoeVecSpan<vec_t>::operator*=(const typename value_t::component_t scale) {
+	for (int i = 0; i < num; ++i)
+		data[i] *= scale;
+	return *this;
+}
+
+// expression-building operators, each takes at least one eoeVecExpr
+// so single eoeVec arithmetic is untouched
+
+//-------------------------
+// operator+
+//-------------------------
+template<typename lhs_t, typename rhs_t>
+inline constexpr eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecAddOp> operator+(const eoeVecExpr<lhs_t> & lhs, const eoeVecExpr<rhs_t> & rhs) {
+	return eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecAddOp>(lhs.Self(), rhs.Self());
+}
+
+template<typename lhs_t, typename type, int size>
+inline constexpr eoeVecBinaryExpr<lhs_t, eoeVecBroadcast<eoeVec<type, size>>, eoeVecAddOp> operator+(const eoeVecExpr<lhs_t> & lhs, const eoeVec<type, size> & rhs) {
+	return eoeVecBinaryExpr<lhs_t, eoeVecBroadcast<eoeVec<type, size>>, eoeVecAddOp>(lhs.Self(), eoeVecBroadcast<eoeVec<type, size>>(rhs));
+}
+
+template<typename rhs_t, typename type, int size>
+inline constexpr eoeVecBinaryExpr<eoeVecBroadcast<eoeVec<type, size>>, rhs_t, eoeVecAddOp> operator+(const eoeVec<type, size> & lhs, const eoeVecExpr<rhs_t> & rhs) {
+	return eoeVecBinaryExpr<eoeVecBroadcast<eoeVec<type, size>>, rhs_t, eoeVecAddOp>(eoeVecBroadcast<eoeVec<type, size>>(lhs), rhs.Self());
+}
+
+//-------------------------
+// operator-
+//-------------------------
+template<typename lhs_t, typename rhs_t>
+inline constexpr eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecSubtractOp> operator-(const eoeVecExpr<lhs_t> & lhs, const eoeVecExpr<rhs_t> & rhs) {
+	return eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecSubtractOp>(lhs.Self(), rhs.Self());
+}
+
+template<typename lhs_t, typename type, int size>
+inline constexpr eoeVecBinaryExpr<lhs_t, eoeVecBroadcast<eoeVec<type, size>>, eoeVecSubtractOp> operator-(const eoeVecExpr<lhs_t> & lhs, const eoeVec<type, size> & rhs) {
+	return eoeVecBinaryExpr<lhs_t, eoeVecBroadcast<eoeVec<type, size>>, eoeVecSubtractOp>(lhs.Self(), eoeVecBroadcast<eoeVec<type, size>>(rhs));
+}
+
+template<typename rhs_t, typename type, int size>
+inline constexpr eoeVecBinaryExpr<eoeVecBroadcast<eoeVec<type, size>>, rhs_t, eoeVecSubtractOp> operator-(const eoeVec<type, size> & lhs, const eoeVecExpr<rhs_t> & rhs) {
+	return eoeVecBinaryExpr<eoeVecBroadcast<eoeVec<type, size>>, rhs_t, eoeVecSubtractOp>(eoeVecBroadcast<eoeVec<type, size>>(lhs), rhs.Self());
+}
+
+template<typename expr_t>
+inline constexpr eoeVecNegateExpr<expr_t> operator-(const eoeVecExpr<expr_t> & expr) {
+	return eoeVecNegateExpr<expr_t>(expr.Self());
+}
+
+//-------------------------
+// operator*
+// scales each element by a constant, or by the matching element of an eoeScalarSpan
+//-------------------------
+template<typename expr_t>
+inline constexpr eoeVecScaleExpr<expr_t, typename expr_t::value_t::component_t, eoeVecMultiplyOp> operator*(const eoeVecExpr<expr_t> & expr, const typename expr_t::value_t::component_t scale) {
+	return eoeVecScaleExpr<expr_t, typename expr_t::value_t::component_t, eoeVecMultiplyOp>(expr.Self(), scale);
+}
+
+template<typename expr_t>
+inline constexpr eoeVecScaleExpr<expr_t, typename expr_t::value_t::component_t, eoeVecMultiplyOp> operator*(const typename expr_t::value_t::component_t scale, const eoeVecExpr<expr_t> & expr) {
+	return eoeVecScaleExpr<expr_t, typename expr_t::value_t::component_t, eoeVecMultiplyOp>(expr.Self(), scale);
+}
+
+template<typename expr_t>
+inline constexpr eoeVecScaleExpr<expr_t, eoeScalarSpan<typename expr_t::value_t::component_t>, eoeVecMultiplyOp> operator*(const eoeVecExpr<expr_t> & expr, const eoeScalarSpan<typename expr_t::value_t::component_t> & scales) {
+	return eoeVecScaleExpr<expr_t, eoeScalarSpan<typename expr_t::value_t::component_t>, eoeVecMultiplyOp>(expr.Self(), scales);
+}
+
+//-------------------------
+// operator/
+// de-scales each element by a constant, or by the matching element of an eoeScalarSpan
+// DEBUG: allows divide by zero errors to occur
+//-------------------------
+template<typename expr_t>
+inline constexpr eoeVecScaleExpr<expr_t, typename expr_t::value_t::component_t, eoeVecDivideOp> operator/(const eoeVecExpr<expr_t> & expr, const typename expr_t::value_t::component_t scale) {
+	return eoeVecScaleExpr<expr_t, typename expr_t::value_t::component_t, eoeVecDivideOp>(expr.Self(), scale);
+}
+
+template<typename expr_t>
+inline constexpr eoeVecScaleExpr<expr_t, eoeScalarSpan<typename expr_t::value_t::component_t>, eoeVecDivideOp> operator/(const eoeVecExpr<expr_t> & expr, const eoeScalarSpan<typename expr_t::value_t::component_t> & scales) {
+	return eoeVecScaleExpr<expr_t, eoeScalarSpan<typename expr_t::value_t::component_t>, eoeVecDivideOp>(expr.Self(), scales);
+}
+
+//-------------------------
+// Scale, Min, Max
+// the component-wise eoeVec operations over whole expressions
+//-------------------------
+template<typename lhs_t, typename rhs_t>
+inline constexpr eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecScaleOp> Scale(const eoeVecExpr<lhs_t> & lhs, const eoeVecExpr<rhs_t> & rhs) {
+	return eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecScaleOp>(lhs.Self(), rhs.Self());
+}
+
+template<typename lhs_t, typename rhs_t>
+inline constexpr eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecMinOp> Min(const eoeVecExpr<lhs_t> & lhs, const eoeVecExpr<rhs_t> & rhs) {
+	return eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecMinOp>(lhs.Self(), rhs.Self());
+}
+
+template<typename lhs_t, typename rhs_t>
+inline constexpr eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecMaxOp> Max(const eoeVecExpr<lhs_t> & lhs, const eoeVecExpr<rhs_t> & rhs) {
+	return eoeVecBinaryExpr<lhs_t, rhs_t, eoeVecMaxOp>(lhs.Self(), rhs.Self());
+}
+
+#endif /* EOECORE_VECTOR_EXPRESSION_H */
@@ -0,0 +1,389 @@
+#include <string.h>
+#include <utility>
+#include "Allocator.h"
+#include "VectorStream.h"
+#include "SIMD.h"
+
+static const int STREAM_ALIGN_FLOATS = SIMD_ALIGNMENT / sizeof(float);		// one 256-bit register
+
+//--------------------------
+// AllocStream
+// allocates numComponents zeroed arrays of numPadded floats back-to-back,
+// aligned to SIMD_ALIGNMENT, release it with eoeAlignedFree
+//--------------------------
+static float * AllocStream(const int numComponents, const int numPadded) {
+	const int numFloats = numComponents * numPadded;
+	float * memory = static_cast<float *>(eoeAlignedAlloc(numFloats * sizeof(float)));
+	memset(memory, 0, numFloats * sizeof(float));
+	return memory;
+}
+
+//--------------------------
+// PadStreamLength
+// rounds num up to a whole number of SIMD registers
+//--------------------------
+static int PadStreamLength(const int num) {
+	return (num + STREAM_ALIGN_FLOATS - 1) & ~(STREAM_ALIGN_FLOATS - 1);
+}
+
+//--------------------------
+// eoeVec3Stream::eoeVec3Stream
+//--------------------------
+eoeVec3Stream::eoeVec3Stream(const int num) {
+	SetNum(num);
+}
+
+//--------------------------
+// eoeVec3Stream::eoeVec3Stream
+//--------------------------
+eoeVec3Stream::eoeVec3Stream(const eoeVec3Stream & other) {
+	*this = other;
+}
+
+//--------------------------
+// eoeVec3Stream::eoeVec3Stream
+//--------------------------
+eoeVec3Stream::eoeVec3Stream(eoeVec3Stream && other) {
+	*this = std::move(other);
+}
+
+//--------------------------
+// eoeVec3Stream::~eoeVec3Stream
+//--------------------------
+eoeVec3Stream::~eoeVec3Stream() {
+	eoeAlignedFree(memory);
+}
+
+//--------------------------
+// eoeVec3Stream::operator=
+//--------------------------
+eoeVec3Stream & eoeVec3Stream::operator=(const eoeVec3Stream & other) {
+	if (this != &other) {
+		SetNum(other.num);
+		if (numPadded > 0)
+			memcpy(x, other.x, 3 * numPadded * sizeof(float));
+	}
+	return *this;
+}
+
+//--------------------------
+// eoeVec3Stream::operator=
+// takes other's arrays, leaving it empty
+//--------------------------
+eoeVec3Stream & eoeVec3Stream::operator=(eoeVec3Stream && other) {
+	if (this != &other) {
+		eoeAlignedFree(memory);
+		memory = other.memory;
+		num = other.num;
+		numPadded = other.numPadded;
+		capacity = other.capacity;
+		x = other.x;
+		y = other.y;
+		z = other.z;
+
+		other.memory = nullptr;
+		other.num = 0;
+		other.numPadded = 0;
+		other.capacity = 0;
+		other.x = nullptr;
+		other.y = nullptr;
+		other.z = nullptr;
+	}
+	return *this;
+}
+
+//--------------------------
+// eoeVec3Stream::SetNum
+// resizes the stream to hold newNum vectors, all set to zero
+// reuses the existing allocation whenever it has room, so shrinking
+// never reallocates, and only growing past capacity does
+//--------------------------
+void eoeVec3Stream::SetNum(const int newNum) {
+	numPadded = PadStreamLength(newNum);
+	num = newNum;
+	if (numPadded > capacity) {
+		eoeAlignedFree(memory);
+		capacity = numPadded;
+		memory = AllocStream(3, capacity);
+	} else if (memory != nullptr) {
+		memset(memory, 0, 3 * numPadded * sizeof(float));
+	}
+
+	// components are numPadded apart, so they move whenever it changes
+	x = memory;
+	y = memory + numPadded;
+	z = memory + 2 * numPadded;
+}
+
+//--------------------------
+// eoeVec3Stream::Zero
+// sets x, y, and z of every vector to zero
+//--------------------------
+void eoeVec3Stream::Zero() {
+	if (x != nullptr)
+		memset(x, 0, 3 * numPadded * sizeof(float));
+}
+
+//--------------------------
+// eoeVec3Stream::Gather
+// resizes the stream to num and copies in packed eoeVec3s
+//--------------------------
+void eoeVec3Stream::Gather(const eoeVec3 * src, const int num) {
+	SetNum(num);
+	EVIL_SIMD->SoA_FromVec3(Components(), src, num);
+}
+
+//--------------------------
+// eoeVec3Stream::Scatter
+// copies every vector out to packed eoeVec3s
+// dst must hold at least Num() vectors
+//--------------------------
+void eoeVec3Stream::Scatter(eoeVec3 * dst) const {
+	EVIL_SIMD->SoA_ToVec3(dst, Components(), num);
+}
+
+//--------------------------
+// eoeVec3Stream::Add
+// adds the matching vector of a to each vector
+//--------------------------
+void eoeVec3Stream::Add(const eoeVec3Stream & a) {
+	EVIL_SIMD->Float_Add(x, x, a.x, 3 * numPadded);
+}
+
+//--------------------------
+// eoeVec3Stream::Scale
+// scales each vector by a
+//--------------------------
+void eoeVec3Stream::Scale(const float a) {
+	EVIL_SIMD->Float_Scale(x, x, a, 3 * numPadded);
+}
+
+//--------------------------
+// eoeVec3Stream::MultiplyAdd
+// adds the matching vector of a scaled by scale to each vector
+// eg: positions.MultiplyAdd(velocities, deltaTime)
+//--------------------------
+void eoeVec3Stream::MultiplyAdd(const eoeVec3Stream & a, const float scale) {
+	EVIL_SIMD->Float_MultiplyAdd(x, x, a.x, scale, 3 * numPadded);
+}
+
+//--------------------------
+// eoeVec3Stream::Dot
+// dst[i] = dot product of vector i with vector i of a
+// dst must hold at least Num() floats
+//--------------------------
+void eoeVec3Stream::Dot(float * dst, const eoeVec3Stream & a) const {
+	EVIL_SIMD->SoA_Dot(dst, Components(), a.Components(), 3, num);
+}
+
+//--------------------------
+// eoeVec3Stream::Cross
+// sets each vector to the cross product of the matching vectors of a and b
+// a or b may be *this
+//--------------------------
+void eoeVec3Stream::Cross(const eoeVec3Stream & a, const eoeVec3Stream & b) {
+	EVIL_SIMD->SoA_Cross(Components(), a.Components(), b.Components(), numPadded);
+}
+
+//--------------------------
+// eoeVec3Stream::Length
+// dst[i] = length of vector i
+// dst must hold at least Num() floats
+//--------------------------
+void eoeVec3Stream::Length(float * dst) const {
+	EVIL_SIMD->SoA_Length(dst, Components(), 3, num);
+}
+
+//--------------------------
+// eoeVec3Stream::Normalize
+// scales each vector to unit length, zero length vectors stay zero
+//--------------------------
+void eoeVec3Stream::Normalize() {
+	EVIL_SIMD->SoA_Normalize(Components(), 3, numPadded);
+}
+
+//--------------------------
+// eoeVec3Stream::SnapInt
+// moves each component of each vector to the nearest integer value
+//--------------------------
+void eoeVec3Stream::SnapInt() {
+	EVIL_SIMD->Float_SnapInt(x, x, 3 * numPadded);
+}
+
+//--------------------------
+// eoeVec4Stream::eoeVec4Stream
+//--------------------------
+eoeVec4Stream::eoeVec4Stream(const int num) {
+	SetNum(num);
+}
+
+//--------------------------
+// eoeVec4Stream::eoeVec4Stream
+//--------------------------
+eoeVec4Stream::eoeVec4Stream(const eoeVec4Stream & other) {
+	*this = other;
+}
+
+//--------------------------
+// eoeVec4Stream::eoeVec4Stream
+//--------------------------
+eoeVec4Stream::eoeVec4Stream(eoeVec4Stream && other) {
+	*this = std::move(other);
+}
+
+//--------------------------
+// eoeVec4Stream::~eoeVec4Stream
+//--------------------------
+eoeVec4Stream::~eoeVec4Stream() {
+	eoeAlignedFree(memory);
+}
+
+//--------------------------
+// eoeVec4Stream::operator=
+//--------------------------
+eoeVec4Stream & eoeVec4Stream::operator=(const eoeVec4Stream & other) {
+	if (this != &other) {
+		SetNum(other.num);
+		if (numPadded > 0)
+			memcpy(x, other.x, 4 * numPadded * sizeof(float));
+	}
+	return *this;
+}
+
+//--------------------------
+// eoeVec4Stream::operator=
+// takes other's arrays, leaving it empty
+//--------------------------
+eoeVec4Stream & eoeVec4Stream::operator=(eoeVec4Stream && other) {
+	if (this != &other) {
+		eoeAlignedFree(memory);
+		memory = other.memory;
+		num = other.num;
+		numPadded = other.numPadded;
+		capacity = other.capacity;
+		x = other.x;
+		y = other.y;
+		z = other.z;
+		w = other.w;
+
+		other.memory = nullptr;
+		other.num = 0;
+		other.numPadded = 0;
+		other.capacity = 0;
+		other.x = nullptr;
+		other.y = nullptr;
+		other.z = nullptr;
+		other.w = nullptr;
+	}
+	return *this;
+}
+
+//--------------------------
+// eoeVec4Stream::SetNum
+// resizes the stream to hold newNum vectors, all set to zero
+// reuses the existing allocation whenever it has room, so shrinking
+// never reallocates, and only growing past capacity does
+//--------------------------
+void eoeVec4Stream::SetNum(const int newNum) {
+	numPadded = PadStreamLength(newNum);
+	num = newNum;
+	if (numPadded > capacity) {
+		eoeAlignedFree(memory);
+		capacity = numPadded;
+		memory = AllocStream(4, capacity);
+	} else if (memory != nullptr) {
+		memset(memory, 0, 4 * numPadded * sizeof(float));
+	}
+
+	// components are numPadded apart, so they move whenever it changes
+	x = memory;
+	y = memory + numPadded;
+	z = memory + 2 * numPadded;
+	w = memory + 3 * numPadded;
+}
+
+//--------------------------
+// eoeVec4Stream::Zero
+// sets x, y, z, and w of every vector to zero
+//--------------------------
+void eoeVec4Stream::Zero() {
+	if (x != nullptr)
+		memset(x, 0, 4 * numPadded * sizeof(float));
+}
+
+//--------------------------
+// eoeVec4Stream::Gather
+// resizes the stream to num and copies in packed eoeVec4s
+//--------------------------
+void eoeVec4Stream::Gather(const eoeVec4 * src, const int num) {
+	SetNum(num);
+	EVIL_SIMD->SoA_FromVec4(Components(), src, num);
+}
+
+//--------------------------
+// eoeVec4Stream::Scatter
+// copies every vector out to packed eoeVec4s
+// dst must hold at least Num() vectors
+//--------------------------
+void eoeVec4Stream::Scatter(eoeVec4 * dst) const {
+	EVIL_SIMD->SoA_ToVec4(dst, Components(), num);
+}
+
+//--------------------------
+// eoeVec4Stream::Add
+// adds the matching vector of a to each vector
+//--------------------------
+void eoeVec4Stream::Add(const eoeVec4Stream & a) {
+	EVIL_SIMD->Float_Add(x, x, a.x, 4 * numPadded);
+}
+
+//--------------------------
+// eoeVec4Stream::Scale
+// scales each vector by a
+//--------------------------
+void eoeVec4Stream::Scale(const float a) {
+	EVIL_SIMD->Float_Scale(x, x, a, 4 * numPadded);
+}
+
+//--------------------------
+// eoeVec4Stream::MultiplyAdd
+// adds the matching vector of a scaled by scale to each vector
+// eg: positions.MultiplyAdd(velocities, deltaTime)
+//--------------------------
+void eoeVec4Stream::MultiplyAdd(const eoeVec4Stream & a, const float scale) {
+	EVIL_SIMD->Float_MultiplyAdd(x, x, a.x, scale, 4 * numPadded);
+}
+
+//--------------------------
+// eoeVec4Stream::Dot
+// dst[i] = dot product of vector i with vector i of a
+// dst must hold at least Num() floats
+//--------------------------
+void eoeVec4Stream::Dot(float * dst, const eoeVec4Stream & a) const {
+	EVIL_SIMD->SoA_Dot(dst, Components(), a.Components(), 4, num);
+}
+
+//--------------------------
+// eoeVec4Stream::Length
+// dst[i] = length of vector i
+// dst must hold at least Num() floats
+//--------------------------
+void eoeVec4Stream::Length(float * dst) const {
+	EVIL_SIMD->SoA_Length(dst, Components(), 4, num);
+}
+
+//--------------------------
+// eoeVec4Stream::Normalize
+// scales each vector to unit length, zero length vectors stay zero
+//--------------------------
+void eoeVec4Stream::Normalize() {
+	EVIL_SIMD->SoA_Normalize(Components(), 4, numPadded);
+}
+
+//--------------------------
+// eoeVec4Stream::SnapInt
+// moves each component of each vector to the nearest integer value
+//--------------------------
+void eoeVec4Stream::SnapInt() {
+	EVIL_SIMD->Float_SnapInt(x, x, 4 * numPadded);
+}
@@ -0,0 +1,230 @@
+#ifndef EOECORE_VECTOR_STREAM_H
+#define EOECORE_VECTOR_STREAM_H
+
+#include "Vector.h"
+
+// structure-of-arrays containers for bulk vector math
+// each component lives in its own contiguous array, padded and
+// aligned to the widest SIMD register so kernels never need a scalar tail
+// DEBUG: binary operations assume both streams have the same Num()
+
+//--------------------------------------------
+//
+//
+//				eoeVec3Stream
+//	   --many eoeVec3s as x[], y[], z[]--
+//
+//
+//--------------------------------------------
+class eoeVec3Stream {
+public:
+
+	float *					x = nullptr;
+	float *					y = nullptr;
+	float *					z = nullptr;
+
+							eoeVec3Stream() = default;
+	explicit				eoeVec3Stream(const int num);
+							eoeVec3Stream(const eoeVec3Stream & other);
+							eoeVec3Stream(eoeVec3Stream && other);
+						   ~eoeVec3Stream();
+
+	eoeVec3Stream &			operator=(const eoeVec3Stream & other);
+	eoeVec3Stream &			operator=(eoeVec3Stream && other);
+
+	void					SetNum(const int newNum);
+	int						Num() const;
+	int						NumPadded() const;
+	void					Zero();
+
+	eoeVec3					Get(const int index) const;
+	void					Set(const int index, const eoeVec3 & v);
+	void					Gather(const eoeVec3 * src, const int num);
+	void					Scatter(eoeVec3 * dst) const;
+
+	void					Add(const eoeVec3Stream & a);
+	void					Scale(const float a);
+	void					MultiplyAdd(const eoeVec3Stream & a, const float scale);
+	void					Dot(float * dst, const eoeVec3Stream & a) const;
+	void					Cross(const eoeVec3Stream & a, const eoeVec3Stream & b);
+	void					Length(float * dst) const;
+	void					Normalize();
+	void					SnapInt();
+
+private:
+
+	float * const *			Components();
+	const float * const *	Components() const;
+
+private:
+
+	float *					memory		= nullptr;		// aligned allocation x, y, and z point into
+	int						num			= 0;
+	int						numPadded	= 0;
+	int						capacity	= 0;			// numPadded that memory has room for
+};
+
+//--------------------------------------------
+//
+//
+//				eoeVec4Stream
+//	 --many eoeVec4s as x[], y[], z[], w[]--
+//
+//
+//--------------------------------------------
+class eoeVec4Stream {
+public:
+
+	float *					x = nullptr;
+	float *					y = nullptr;
+	float *					z = nullptr;
+	float *					w = nullptr;
+
+							eoeVec4Stream() = default;
+	explicit				eoeVec4Stream(const int num);
+							eoeVec4Stream(const eoeVec4Stream & other);
+							eoeVec4Stream(eoeVec4Stream && other);
+						   ~eoeVec4Stream();
+
+	eoeVec4Stream &			operator=(const eoeVec4Stream & other);
+	eoeVec4Stream &			operator=(eoeVec4Stream && other);
+
+	void					SetNum(const int newNum);
+	int						Num() const;
+	int						NumPadded() const;
+	void					Zero();
+
+	eoeVec4					Get(const int index) const;
+	void					Set(const int index, const eoeVec4 & v);
+	void					Gather(const eoeVec4 * src, const int num);
+	void					Scatter(eoeVec4 * dst) const;
+
+	void					Add(const eoeVec4Stream & a);
+	void					Scale(const float a);
+	void					MultiplyAdd(const eoeVec4Stream & a, const float scale);
+	void					Dot(float * dst, const eoeVec4Stream & a) const;
+	void					Length(float * dst) const;
+	void					Normalize();
+	void					SnapInt();
+
+private:
+
+	float * const *			Components();
+	const float * const *	Components() const;
+
+private:
+
+	float *					memory		= nullptr;		// aligned allocation x, y, z, and w point into
+	int						num			= 0;
+	int						numPadded	= 0;
+	int						capacity	= 0;			// numPadded that memory has room for
+};
+
+//-------------------------
+// eoeVec3Stream::Num
+// returns the number of vectors in the stream
+//-------------------------
+inline int eoeVec3Stream::Num() const {
+	return num;
+}
+
+//-------------------------
+// eoeVec3Stream::NumPadded
+// returns the length of each component array, a multiple of the SIMD width
+// padding elements are zero after SetNum and safe to read and write
+//-------------------------
+inline int eoeVec3Stream::NumPadded() const {
+	return numPadded;
+}
+
+//-------------------------
+// eoeVec3Stream::Get
+// returns a copy of the vector at index
+// undefined behavior for index out of bounds
+//-------------------------
+inline eoeVec3 eoeVec3Stream::Get(const int index) const {
+	return eoeVec3(x[index], y[index], z[index]);
+}
+
+//-------------------------
+// eoeVec3Stream::Set
+// overwrites the vector at index
+// undefined behavior for index out of bounds
+//-------------------------
+inline void eoeVec3Stream::Set(const int index, const eoeVec3 & v) {
+	x[index] = v.x;
+	y[index] = v.y;
+	z[index] = v.z;
+}
+
+//-------------------------
+// eoeVec3Stream::Components
+// returns x, y, and z as an array for the SoA_ kernels
+//-------------------------
+inline float * const * eoeVec3Stream::Components() {
+	return &x;
+}
+
+//-------------------------
+// eoeVec3Stream::Components
+// returns x, y, and z as an array for the SoA_ kernels
+//-------------------------
+inline const float * const * eoeVec3Stream::Components() const {
+	return &x;
+}
+
+//-------------------------
+// eoeVec4Stream::Num
+// returns the number of vectors in the stream
+//-------------------------
+inline int eoeVec4Stream::Num() const {
+	return num;
+}
+
+//-------------------------
+// eoeVec4Stream::NumPadded
+// returns the length of each component array, a multiple of the SIMD width
+// padding elements are zero after SetNum and safe to read and write
+//-------------------------
+inline int eoeVec4Stream::NumPadded() const {
+	return numPadded;
+}
+
+//-------------------------
+// eoeVec4Stream::Get
+// returns a copy of the vector at index
+// undefined behavior for index out of bounds
+//-------------------------
+inline eoeVec4 eoeVec4Stream::Get(const int index) const {
+	return eoeVec4(x[index], y[index], z[index], w[index]);
+}
+
+//-------------------------
+// eoeVec4Stream::Set
+// overwrites the vector at index
+// undefined behavior for index out of bounds
+//-------------------------
+inline void eoeVec4Stream::Set(const int index, const eoeVec4 & v) {
+	x[index] = v.x;
+	y[index] = v.y;
+	z[index] = v.z;
+	w[index] = v.w;
+}
+
+//-------------------------
+// eoeVec4Stream::Components
+// returns x, y, z, and w as an array for the SoA_ kernels
+//-------------------------
+inline float * const * eoeVec4Stream::Components() {
+	return &x;
+}
+
+//-------------------------
+// eoeVec4Stream::Components
+// returns x, y, z, and w as an array for the SoA_ kernels
+//-------------------------
+inline const float * const * eoeVec4Stream::Components() const {
+	return &x;
+}
+
+#endif /* EOECORE_VECTOR_STREAM_H */